@@ -5,4 +5,6 @@ MxxRu::Cpp::composite_target {
 	required_prj "benches/single_handler/prj.rb"
 	required_prj "benches/single_handler_so5_timer/prj.rb"
 	required_prj "benches/single_handler_no_timer/prj.rb"
+	required_prj "benches/single_handler_timing_wheel_timer/prj.rb"
+	required_prj "benches/pipelining/prj.rb"
 }
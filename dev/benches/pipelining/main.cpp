@@ -0,0 +1,177 @@
+/*
+	restinio bench for pipelined requests.
+
+	Runs a server and a client in the same process. The client sends
+	requests in batches of pipelined requests and measures the time
+	of getting all responses.
+
+	Usage: _bench.restinio.pipelining [requests [pipeline-depth]]
+*/
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <restinio/all.hpp>
+
+namespace
+{
+
+const std::string resp_body{ "Hello world!" };
+
+const std::uint16_t port = 8090;
+
+struct req_handler_t
+{
+	auto operator () ( restinio::request_handle_t req ) const
+	{
+		if( restinio::http_method_get() == req->header().method() &&
+			req->header().request_target() == "/" )
+		{
+			return
+				req->create_response()
+					.append_header( "Server", "RESTinio Benchmark" )
+					.append_header( "Content-Type", "text/plain; charset=utf-8" )
+					.set_body( resp_body )
+					.done();
+		}
+
+		return restinio::request_rejected();
+	}
+};
+
+using traits_t =
+	restinio::single_thread_traits_t<
+		restinio::asio_timer_manager_t,
+		restinio::null_logger_t,
+		req_handler_t >;
+
+std::size_t
+arg_value( int argc, const char * argv[], int index, std::size_t default_value )
+{
+	if( index < argc )
+		return static_cast< std::size_t >( std::stoul( argv[ index ] ) );
+
+	return default_value;
+}
+
+//! Send requests and wait for all responses.
+/*!
+	Every response ends with resp_body, so responses are counted
+	by occurrences of it.
+*/
+void
+run_client( std::size_t requests, std::size_t depth )
+{
+	using restinio::asio_ns::ip::tcp;
+
+	restinio::asio_ns::io_context io_context;
+	tcp::socket socket{ io_context };
+	socket.connect(
+		tcp::endpoint{
+			restinio::asio_ns::ip::make_address( "127.0.0.1" ), port } );
+	socket.set_option( tcp::no_delay{ true } );
+
+	std::string batch;
+	for( std::size_t i = 0; i != depth; ++i )
+		batch +=
+			"GET / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"\r\n";
+
+	std::string input;
+	std::array< char, 64 * 1024 > buf;
+
+	const auto started_at = std::chrono::steady_clock::now();
+
+	for( std::size_t sent = 0; sent < requests; sent += depth )
+	{
+		restinio::asio_ns::write( socket, restinio::asio_ns::buffer( batch ) );
+
+		std::size_t received = 0;
+		while( received != depth )
+		{
+			const auto n = socket.read_some( restinio::asio_ns::buffer( buf ) );
+			input.append( buf.data(), n );
+
+			std::string::size_type pos;
+			while( std::string::npos != ( pos = input.find( resp_body ) ) )
+			{
+				input.erase( 0, pos + resp_body.size() );
+				++received;
+			}
+		}
+	}
+
+	const auto duration = std::chrono::duration_cast<
+			std::chrono::microseconds >(
+				std::chrono::steady_clock::now() - started_at );
+
+	const auto handled = ( requests + depth - 1 ) / depth * depth;
+
+	std::cout << "pipeline depth: " << depth
+		<< ", requests: " << handled
+		<< ", time: " << duration.count() / 1000.0 << " ms"
+		<< ", req/s: "
+		<< static_cast< std::uint64_t >(
+				handled * 1000000.0 / static_cast< double >( duration.count() ) )
+		<< std::endl;
+}
+
+} /* anonymous namespace */
+
+int main( int argc, const char * argv[] )
+{
+	try
+	{
+		const auto requests = arg_value( argc, argv, 1, 200000u );
+		const auto depth = arg_value( argc, argv, 2, 16u );
+
+		if( 0u == depth )
+			throw std::runtime_error{ "invalid pipeline depth" };
+
+		using namespace std::chrono;
+
+		restinio::http_server_t< traits_t > server{
+			restinio::own_io_context(),
+			[&]( auto & settings ) {
+				settings
+					.address( "127.0.0.1" )
+					.port( port )
+					.buffer_size( 16 * 1024 )
+					.read_next_http_message_timelimit( 5s )
+					.write_http_response_timelimit( 5s )
+					.handle_request_timeout( 5s )
+					.max_pipelined_requests( depth )
+					.socket_options_setter( []( auto options ) {
+						options.set_option(
+							restinio::asio_ns::ip::tcp::no_delay{ true } );
+					} );
+			} };
+
+		restinio::on_pool_runner_t< restinio::http_server_t< traits_t > >
+			runner{ 1u, server };
+
+		std::promise< void > started;
+		runner.start(
+			[&started]() noexcept { started.set_value(); },
+			[&started]( std::exception_ptr ex ) noexcept {
+				started.set_exception( std::move( ex ) );
+			} );
+		started.get_future().get();
+
+		run_client( requests, depth );
+
+		runner.stop();
+		runner.wait();
+	}
+	catch( const std::exception & ex )
+	{
+		std::cerr << "Error: " << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -10,6 +10,7 @@ add_executable(${TEST_BENCH} ${TEST_BENCH_SRCFILES})
 
 TARGET_LINK_LIBRARIES(${TEST_BENCH} PRIVATE restinio::restinio)
 TARGET_INCLUDE_DIRECTORIES(${TEST_BENCH} PRIVATE ${CMAKE_SOURCE_DIR}/args)
+TARGET_INCLUDE_DIRECTORIES(${TEST_BENCH} PRIVATE ${CMAKE_SOURCE_DIR})
 
 link_threads_if_necessary(${TEST_BENCH})
 
@@ -14,10 +14,13 @@
 #include <restinio/settings.hpp>
 #include <restinio/http_headers.hpp>
 #include <restinio/message_builders.hpp>
+#include <restinio/prepared_response.hpp>
 #include <restinio/http_server.hpp>
 #include <restinio/http_server_run.hpp>
 #include <restinio/asio_timer_manager.hpp>
 #include <restinio/null_timer_manager.hpp>
+#include <restinio/timing_wheel_timer_manager.hpp>
+#include <restinio/async_file_reader.hpp>
 #include <restinio/null_logger.hpp>
 #include <restinio/ostream_logger.hpp>
 #include <restinio/uri_helpers.hpp>
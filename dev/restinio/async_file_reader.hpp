@@ -0,0 +1,872 @@
+/*
+	restinio
+*/
+
+/*!
+	Implementations of async file reader for sendfile operations.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <restinio/sendfile.hpp>
+#include <restinio/utils/suppress_exceptions.hpp>
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <memory>
+
+#if !defined( _MSC_VER ) && !defined( __MINGW32__ )
+
+#include <unistd.h>
+
+#if defined( __linux__ ) && !defined( RESTINIO_NO_IO_URING ) && \
+		defined( __has_include )
+	#if __has_include( <linux/io_uring.h> )
+		#define RESTINIO_HAS_IO_URING_FILE_READER
+	#endif
+#endif
+
+#if defined( RESTINIO_HAS_IO_URING_FILE_READER )
+	#include <linux/io_uring.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <sys/eventfd.h>
+	#include <poll.h>
+	#include <sys/uio.h>
+	#include <cstring>
+#endif
+
+namespace restinio
+{
+
+//
+// thread_pool_file_reader_t
+//
+
+//! Async file reader that performs blocking reads on its own threads.
+/*!
+	The count of threads is fixed at the construction time, so
+	the count of simultaneous disk reads is bounded. Requests
+	are processed in FIFO order.
+
+	Completion handlers are called on threads of the reader.
+
+	@since v.0.6.9
+*/
+class thread_pool_file_reader_t final : public async_file_reader_t
+{
+	public:
+		thread_pool_file_reader_t( std::size_t threads_count )
+		{
+			if( 0u == threads_count )
+				throw exception_t{ "threads_count can't be zero" };
+
+			m_threads.reserve( threads_count );
+			try
+			{
+				for( std::size_t i = 0u; i != threads_count; ++i )
+					m_threads.emplace_back( [this]{ thread_body(); } );
+			}
+			catch( ... )
+			{
+				shutdown();
+				throw;
+			}
+		}
+
+		thread_pool_file_reader_t( const thread_pool_file_reader_t & ) = delete;
+		thread_pool_file_reader_t & operator=( const thread_pool_file_reader_t & ) = delete;
+
+		//! Waits for completion of all requests and stops threads.
+		~thread_pool_file_reader_t() override
+		{
+			shutdown();
+		}
+
+		void
+		async_read(
+			file_descriptor_t fd,
+			file_offset_t offset,
+			char * buffer,
+			std::size_t size,
+			completion_handler_t handler ) override
+		{
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+				if( m_shutdown )
+					throw exception_t{ "thread_pool_file_reader is shut down" };
+
+				m_queue.push_back(
+					request_t{ fd, offset, buffer, size, std::move( handler ) } );
+			}
+
+			m_wakeup.notify_one();
+		}
+
+	private:
+		struct request_t
+		{
+			file_descriptor_t m_fd;
+			file_offset_t m_offset;
+			char * m_buffer;
+			std::size_t m_size;
+			completion_handler_t m_handler;
+		};
+
+		void
+		shutdown() noexcept
+		{
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+				m_shutdown = true;
+			}
+			m_wakeup.notify_all();
+
+			for( auto & t : m_threads )
+				t.join();
+			m_threads.clear();
+		}
+
+		void
+		thread_body() noexcept
+		{
+			for(;;)
+			{
+				std::unique_lock< std::mutex > lock{ m_lock };
+				m_wakeup.wait( lock, [this]{ return m_shutdown || !m_queue.empty(); } );
+				// Requests are processed even after shutdown.
+				if( m_queue.empty() )
+					return;
+
+				request_t request = std::move( m_queue.front() );
+				m_queue.pop_front();
+				lock.unlock();
+
+				ssize_t n;
+				do
+				{
+#if defined( RESTINIO_FREEBSD_TARGET ) || defined( RESTINIO_MACOS_TARGET )
+					n = ::pread(
+#else
+					n = ::pread64(
+#endif
+							request.m_fd,
+							request.m_buffer,
+							request.m_size,
+							request.m_offset );
+				}
+				while( -1 == n && EINTR == errno );
+
+				const asio_ns::error_code ec = -1 == n ?
+						asio_ns::error_code{
+								errno, asio_ns::error::get_system_category() } :
+						asio_ns::error_code{};
+
+				auto handler = std::move( request.m_handler );
+				restinio::utils::suppress_exceptions_quietly( [&] {
+						handler( ec, -1 == n ? 0u : static_cast< std::size_t >( n ) );
+					} );
+			}
+		}
+
+		std::mutex m_lock;
+		std::condition_variable m_wakeup;
+		std::deque< request_t > m_queue;
+		bool m_shutdown{ false };
+
+		std::vector< std::thread > m_threads;
+};
+
+#if defined( RESTINIO_HAS_IO_URING_FILE_READER )
+
+//
+// io_uring_file_reader_t
+//
+
+//! Async file reader that uses Linux io_uring.
+/*!
+	Requests are submitted to the kernel right from async_read(),
+	completions are reaped by a dedicated thread and completion
+	handlers are called on that thread.
+
+	io_uring is used directly via system calls, there is no
+	dependency on liburing. Kernel 5.1 or newer is required.
+	The constructor throws if io_uring can't be created
+	(for example, it is prohibited by seccomp rules).
+
+	async_read() never blocks. If the count of requests in flight
+	reaches the size of the completion queue then new requests are
+	queued and are submitted by the completion thread as soon as
+	completions are reaped.
+
+	If the ring fails during the work then queued and all subsequent
+	requests are served by thread_pool_file_reader_t with one thread.
+	Requests already submitted to the kernel are still waited for,
+	because the kernel can write to their buffers. If the ring can't be
+	waited anymore those requests, their buffers and the ring are
+	deliberately leaked (completion handlers are never called).
+
+	@attention
+	The reader must not outlive io_context of the server: completion
+	handlers of sendfile operations post the results to executors
+	of connections. Destroy the reader after the server is stopped
+	and before io_context is destroyed.
+
+	@since v.0.6.9
+*/
+class io_uring_file_reader_t final : public async_file_reader_t
+{
+	public:
+		io_uring_file_reader_t( unsigned entries = 256u )
+		{
+			setup_ring( entries );
+			try
+			{
+				m_wakeup_fd = ::eventfd( 0u, EFD_CLOEXEC | EFD_NONBLOCK );
+				if( m_wakeup_fd < 0 )
+					throw exception_t{
+						fmt::format( "unable to create eventfd: {}", strerror( errno ) ) };
+
+				m_completion_thread = std::thread{ [this]{ completion_thread_body(); } };
+			}
+			catch( ... )
+			{
+				release_ring();
+				throw;
+			}
+		}
+
+		io_uring_file_reader_t( const io_uring_file_reader_t & ) = delete;
+		io_uring_file_reader_t & operator=( const io_uring_file_reader_t & ) = delete;
+
+		//! Waits for completion of all requests and destroys the ring.
+		~io_uring_file_reader_t() override
+		{
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+				m_shutdown = true;
+			}
+
+			// The completion thread finishes its work when it sees
+			// the shutdown flag and there are no requests in flight.
+			// Nothing is submitted to the ring here, so the shutdown
+			// works even if the ring is broken.
+			wakeup_completion_thread();
+
+			m_completion_thread.join();
+			if( m_ring_leaked )
+				// Only the eventfd can be closed safely.
+				::close( m_wakeup_fd );
+			else
+				release_ring();
+
+			m_fallback_reader.reset();
+		}
+
+		void
+		async_read(
+			file_descriptor_t fd,
+			file_offset_t offset,
+			char * buffer,
+			std::size_t size,
+			completion_handler_t handler ) override
+		{
+			std::unique_ptr< request_t > request{
+					new request_t{ fd, offset, { buffer, size }, std::move( handler ) } };
+
+			std::unique_lock< std::mutex > lock{ m_lock };
+			if( m_shutdown )
+				throw exception_t{ "io_uring_file_reader is shut down" };
+
+			if( m_broken )
+			{
+				auto & fallback = fallback_reader();
+				lock.unlock();
+
+				fallback.async_read(
+						fd, offset, buffer, size, std::move( request->m_handler ) );
+				return;
+			}
+
+			if( m_pending.empty() && m_in_flight < m_max_in_flight )
+			{
+				const int error = submit_read( *request );
+				if( 0 != error )
+					throw exception_t{
+						fmt::format( "unable to submit io_uring request: {}",
+								strerror( error ) ) };
+
+				// Now the request is owned by the ring.
+				link_outstanding( request.release() );
+			}
+			else
+			{
+				// CQ can overflow if the request is submitted now.
+				// It will be submitted by the completion thread.
+				m_pending.push_back( request.get() );
+				request.release();
+			}
+		}
+
+	private:
+		struct request_t
+		{
+			file_descriptor_t m_fd;
+			file_offset_t m_offset;
+			struct iovec m_iov;
+			completion_handler_t m_handler;
+			//! Result from CQE.
+			std::int32_t m_result{ 0 };
+
+			//! Links in the list of outstanding requests.
+			request_t * m_prev{ nullptr };
+			request_t * m_next{ nullptr };
+		};
+
+		static int
+		io_uring_enter(
+			int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags )
+		{
+			return static_cast< int >( ::syscall( __NR_io_uring_enter,
+					ring_fd, to_submit, min_complete, flags, nullptr, 0 ) );
+		}
+
+		static void *
+		map_ring( int ring_fd, std::size_t size, off_t offset )
+		{
+			void * ptr = ::mmap( nullptr, size, PROT_READ | PROT_WRITE,
+					MAP_SHARED | MAP_POPULATE, ring_fd, offset );
+			if( MAP_FAILED == ptr )
+				throw exception_t{
+					fmt::format( "unable to mmap io_uring: {}", strerror( errno ) ) };
+
+			return ptr;
+		}
+
+		template< typename T >
+		T *
+		sq_field( std::uint32_t offset ) const noexcept
+		{
+			return reinterpret_cast< T * >(
+					static_cast< char * >( m_sq_ring ) + offset );
+		}
+
+		template< typename T >
+		T *
+		cq_field( std::uint32_t offset ) const noexcept
+		{
+			return reinterpret_cast< T * >(
+					static_cast< char * >( m_cq_ring ) + offset );
+		}
+
+		void
+		setup_ring( unsigned entries )
+		{
+			struct io_uring_params params;
+			std::memset( &params, 0, sizeof(params) );
+
+			m_ring_fd = static_cast< int >(
+					::syscall( __NR_io_uring_setup, entries, &params ) );
+			if( m_ring_fd < 0 )
+				throw exception_t{
+					fmt::format( "unable to create io_uring: {}", strerror( errno ) ) };
+
+			try
+			{
+				m_sq_ring_size = params.sq_off.array +
+						params.sq_entries * sizeof(std::uint32_t);
+				m_cq_ring_size = params.cq_off.cqes +
+						params.cq_entries * sizeof(struct io_uring_cqe);
+
+				if( 0u != ( params.features & IORING_FEAT_SINGLE_MMAP ) )
+				{
+					m_sq_ring_size = m_cq_ring_size =
+							std::max( m_sq_ring_size, m_cq_ring_size );
+					m_sq_ring = map_ring( m_ring_fd, m_sq_ring_size, IORING_OFF_SQ_RING );
+					m_cq_ring = m_sq_ring;
+				}
+				else
+				{
+					m_sq_ring = map_ring( m_ring_fd, m_sq_ring_size, IORING_OFF_SQ_RING );
+					m_cq_ring = map_ring( m_ring_fd, m_cq_ring_size, IORING_OFF_CQ_RING );
+				}
+
+				m_sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+				m_sqes = static_cast< struct io_uring_sqe * >(
+						map_ring( m_ring_fd, m_sqes_size, IORING_OFF_SQES ) );
+			}
+			catch( ... )
+			{
+				release_ring();
+				throw;
+			}
+
+			m_sq_tail = sq_field< std::uint32_t >( params.sq_off.tail );
+			m_sq_mask = *sq_field< std::uint32_t >( params.sq_off.ring_mask );
+			m_sq_array = sq_field< std::uint32_t >( params.sq_off.array );
+
+			m_cq_head = cq_field< std::uint32_t >( params.cq_off.head );
+			m_cq_tail = cq_field< std::uint32_t >( params.cq_off.tail );
+			m_cq_mask = *cq_field< std::uint32_t >( params.cq_off.ring_mask );
+			m_cqes = cq_field< struct io_uring_cqe >( params.cq_off.cqes );
+
+			// Every request is submitted immediately, so the count of
+			// requests in flight is limited only by the size of CQ.
+			m_max_in_flight = params.cq_entries;
+		}
+
+		void
+		release_ring() noexcept
+		{
+			if( m_sqes )
+				::munmap( m_sqes, m_sqes_size );
+			if( m_cq_ring && m_cq_ring != m_sq_ring )
+				::munmap( m_cq_ring, m_cq_ring_size );
+			if( m_sq_ring )
+				::munmap( m_sq_ring, m_sq_ring_size );
+			if( m_ring_fd >= 0 )
+				::close( m_ring_fd );
+			if( m_wakeup_fd >= 0 )
+				::close( m_wakeup_fd );
+
+			m_sqes = nullptr;
+			m_sq_ring = m_cq_ring = nullptr;
+			m_ring_fd = -1;
+			m_wakeup_fd = -1;
+		}
+
+		void
+		wakeup_completion_thread() noexcept
+		{
+			const std::uint64_t one = 1u;
+			ssize_t rc;
+			do
+			{
+				rc = ::write( m_wakeup_fd, &one, sizeof(one) );
+			}
+			while( rc < 0 && EINTR == errno );
+			// EAGAIN means that the counter is already non-zero,
+			// the completion thread will be woken up anyway.
+		}
+
+		//! Get the reader for requests made after the ring is broken.
+		/*!
+			@attention
+			Must be called under the lock.
+		*/
+		thread_pool_file_reader_t &
+		fallback_reader()
+		{
+			if( !m_fallback_reader )
+				m_fallback_reader.reset( new thread_pool_file_reader_t{ 1u } );
+
+			return *m_fallback_reader;
+		}
+
+		//! Add a submitted request to the list of outstanding requests.
+		/*!
+			@attention
+			Must be called under the lock.
+		*/
+		void
+		link_outstanding( request_t * request ) noexcept
+		{
+			request->m_prev = nullptr;
+			request->m_next = m_outstanding;
+			if( m_outstanding )
+				m_outstanding->m_prev = request;
+			m_outstanding = request;
+		}
+
+		//! Remove a request from the list of outstanding requests.
+		/*!
+			@attention
+			Must be called under the lock.
+		*/
+		void
+		unlink_outstanding( request_t * request ) noexcept
+		{
+			if( request->m_prev )
+				request->m_prev->m_next = request->m_next;
+			else
+				m_outstanding = request->m_next;
+			if( request->m_next )
+				request->m_next->m_prev = request->m_prev;
+
+			request->m_prev = request->m_next = nullptr;
+		}
+
+		//! Call the handler of the request and destroy the request.
+		static void
+		complete_request(
+			request_t * raw_request,
+			const asio_ns::error_code & ec,
+			std::size_t bytes ) noexcept
+		{
+			std::unique_ptr< request_t > request{ raw_request };
+			auto handler = std::move( request->m_handler );
+			request.reset();
+			restinio::utils::suppress_exceptions_quietly( [&] {
+					handler( ec, bytes );
+				} );
+		}
+
+		//! Put a new read SQE to the ring and submit it.
+		/*!
+			@return 0 on success or the error code. The request isn't
+			owned by the ring in the case of an error.
+
+			@attention
+			Must be called under the lock.
+		*/
+		int
+		submit_read( request_t & request ) noexcept
+		{
+			// Only this thread modifies the tail of SQ.
+			const std::uint32_t tail = *m_sq_tail;
+			const std::uint32_t index = tail & m_sq_mask;
+
+			struct io_uring_sqe * sqe = &m_sqes[ index ];
+			std::memset( sqe, 0, sizeof(*sqe) );
+			sqe->opcode = IORING_OP_READV;
+			sqe->fd = request.m_fd;
+			sqe->off = static_cast< std::uint64_t >( request.m_offset );
+			sqe->addr = reinterpret_cast< std::uint64_t >( &request.m_iov );
+			sqe->len = 1u;
+			sqe->user_data = reinterpret_cast< std::uint64_t >( &request );
+
+			m_sq_array[ index ] = index;
+			__atomic_store_n( m_sq_tail, tail + 1u, __ATOMIC_RELEASE );
+
+			// Only the result 1 means that the SQE is consumed by the kernel.
+			// Zero and EAGAIN/EBUSY mean lack of resources in the kernel,
+			// such attempts are repeated several times.
+			constexpr int max_attempts = 16;
+			int error = 0;
+			for( int attempt = 0; attempt != max_attempts; )
+			{
+				const int rc = io_uring_enter( m_ring_fd, 1u, 0u, 0u );
+				if( 1 == rc )
+				{
+					++m_in_flight;
+					return 0;
+				}
+
+				error = rc < 0 ? errno : EAGAIN;
+				if( EINTR == error )
+					continue;
+				if( EAGAIN != error && EBUSY != error )
+					break;
+
+				++attempt;
+				std::this_thread::yield();
+			}
+
+			// The kernel reads SQ only inside io_uring_enter
+			// so the SQE that isn't consumed can be safely withdrawn.
+			__atomic_store_n( m_sq_tail, tail, __ATOMIC_RELEASE );
+			return error;
+		}
+
+		//! Submit queued requests while there are free slots in CQ.
+		/*!
+			Requests that can't be submitted are added to @a failed list
+			(linked via m_next) with the error in m_result.
+
+			@attention
+			Must be called under the lock.
+		*/
+		void
+		submit_pending_requests( request_t *& failed ) noexcept
+		{
+			while( !m_pending.empty() && m_in_flight < m_max_in_flight )
+			{
+				request_t * request = m_pending.front();
+				m_pending.pop_front();
+
+				const int error = submit_read( *request );
+				if( 0 == error )
+					link_outstanding( request );
+				else
+				{
+					request->m_result = -error;
+					request->m_next = failed;
+					failed = request;
+				}
+			}
+		}
+
+		//! Complete requests from the list linked via m_next.
+		/*!
+			Negative m_result is treated as an error code.
+		*/
+		static void
+		complete_requests( request_t * requests ) noexcept
+		{
+			while( requests )
+			{
+				request_t * request = requests;
+				requests = requests->m_next;
+
+				const auto res = request->m_result;
+				complete_request(
+						request,
+						res < 0 ?
+								asio_ns::error_code{
+										-res,
+										asio_ns::error::get_system_category() } :
+								asio_ns::error_code{},
+						res < 0 ? 0u : static_cast< std::size_t >( res ) );
+			}
+		}
+
+		//! Complete requests which CQEs are in the ring.
+		void
+		reap_completions() noexcept
+		{
+			std::uint32_t head = *m_cq_head;
+			const std::uint32_t tail = __atomic_load_n( m_cq_tail, __ATOMIC_ACQUIRE );
+			if( head == tail )
+				return;
+
+			// Completed requests are unlinked under the lock and linked
+			// into the local list via m_next.
+			request_t * completed = nullptr;
+			unsigned completed_count = 0u;
+			{
+				// Requests are created under the lock. Acquiring it
+				// here also makes the content of requests visible to this
+				// thread in terms of C++ memory model (synchronization
+				// made by the kernel is out of scope of that model).
+				std::lock_guard< std::mutex > lock{ m_lock };
+
+				for( ; head != tail; ++head, ++completed_count )
+				{
+					const struct io_uring_cqe & cqe = m_cqes[ head & m_cq_mask ];
+					auto * request = reinterpret_cast< request_t * >( cqe.user_data );
+					unlink_outstanding( request );
+
+					request->m_result = cqe.res;
+					request->m_next = completed;
+					completed = request;
+				}
+
+				__atomic_store_n( m_cq_head, head, __ATOMIC_RELEASE );
+				m_in_flight -= completed_count;
+
+				if( !m_broken )
+					submit_pending_requests( completed );
+			}
+
+			complete_requests( completed );
+		}
+
+		//! Switch to the fallback reader.
+		/*!
+			Queued requests aren't known to the kernel, so they are
+			passed to the fallback reader.
+		*/
+		void
+		mark_broken() noexcept
+		{
+			std::deque< request_t * > pending;
+			thread_pool_file_reader_t * fallback = nullptr;
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+				m_broken = true;
+				pending.swap( m_pending );
+				restinio::utils::suppress_exceptions_quietly( [&] {
+						fallback = &fallback_reader();
+					} );
+			}
+
+			for( request_t * raw_request : pending )
+			{
+				std::unique_ptr< request_t > request{ raw_request };
+				try
+				{
+					if( !fallback )
+						throw exception_t{ "there is no fallback reader" };
+
+					fallback->async_read(
+							request->m_fd,
+							request->m_offset,
+							static_cast< char * >( request->m_iov.iov_base ),
+							request->m_iov.iov_len,
+							request->m_handler );
+				}
+				catch( ... )
+				{
+					complete_request(
+							request.release(),
+							asio_ns::error::operation_aborted,
+							0u );
+				}
+			}
+		}
+
+		//! Wait for requests in flight after a failure of poll().
+		/*!
+			Requests submitted to the kernel can't be completed before
+			their CQEs arrive: the kernel can write to their buffers.
+			So they are waited by io_uring_enter(). If it fails too
+			the ring and the requests are leaked.
+		*/
+		void
+		drain_broken_ring() noexcept
+		{
+			mark_broken();
+
+			for(;;)
+			{
+				{
+					std::lock_guard< std::mutex > lock{ m_lock };
+					if( 0u == m_in_flight )
+						return;
+				}
+
+				const int rc = io_uring_enter(
+						m_ring_fd, 0u, 1u, IORING_ENTER_GETEVENTS );
+				if( rc < 0 && EINTR != errno )
+				{
+					std::lock_guard< std::mutex > lock{ m_lock };
+					// Buffers of the requests can be used by the kernel,
+					// so neither the requests nor the ring are released.
+					m_ring_leaked = true;
+					m_outstanding = nullptr;
+					m_in_flight = 0u;
+					return;
+				}
+
+				reap_completions();
+			}
+		}
+
+		void
+		completion_thread_body() noexcept
+		{
+			for(;;)
+			{
+				// The ring is waited via poll() instead of
+				// io_uring_enter(GETEVENTS) to have a way to wake up
+				// the thread without submission of anything to the ring.
+				struct pollfd fds[ 2 ];
+				fds[ 0 ].fd = m_ring_fd;
+				fds[ 0 ].events = POLLIN;
+				fds[ 0 ].revents = 0;
+				fds[ 1 ].fd = m_wakeup_fd;
+				fds[ 1 ].events = POLLIN;
+				fds[ 1 ].revents = 0;
+
+				if( ::poll( fds, 2u, -1 ) < 0 )
+				{
+					if( EINTR == errno )
+						continue;
+
+					drain_broken_ring();
+					return;
+				}
+
+				if( 0 != ( ( fds[ 0 ].revents | fds[ 1 ].revents ) &
+						( POLLERR | POLLNVAL ) ) )
+				{
+					drain_broken_ring();
+					return;
+				}
+
+				if( 0 != ( fds[ 1 ].revents & POLLIN ) )
+				{
+					std::uint64_t counter;
+					// The result doesn't matter: the descriptor is
+					// non-blocking and the shutdown flag is checked below.
+					(void)::read( m_wakeup_fd, &counter, sizeof(counter) );
+				}
+
+				reap_completions();
+
+				std::lock_guard< std::mutex > lock{ m_lock };
+				if( m_shutdown && 0u == m_in_flight && m_pending.empty() )
+					return;
+			}
+		}
+
+		int m_ring_fd{ -1 };
+		//! eventfd for waking up the completion thread.
+		int m_wakeup_fd{ -1 };
+
+		void * m_sq_ring{ nullptr };
+		std::size_t m_sq_ring_size{ 0u };
+		void * m_cq_ring{ nullptr };
+		std::size_t m_cq_ring_size{ 0u };
+		struct io_uring_sqe * m_sqes{ nullptr };
+		std::size_t m_sqes_size{ 0u };
+
+		std::uint32_t * m_sq_tail{ nullptr };
+		std::uint32_t m_sq_mask{ 0u };
+		std::uint32_t * m_sq_array{ nullptr };
+
+		std::uint32_t * m_cq_head{ nullptr };
+		std::uint32_t * m_cq_tail{ nullptr };
+		std::uint32_t m_cq_mask{ 0u };
+		struct io_uring_cqe * m_cqes{ nullptr };
+
+		//! Protects submission and the count of requests in flight.
+		std::mutex m_lock;
+		unsigned m_in_flight{ 0u };
+		unsigned m_max_in_flight{ 0u };
+		bool m_shutdown{ false };
+		//! The ring can't be used anymore.
+		bool m_broken{ false };
+		//! The ring and requests in flight are abandoned.
+		bool m_ring_leaked{ false };
+		//! Requests submitted to the ring.
+		request_t * m_outstanding{ nullptr };
+		//! Requests waiting for a free slot in CQ.
+		std::deque< request_t * > m_pending;
+
+		//! Reader for requests made after the ring is broken.
+		std::unique_ptr< thread_pool_file_reader_t > m_fallback_reader;
+
+		std::thread m_completion_thread;
+};
+
+#endif
+
+//
+// make_async_file_reader
+//
+
+//! Create the best async file reader available.
+/*!
+	On Linux io_uring_file_reader_t is used if io_uring is available,
+	otherwise thread_pool_file_reader_t with @a threads_count threads
+	is created.
+
+	@since v.0.6.9
+*/
+inline async_file_reader_handle_t
+make_async_file_reader( std::size_t threads_count = 4u )
+{
+#if defined( RESTINIO_HAS_IO_URING_FILE_READER )
+	try
+	{
+		return std::make_shared< io_uring_file_reader_t >();
+	}
+	catch( const std::exception & )
+	{
+		// Fallback to thread pool.
+	}
+#endif
+
+	return std::make_shared< thread_pool_file_reader_t >( threads_count );
+}
+
+} /* namespace restinio */
+
+#endif
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <utility>
+
 // Try to use __has_cpp_attribute if it is supported.
 #if defined(__has_cpp_attribute)
 	// clang-4 and clang-5 produce warnings when [[nodiscard]]
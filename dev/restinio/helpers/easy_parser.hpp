@@ -32,6 +32,14 @@
 #include <vector>
 #include <cstring>
 
+#if !defined(RESTINIO_EASY_PARSER_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || \
+			(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define RESTINIO_EASY_PARSER_SSE2
+		#include <emmintrin.h>
+	#endif
+#endif
+
 namespace restinio
 {
 
@@ -706,6 +714,129 @@ struct is_hexdigit_predicate_t
 	}
 };
 
+//
+// char_class_table_t
+//
+/*!
+ * @brief A table of 256 flags that tells is a character belongs
+ * to some class.
+ *
+ * The table is built at the compile time from a constexpr predicate,
+ * so checking a character is just one lookup instead of a chain of
+ * comparisons.
+ *
+ * Usage example:
+ * @code
+ * RESTINIO_NODISCARD
+ * inline const char_class_table_t &
+ * my_chars() noexcept
+ * {
+ * 	static constexpr char_class_table_t table{ &is_my_char };
+ * 	return table;
+ * }
+ * ...
+ * const auto run = from.consume_while( my_chars() );
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+class char_class_table_t
+{
+	bool m_flags[ 256 ];
+
+public:
+	//! Type of predicate for building the table.
+	using predicate_t = bool (*)( const char );
+
+	constexpr char_class_table_t( predicate_t predicate ) noexcept
+		:	m_flags{}
+	{
+		for( unsigned i = 0u; i != 256u; ++i )
+			m_flags[ i ] = predicate( static_cast< char >( i ) );
+	}
+
+	//! Does @a ch belong to the class?
+	RESTINIO_NODISCARD
+	constexpr bool
+	operator()( const char ch ) const noexcept
+	{
+		return m_flags[ static_cast< unsigned char >( ch ) ];
+	}
+};
+
+//
+// skip_text_blocks
+//
+/*!
+ * @brief Skip blocks of 16 bytes those contain only text.
+ *
+ * A byte is a text if it is HTAB, is in the range 0x20-0x7E or
+ * is greater than 0x7F (obs-text in terms of RFC7230) and isn't
+ * equal to any of @a stop1, @a stop2, @a stop3.
+ *
+ * It is a fast path for consuming long runs of characters like qdtext
+ * or ctext. It checks 16 bytes at once if SSE2 is available and does
+ * nothing otherwise. The remaining bytes should be checked one by one.
+ *
+ * SSE2 version can be disabled by RESTINIO_EASY_PARSER_NO_SIMD.
+ *
+ * @return pointer to the first byte that isn't checked yet.
+ *
+ * @since v.0.6.9
+ */
+inline const char *
+skip_text_blocks(
+	const char * begin,
+	const char * end,
+	const char stop1,
+	const char stop2,
+	const char stop3 ) noexcept
+{
+#if defined(RESTINIO_EASY_PARSER_SSE2)
+	const __m128i htab = _mm_set1_epi8( HTAB );
+	const __m128i space = _mm_set1_epi8( SP );
+	const __m128i del = _mm_set1_epi8( '\x7F' );
+	const __m128i minus_one = _mm_set1_epi8( -1 );
+	const __m128i s1 = _mm_set1_epi8( stop1 );
+	const __m128i s2 = _mm_set1_epi8( stop2 );
+	const __m128i s3 = _mm_set1_epi8( stop3 );
+
+	while( end - begin >= 16 )
+	{
+		const __m128i v = _mm_loadu_si128(
+				reinterpret_cast< const __m128i * >( begin ) );
+
+		// Bytes greater than 0x7F are negative for signed comparison,
+		// so control characters are in the range [0, 0x20).
+		const __m128i ctl = _mm_andnot_si128(
+				_mm_cmpeq_epi8( v, htab ),
+				_mm_and_si128(
+						_mm_cmpgt_epi8( v, minus_one ),
+						_mm_cmplt_epi8( v, space ) ) );
+
+		const __m128i stops = _mm_or_si128(
+				_mm_or_si128( ctl, _mm_cmpeq_epi8( v, del ) ),
+				_mm_or_si128(
+						_mm_cmpeq_epi8( v, s1 ),
+						_mm_or_si128(
+								_mm_cmpeq_epi8( v, s2 ),
+								_mm_cmpeq_epi8( v, s3 ) ) ) );
+
+		if( 0 != _mm_movemask_epi8( stops ) )
+			break;
+
+		begin += 16;
+	}
+#else
+	(void)end;
+	(void)stop1;
+	(void)stop2;
+	(void)stop3;
+#endif
+
+	return begin;
+}
+
 //
 // source_t
 //
@@ -778,6 +909,64 @@ public:
 			m_index = pos;
 	}
 
+	//! Extract all characters that satisfy a predicate.
+	/*!
+	 * Characters are extracted until the first character that doesn't
+	 * satisfy @a predicate or EOF. That character remains in the
+	 * input stream.
+	 *
+	 * It's much cheaper than extraction of characters one by one via
+	 * getch() and putback().
+	 *
+	 * @return the fragment with extracted characters (can be empty).
+	 *
+	 * @since v.0.6.9
+	 */
+	template< typename Predicate >
+	RESTINIO_NODISCARD
+	string_view_t
+	consume_while( Predicate && predicate ) noexcept
+	{
+		const auto started_at = m_index;
+		const auto size = m_data.size();
+		const char * const data = m_data.data();
+
+		while( m_index < size && predicate( data[ m_index ] ) )
+			++m_index;
+
+		return string_view_t{ data + started_at, m_index - started_at };
+	}
+
+	//! Extract all characters of a text class.
+	/*!
+	 * The same as consume_while() but blocks of bytes are skipped
+	 * by skip_text_blocks() first. The @a predicate should be true
+	 * for every byte that skip_text_blocks() treats as a text
+	 * with the same stop characters.
+	 *
+	 * @since v.0.6.9
+	 */
+	template< typename Predicate >
+	RESTINIO_NODISCARD
+	string_view_t
+	consume_text_while(
+		Predicate && predicate,
+		const char stop1,
+		const char stop2,
+		const char stop3 ) noexcept
+	{
+		const auto started_at = m_index;
+		const char * const data = m_data.data();
+
+		m_index = static_cast< position_t >( skip_text_blocks(
+				data + m_index, data + m_data.size(),
+				stop1, stop2, stop3 ) - data );
+
+		(void)consume_while( std::forward< Predicate >( predicate ) );
+
+		return string_view_t{ data + started_at, m_index - started_at };
+	}
+
 	//! Is EOF has been reached?
 	RESTINIO_NODISCARD
 	bool
@@ -14,6 +14,7 @@
 #include <restinio/helpers/http_field_parsers/content-type.hpp>
 #include <restinio/helpers/http_field_parsers/content-disposition.hpp>
 #include <restinio/helpers/multipart_body.hpp>
+#include <restinio/helpers/multipart_stream.hpp>
 
 #include <restinio/http_headers.hpp>
 #include <restinio/request_handler.hpp>
@@ -411,6 +412,68 @@ enumerate_parts_with_files(
 		return files_found;
 }
 
+//
+// make_stream_part_handler
+//
+/*!
+ * @brief A helper function for creation of a handler of parts
+ * for multipart_body::stream_parser_t that handles only parts with
+ * uploaded files.
+ *
+ * The @a handler is called for every part with an uploaded file.
+ * It receives part_description_t instance with an empty `body`
+ * and should return a sink for the content of the file (or nullptr
+ * if the file should be skipped). Parts without files are skipped.
+ *
+ * A handler passed as @a handler argument should be a copyable function
+ * or lambda/functor with one of the following formats:
+ * @code
+ * part_sink_handle_t(part_description_t part);
+ * part_sink_handle_t(part_description_t && part);
+ * part_sink_handle_t(const part_description_t & part);
+ * @endcode
+ *
+ * @note
+ * An exception is thrown if Content-Disposition field of a part can't
+ * be parsed or has no 'name' parameter.
+ *
+ * Usage example:
+ * @code
+ * using namespace restinio::multipart_body;
+ * using namespace restinio::file_upload;
+ *
+ * auto sink = make_body_sink( header,
+ * 	make_stream_part_handler( [](part_description_t part) -> part_sink_handle_t {
+ * 		return std::make_unique< file_part_sink_t >(
+ * 				open_file_to_write( *part.filename ) );
+ * 	} ),
+ * 	"multipart", "form-data" );
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+template< typename Handler >
+RESTINIO_NODISCARD
+restinio::multipart_body::stream_parser_t::part_handler_t
+make_stream_part_handler( Handler && handler )
+{
+	using restinio::multipart_body::parsed_part_t;
+	using restinio::multipart_body::part_sink_handle_t;
+
+	return [handler = std::forward<Handler>(handler)]
+		( parsed_part_t part ) mutable -> part_sink_handle_t
+		{
+			auto part_description = analyze_part( std::move(part) );
+			if( part_description )
+				return handler( std::move(*part_description) );
+
+			if( enumeration_error_t::no_files_found != part_description.error() )
+				throw exception_t{ "unable to analyze part of multipart body" };
+
+			return {};
+		};
+}
+
 } /* namespace file_upload */
 
 } /* namespace restinio */
@@ -420,12 +420,101 @@ struct is_ctext_predicate_t
 {
 	RESTINIO_NODISCARD
 	bool
-	operator()( const char actual ) const noexcept
-	{
-		return is_ctext(actual);
-	}
+	operator()( const char actual ) const noexcept;
 };
 
+//
+// is_token_char
+//
+/*!
+ * @brief Is a character a tchar?
+ *
+ * See: https://tools.ietf.org/html/rfc7230
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline constexpr bool
+is_token_char( const char ch ) noexcept
+{
+	return is_alpha(ch) || is_digit(ch) ||
+			ch == '!' ||
+			ch == '#' ||
+			ch == '$' ||
+			ch == '%' ||
+			ch == '&' ||
+			ch == '\'' ||
+			ch == '*' ||
+			ch == '+' ||
+			ch == '-' ||
+			ch == '.' ||
+			ch == '^' ||
+			ch == '_' ||
+			ch == '`' ||
+			ch == '|' ||
+			ch == '~';
+}
+
+//
+// token_chars
+//
+/*!
+ * @brief A table for checking tchar.
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline const char_class_table_t &
+token_chars() noexcept
+{
+	static constexpr char_class_table_t table{ &is_token_char };
+	return table;
+}
+
+//
+// qdtext_chars
+//
+/*!
+ * @brief A table for checking qdtext.
+ *
+ * qdtext is a text without '"' and '\\', so a run of qdtext can be
+ * consumed by source_t::consume_text_while().
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline const char_class_table_t &
+qdtext_chars() noexcept
+{
+	static constexpr char_class_table_t table{ &is_qdtext };
+	return table;
+}
+
+//
+// ctext_chars
+//
+/*!
+ * @brief A table for checking ctext.
+ *
+ * ctext is a text without '(', ')' and '\\', so a run of ctext can be
+ * consumed by source_t::consume_text_while().
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline const char_class_table_t &
+ctext_chars() noexcept
+{
+	static constexpr char_class_table_t table{ &is_ctext };
+	return table;
+}
+
+inline bool
+is_ctext_predicate_t::operator()( const char actual ) const noexcept
+{
+	return ctext_chars()( actual );
+}
+
 //
 // ows_producer_t
 //
@@ -447,20 +536,7 @@ public :
 	try_parse(
 		source_t & from ) const noexcept
 	{
-		std::size_t extracted_spaces{};
-		character_t ch;
-		for( ch = from.getch();
-			!ch.m_eof && is_space(ch.m_ch);
-			ch = from.getch() )
-		{
-			++extracted_spaces;
-		}
-
-		if( !ch.m_eof )
-			// The first non-space char should be returned back.
-			from.putback();
-
-		if( extracted_spaces > 0u )
+		if( !from.consume_while( is_space_predicate_t{} ).empty() )
 			return result_type{ ' ' };
 
 		return result_type{ nullopt };
@@ -482,73 +558,20 @@ public :
  */
 class token_producer_t : public producer_tag< std::string >
 {
-	RESTINIO_NODISCARD
-	static optional_t< parse_error_t >
-	try_parse_value( source_t & from, std::string & accumulator )
-	{
-		error_reason_t reason = error_reason_t::pattern_not_found;
-
-		do
-		{
-			const auto ch = from.getch();
-			if( ch.m_eof )
-			{
-				reason = error_reason_t::unexpected_eof;
-				break;
-			}
-
-			if( !is_token_char(ch.m_ch) )
-			{
-				from.putback();
-				reason = error_reason_t::unexpected_character;
-				break;
-			}
-
-			accumulator += ch.m_ch;
-		}
-		while( true );
-
-		if( accumulator.empty() )
-		{
-			return parse_error_t{ from.current_position(), reason };
-		}
-
-		return nullopt;
-	}
-
-	RESTINIO_NODISCARD
-	static constexpr bool
-	is_token_char( const char ch ) noexcept
-	{
-		return is_alpha(ch) || is_digit(ch) ||
-				ch == '!' ||
-				ch == '#' ||
-				ch == '$' ||
-				ch == '%' ||
-				ch == '&' ||
-				ch == '\'' ||
-				ch == '*' ||
-				ch == '+' ||
-				ch == '-' ||
-				ch == '.' ||
-				ch == '^' ||
-				ch == '_' ||
-				ch == '`' ||
-				ch == '|' ||
-				ch == '~';
-	}
-
 public :
 	RESTINIO_NODISCARD
 	expected_t< result_type, parse_error_t >
 	try_parse( source_t & from ) const
 	{
-		std::string value;
-		const auto try_result = try_parse_value( from, value );
-		if( !try_result )
-			return std::move(value);
-		else
-			return make_unexpected( *try_result );
+		const auto token = from.consume_while( token_chars() );
+		if( token.empty() )
+			return make_unexpected( parse_error_t{
+					from.current_position(),
+					from.eof() ? error_reason_t::unexpected_eof :
+							error_reason_t::unexpected_character
+			} );
+
+		return std::string{ token.data(), token.size() };
 	}
 };
 
@@ -576,6 +599,11 @@ class quoted_string_producer_t : public producer_tag< std::string >
 		bool second_quote_extracted{ false };
 		do
 		{
+			// A run of qdtext is extracted at once.
+			const auto text = from.consume_text_while(
+					qdtext_chars(), '"', '\\', '\\' );
+			accumulator.append( text.data(), text.size() );
+
 			const auto ch = from.getch();
 			if( ch.m_eof )
 			{
@@ -606,8 +634,6 @@ class quoted_string_producer_t : public producer_tag< std::string >
 					break;
 				}
 			}
-			else if( is_qdtext( ch.m_ch ) )
-				accumulator += ch.m_ch;
 			else
 			{
 				reason = error_reason_t::unexpected_character;
@@ -737,6 +763,30 @@ quoted-pair    = "\" ( HTAB / SP / VCHAR / obs-text )
  */
 class comment_producer_t : public producer_tag< std::string >
 {
+	//! A producer for a non-empty run of ctext.
+	/*!
+	 * @since v.0.6.9
+	 */
+	class ctext_run_producer_t : public producer_tag< string_view_t >
+	{
+	public :
+		RESTINIO_NODISCARD
+		expected_t< result_type, parse_error_t >
+		try_parse( source_t & from ) const noexcept
+		{
+			const auto text = from.consume_text_while(
+					ctext_chars(), '(', ')', '\\' );
+			if( text.empty() )
+				return make_unexpected( parse_error_t{
+						from.current_position(),
+						from.eof() ? error_reason_t::unexpected_eof :
+								error_reason_t::unexpected_character
+				} );
+
+			return text;
+		}
+	};
+
 public :
 	RESTINIO_NODISCARD
 	expected_t< result_type, parse_error_t >
@@ -1009,7 +1059,10 @@ comment_producer_t::try_parse( source_t & from ) const
 				symbol('('),
 				repeat(0, N,
 					alternatives(
-						ctext_symbol_p() >> to_container(),
+						ctext_run_producer_t{} >> custom_consumer(
+							[]( std::string & dest, string_view_t && what ) {
+								dest.append( what.data(), what.size() );
+							} ),
 						quoted_pair_p() >> to_container(),
 						comment_p() >> custom_consumer(
 							[]( std::string & dest, std::string && what ) {
@@ -23,7 +23,9 @@
 #include <restinio/impl/string_caseless_compare.hpp>
 
 #include <restinio/utils/metaprogramming.hpp>
+#include <restinio/utils/impl/substring_finder.hpp>
 
+#include <cstring>
 #include <iostream>
 
 namespace restinio
@@ -73,51 +75,59 @@ split_multipart_body(
 	string_view_t body,
 	string_view_t boundary )
 {
-	using namespace restinio::string_algo;
-
 	std::vector< string_view_t > result;
 	std::vector< string_view_t > tmp_result;
 
-	const string_view_t eol{ "\r\n" };
-	const string_view_t last_separator{ "--\r\n" };
+	// The same boundary is searched for every part.
+	// Since v.0.6.9 a finder with precomputed state is used for that.
+	const restinio::utils::impl::substring_finder_t boundary_finder{ boundary };
+
+	const auto starts_with_eol = []( string_view_t what ) noexcept {
+			return what.size() >= 2u && '\r' == what[ 0 ] && '\n' == what[ 1 ];
+		};
+	const auto preceded_by_eol = [&body]( const char * pos ) noexcept {
+			return pos - body.data() >= 2 && '\r' == pos[ -2 ] && '\n' == pos[ -1 ];
+		};
+	const auto is_last_separator = []( string_view_t what ) noexcept {
+			return what.size() >= 4u &&
+					0 == std::memcmp( what.data(), "--\r\n", 4u );
+		};
 
 	// Find the first boundary.
-	auto boundary_pos = body.find( boundary );
+	auto boundary_pos = boundary_finder.find( body );
 	if( string_view_t::npos == boundary_pos )
 		// There is no initial separator in the body.
 		return result;
 
 	// The first body can be at the very begining of the body or
 	// there should be CRLF before the initial boundary.
-	if( boundary_pos != 0u &&
-			(boundary_pos < eol.size() ||
-			body.substr( boundary_pos - eol.size(), eol.size() ) != eol) )
+	if( boundary_pos != 0u && !preceded_by_eol( body.data() + boundary_pos ) )
 		return result;
 
 	auto remaining_body = body.substr( boundary_pos + boundary.size() );
-	if( starts_with( remaining_body, last_separator ) )
+	if( is_last_separator( remaining_body ) )
 		// The start boundary is the last boundary.
 		return result;
 
-	while( starts_with( remaining_body, eol ) )
+	while( starts_with_eol( remaining_body ) )
 	{
-		remaining_body = remaining_body.substr( eol.size() );
+		remaining_body = remaining_body.substr( 2u );
 
-		boundary_pos = remaining_body.find( boundary );
+		boundary_pos = boundary_finder.find( remaining_body );
 		if( string_view_t::npos == boundary_pos )
 			return result;
 
 		// There should be CRLF before the next boundary.
-		if( boundary_pos < eol.size() ||
-				remaining_body.substr( boundary_pos - eol.size(), eol.size() ) != eol )
+		if( boundary_pos < 2u ||
+				!preceded_by_eol( remaining_body.data() + boundary_pos ) )
 			return result;
 
 		tmp_result.push_back(
-				remaining_body.substr( 0u, boundary_pos - eol.size() ) );
+				remaining_body.substr( 0u, boundary_pos - 2u ) );
 
 		remaining_body = remaining_body.substr( boundary_pos + boundary.size() );
 		// Is this boundary the last one?
-		if( starts_with( remaining_body, last_separator ) )
+		if( is_last_separator( remaining_body ) )
 		{
 			// Yes, our iteration can be stopped and we can return the result.
 			swap( tmp_result, result );
@@ -489,12 +499,16 @@ check_boundary_value( string_view_t value )
  * The returned value (if there is no error) can be used for spliting
  * a multipart body to separate parts.
  *
- * @since v.0.6.1
+ * @note
+ * This version accepts only request's header, so it can be used
+ * before the body is received (for example in a body sink factory).
+ *
+ * @since v.0.6.9
  */
 RESTINIO_NODISCARD
 inline expected_t< std::string, enumeration_error_t >
 detect_boundary_for_multipart_body(
-	const request_t & req,
+	const http_request_header_t & header,
 	string_view_t expected_media_type,
 	optional_t< string_view_t > expected_media_subtype )
 {
@@ -502,7 +516,7 @@ detect_boundary_for_multipart_body(
 	using restinio::impl::is_equal_caseless;
 
 	// Content-Type header file should be present.
-	const auto content_type = req.header().opt_value_of(
+	const auto content_type = header.opt_value_of(
 			restinio::http_field::content_type );
 	if( !content_type )
 		return make_unexpected(
@@ -551,6 +565,28 @@ detect_boundary_for_multipart_body(
 	return std::move(actual_boundary_mark);
 }
 
+/*!
+ * @brief Helper function for parsing Content-Type field and extracting
+ * the value of 'boundary' parameter.
+ *
+ * It is a shorthand for a version of detect_boundary_for_multipart_body()
+ * that accepts request's header.
+ *
+ * @since v.0.6.1
+ */
+RESTINIO_NODISCARD
+inline expected_t< std::string, enumeration_error_t >
+detect_boundary_for_multipart_body(
+	const request_t & req,
+	string_view_t expected_media_type,
+	optional_t< string_view_t > expected_media_subtype )
+{
+	return detect_boundary_for_multipart_body(
+			req.header(),
+			expected_media_type,
+			expected_media_subtype );
+}
+
 namespace impl
 {
 
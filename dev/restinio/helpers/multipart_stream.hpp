@@ -0,0 +1,727 @@
+/*
+ * RESTinio
+ */
+
+/*!
+ * @file
+ * @brief Incremental parser of multipart bodies.
+ *
+ * @since v.0.6.9
+ */
+
+#pragma once
+
+#include <restinio/helpers/multipart_body.hpp>
+
+#include <restinio/utils/impl/substring_finder.hpp>
+
+#include <restinio/incoming_body.hpp>
+#include <restinio/sendfile.hpp>
+#include <restinio/exception.hpp>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace restinio
+{
+
+namespace multipart_body
+{
+
+//
+// part_sink_t
+//
+/*!
+ * @brief An interface of a receiver of the body of one part.
+ *
+ * An instance of part_sink_t is created by a user-provided handler
+ * of part headers and receives the body of the part piece by piece.
+ *
+ * @attention
+ * A piece passed to on_data() is valid only until on_data() returns.
+ *
+ * @since v.0.6.9
+ */
+class part_sink_t
+{
+public:
+	virtual ~part_sink_t() = default;
+
+	//! Handle the next piece of the part's body.
+	virtual void
+	on_data( string_view_t data ) = 0;
+
+	//! The whole body of the part has been received.
+	virtual void
+	on_complete() = 0;
+
+	//! The body of the part won't be completed.
+	/*!
+	 * Is called if the multipart body is broken or is interrupted
+	 * before the end of the part.
+	 */
+	virtual void
+	on_interrupted() noexcept {}
+};
+
+//! An alias for unique pointer to a part sink.
+using part_sink_handle_t = std::unique_ptr< part_sink_t >;
+
+//
+// callback_part_sink_t
+//
+/*!
+ * @brief A part sink that passes the body to user-provided callbacks.
+ *
+ * @since v.0.6.9
+ */
+class callback_part_sink_t final : public part_sink_t
+{
+public:
+	using data_callback_t = std::function< void( string_view_t ) >;
+	using complete_callback_t = std::function< void() >;
+
+	callback_part_sink_t(
+		//! Callback for every piece of the body.
+		data_callback_t on_data,
+		//! Callback to be called at the end of the body.
+		//! Can be empty.
+		complete_callback_t on_complete = complete_callback_t{} )
+		:	m_on_data{ std::move( on_data ) }
+		,	m_on_complete{ std::move( on_complete ) }
+	{}
+
+	void
+	on_data( string_view_t data ) override
+	{
+		m_on_data( data );
+	}
+
+	void
+	on_complete() override
+	{
+		if( m_on_complete )
+			m_on_complete();
+	}
+
+private:
+	data_callback_t m_on_data;
+	complete_callback_t m_on_complete;
+};
+
+//
+// file_part_sink_t
+//
+/*!
+ * @brief A part sink that writes the body to a file.
+ *
+ * The file should be opened for writing by a user.
+ *
+ * @attention
+ * The data is written by blocking write_file() calls. When the sink
+ * is used with body_sink_t those calls are made on the io thread of
+ * the connection, so other connections served by that thread wait
+ * while the data is being written. This sink is intended for servers
+ * running on a thread pool (and for fast local storage). If writes can
+ * be slow then a custom sink should pass the data to a worker thread
+ * and use incoming_body::pause_reading() and incoming_body::resumer_t
+ * to limit the amount of data in flight.
+ *
+ * @since v.0.6.9
+ */
+class file_part_sink_t final : public part_sink_t
+{
+public:
+	file_part_sink_t(
+		//! Descriptor of a file opened for writing.
+		file_descriptor_t fd,
+		//! Should the file be closed by the sink?
+		bool close_on_destroy = true ) noexcept
+		:	m_fd{ fd }
+		,	m_close_on_destroy{ close_on_destroy }
+	{}
+
+	file_part_sink_t( const file_part_sink_t & ) = delete;
+	file_part_sink_t & operator=( const file_part_sink_t & ) = delete;
+
+	~file_part_sink_t() override
+	{
+		if( m_close_on_destroy && null_file_descriptor() != m_fd )
+			close_file( m_fd );
+	}
+
+	void
+	on_data( string_view_t data ) override
+	{
+		write_file( m_fd, data.data(), data.size() );
+	}
+
+	void
+	on_complete() override {}
+
+private:
+	file_descriptor_t m_fd;
+	const bool m_close_on_destroy;
+};
+
+//
+// stream_parser_t
+//
+/*!
+ * @brief An incremental parser of a multipart body.
+ *
+ * Unlike split_multipart_body() the stream parser doesn't require
+ * the whole body. The body is passed to consume() in pieces of any
+ * size. The headers of every part are parsed into parsed_part_t
+ * (with an empty `body`) and are passed to a user-provided handler.
+ * The handler returns a sink for the body of that part (or nullptr
+ * if the body of the part should be skipped). The body is passed to
+ * the sink as soon as it is found in the input, so the memory used by
+ * the parser doesn't depend on the size of the multipart body.
+ * Only part headers (limited by @a max_part_header_size) and a tail
+ * that can be the beginning of a boundary are kept between calls
+ * to consume().
+ *
+ * Usage example:
+ * @code
+ * using namespace restinio::multipart_body;
+ *
+ * stream_parser_t parser{ boundary,
+ * 	[]( parsed_part_t part ) -> part_sink_handle_t {
+ * 		... // Analyze part.fields.
+ * 		return std::make_unique< file_part_sink_t >( open_file_to_write(...) );
+ * 	} };
+ *
+ * while( ... ) // There is some data.
+ * 	parser.consume( next_piece );
+ *
+ * const auto result = parser.finish();
+ * if( result ) {
+ * 	... // *result parts are handled.
+ * }
+ * @endcode
+ *
+ * @note
+ * An exception thrown from the handler or from a sink is passed
+ * to the caller of consume(). Before that the parser is interrupted
+ * (see interrupt()), so the current sink is informed and failed()
+ * returns true.
+ *
+ * @since v.0.6.9
+ */
+class stream_parser_t
+{
+public:
+	//! Type of handler for headers of a part.
+	/*!
+	 * The handler receives a part with an empty body.
+	 */
+	using part_handler_t = std::function< part_sink_handle_t( parsed_part_t ) >;
+
+	//! The default limit for the size of headers of one part.
+	static constexpr std::size_t default_max_part_header_size = 16u * 1024u;
+
+	stream_parser_t(
+		//! The boundary with two leading hyphens (like a value returned
+		//! by detect_boundary_for_multipart_body()).
+		string_view_t boundary,
+		//! The handler for headers of parts.
+		part_handler_t part_handler,
+		//! The max size of headers of one part.
+		std::size_t max_part_header_size = default_max_part_header_size )
+		:	m_delimiter_finder{ make_delimiter( boundary ) }
+		,	m_part_handler{ std::move( part_handler ) }
+		,	m_max_part_header_size{ max_part_header_size }
+	{
+		// The first boundary can be at the very beginning of the body.
+		// It's handled as if the body starts with CRLF.
+		m_buffer.reserve( 2u * m_delimiter_finder.pattern().size() );
+		m_buffer.assign( "\r\n" );
+	}
+
+	stream_parser_t( const stream_parser_t & ) = delete;
+	stream_parser_t & operator=( const stream_parser_t & ) = delete;
+
+	//! Handle the next piece of the body.
+	void
+	consume( string_view_t data )
+	{
+		try
+		{
+			do_consume( data );
+		}
+		catch( ... )
+		{
+			interrupt();
+			throw;
+		}
+	}
+
+	//! Finish the parsing at the end of the body.
+	/*!
+	 * @return the count of parts those bodies are completely
+	 * received (including the parts skipped by the handler)
+	 * or an error code if the body is broken or incomplete.
+	 */
+	RESTINIO_NODISCARD
+	expected_t< std::size_t, enumeration_error_t >
+	finish()
+	{
+		if( state_t::epilogue != m_state )
+		{
+			interrupt();
+			return make_unexpected( enumeration_error_t::unexpected_error );
+		}
+
+		if( 0u == m_parts_completed )
+			return make_unexpected( enumeration_error_t::no_parts_found );
+
+		return m_parts_completed;
+	}
+
+	//! Stop the parsing without waiting for the end of the body.
+	/*!
+	 * The sink of the current part (if any) is informed that
+	 * the part won't be completed.
+	 */
+	void
+	interrupt() noexcept
+	{
+		if( m_current_sink )
+		{
+			m_current_sink->on_interrupted();
+			m_current_sink.reset();
+		}
+
+		if( state_t::epilogue != m_state )
+			m_state = state_t::failed;
+	}
+
+	//! Has the last boundary been found?
+	bool
+	completed() const noexcept { return state_t::epilogue == m_state; }
+
+	//! Has an error been detected in the body?
+	bool
+	failed() const noexcept { return state_t::failed == m_state; }
+
+	//! The count of parts those bodies are completely received.
+	std::size_t
+	parts_completed() const noexcept { return m_parts_completed; }
+
+private:
+	enum class state_t
+	{
+		//! Skipping data until the first boundary.
+		preamble,
+		//! Boundary is found, CRLF or "--" is expected.
+		after_boundary,
+		//! Reading headers of a part.
+		part_headers,
+		//! Reading the body of a part.
+		part_body,
+		//! The last boundary is found.
+		epilogue,
+		//! The body is broken.
+		failed
+	};
+
+	//! Dispatch the data to handlers of the current state.
+	void
+	do_consume( string_view_t data )
+	{
+		while( !data.empty() && state_t::failed != m_state )
+		{
+			switch( m_state )
+			{
+				case state_t::preamble:
+				case state_t::part_body:
+					consume_body( data );
+				break;
+
+				case state_t::after_boundary:
+					consume_after_boundary( data );
+				break;
+
+				case state_t::part_headers:
+					consume_part_headers( data );
+				break;
+
+				case state_t::epilogue:
+					// Everything after the last boundary is ignored.
+					data = string_view_t{};
+				break;
+
+				case state_t::failed:
+				break;
+			}
+		}
+	}
+
+	//! Make the delimiter: CRLF and the boundary.
+	static std::string
+	make_delimiter( string_view_t boundary )
+	{
+		if( boundary.empty() )
+			throw exception_t{ "boundary for multipart body can't be empty" };
+
+		std::string delimiter;
+		delimiter.reserve( boundary.size() + 2u );
+		delimiter.append( "\r\n" );
+		delimiter.append( boundary.data(), boundary.size() );
+
+		return delimiter;
+	}
+
+	//! Find the start of a suffix of @a s that is a proper prefix
+	//! of the delimiter.
+	/*!
+	 * Returns s.size() if there is no such suffix.
+	 */
+	std::size_t
+	partial_delimiter_pos( string_view_t s ) const noexcept
+	{
+		const string_view_t delimiter = m_delimiter_finder.pattern();
+		const std::size_t tail = delimiter.size() - 1u;
+		std::size_t pos = s.size() > tail ? s.size() - tail : 0u;
+
+		for( ; pos < s.size(); ++pos )
+		{
+			if( delimiter[ 0 ] == s[ pos ] &&
+				0 == s.compare( pos, string_view_t::npos,
+						delimiter.data(), s.size() - pos ) )
+				break;
+		}
+
+		return pos;
+	}
+
+	//! Pass a piece of the current part's body to its sink.
+	void
+	emit_body_data( string_view_t data )
+	{
+		if( m_current_sink && !data.empty() )
+			m_current_sink->on_data( data );
+	}
+
+	//! Handle a boundary found after the preamble or a part's body.
+	void
+	on_delimiter_found()
+	{
+		if( state_t::part_body == m_state )
+		{
+			if( m_current_sink )
+			{
+				auto sink = std::move( m_current_sink );
+				sink->on_complete();
+			}
+
+			++m_parts_completed;
+		}
+
+		m_buffer.clear();
+		m_state = state_t::after_boundary;
+	}
+
+	//! Handle data of the preamble or of a part's body.
+	void
+	consume_body( string_view_t & data )
+	{
+		const string_view_t delimiter = m_delimiter_finder.pattern();
+
+		if( !m_buffer.empty() )
+		{
+			// There is a tail of the previous data that can be
+			// the beginning of the delimiter.
+			const auto carried = m_buffer.size();
+			const auto appended = std::min( data.size(), delimiter.size() - 1u );
+			m_buffer.append( data.data(), appended );
+
+			const string_view_t window{ m_buffer };
+			const auto pos = m_delimiter_finder.find( window );
+			if( string_view_t::npos != pos )
+			{
+				emit_body_data( window.substr( 0u, pos ) );
+				data.remove_prefix( pos + delimiter.size() - carried );
+				on_delimiter_found();
+				return;
+			}
+
+			if( appended == data.size() &&
+				appended < delimiter.size() - 1u )
+			{
+				// All the data is in the buffer, but the delimiter
+				// can still start there.
+				const auto partial_pos = partial_delimiter_pos( window );
+				emit_body_data( window.substr( 0u, partial_pos ) );
+				m_buffer.erase( 0u, partial_pos );
+				data = string_view_t{};
+				return;
+			}
+
+			// The delimiter can't start in the carried tail.
+			emit_body_data( window.substr( 0u, carried ) );
+			m_buffer.clear();
+		}
+
+		const auto pos = m_delimiter_finder.find( data );
+		if( string_view_t::npos != pos )
+		{
+			emit_body_data( data.substr( 0u, pos ) );
+			data.remove_prefix( pos + delimiter.size() );
+			on_delimiter_found();
+		}
+		else
+		{
+			const auto partial_pos = partial_delimiter_pos( data );
+			emit_body_data( data.substr( 0u, partial_pos ) );
+			m_buffer.assign( data.data() + partial_pos, data.size() - partial_pos );
+			data = string_view_t{};
+		}
+	}
+
+	//! Handle data just after a boundary.
+	void
+	consume_after_boundary( string_view_t & data )
+	{
+		const auto appended = std::min( data.size(), 2u - m_buffer.size() );
+		m_buffer.append( data.data(), appended );
+		data.remove_prefix( appended );
+
+		if( 2u == m_buffer.size() )
+		{
+			if( "\r\n" == m_buffer )
+				m_state = state_t::part_headers;
+			else if( "--" == m_buffer )
+				m_state = state_t::epilogue;
+			else
+				m_state = state_t::failed;
+
+			m_buffer.clear();
+		}
+	}
+
+	//! Handle data of part's headers.
+	void
+	consume_part_headers( string_view_t & data )
+	{
+		const string_view_t eol{ "\r\n" };
+		const string_view_t headers_end{ "\r\n\r\n" };
+
+		const auto old_size = m_buffer.size();
+		// One extra byte is allowed to detect too long headers.
+		const auto appended = std::min(
+				data.size(),
+				m_max_part_header_size + headers_end.size() + 1u - old_size );
+		m_buffer.append( data.data(), appended );
+
+		const string_view_t headers{ m_buffer };
+		std::size_t headers_size = string_view_t::npos;
+		if( string_algo::starts_with( headers, eol ) )
+			// There are no fields in that part.
+			headers_size = eol.size();
+		else
+		{
+			const auto pos = headers.find(
+					headers_end,
+					old_size > 3u ? old_size - 3u : 0u );
+			if( string_view_t::npos != pos )
+				headers_size = pos + headers_end.size();
+		}
+
+		if( string_view_t::npos == headers_size )
+		{
+			if( m_buffer.size() > m_max_part_header_size + headers_end.size() )
+				m_state = state_t::failed;
+
+			data.remove_prefix( appended );
+			return;
+		}
+
+		data.remove_prefix( headers_size - old_size );
+
+		auto parsed_part = try_parse_part( headers.substr( 0u, headers_size ) );
+		m_buffer.clear();
+
+		if( !parsed_part )
+		{
+			m_state = state_t::failed;
+			return;
+		}
+
+		m_state = state_t::part_body;
+		m_current_sink = m_part_handler( std::move( *parsed_part ) );
+	}
+
+	//! Finder for the delimiter: CRLF and the boundary.
+	utils::impl::substring_finder_t m_delimiter_finder;
+
+	//! Handler for headers of parts.
+	part_handler_t m_part_handler;
+
+	//! Limit for the size of part's headers.
+	const std::size_t m_max_part_header_size;
+
+	//! Data kept between calls to consume().
+	std::string m_buffer;
+
+	state_t m_state{ state_t::preamble };
+
+	//! Sink for the body of the current part.
+	part_sink_handle_t m_current_sink;
+
+	std::size_t m_parts_completed{ 0u };
+};
+
+//
+// body_sink_t
+//
+/*!
+ * @brief A sink for the incoming request body that parses the body
+ * as a multipart body.
+ *
+ * This sink allows to handle a multipart body without holding the whole
+ * body in memory. It can be created by body sink factory (see
+ * incoming_body::sink_t) with help of make_body_sink() function.
+ * The result of the parsing is available via result() method when
+ * the request handler is called.
+ *
+ * If a part handler or a part sink throws then the exception is
+ * stored (see error()) and is passed to the connection. The connection
+ * stops reading of the request and is closed, so the request handler
+ * isn't called. The parser is not fed after the first failure.
+ *
+ * @since v.0.6.9
+ */
+class body_sink_t final : public incoming_body::sink_t
+{
+public:
+	body_sink_t(
+		string_view_t boundary,
+		stream_parser_t::part_handler_t part_handler,
+		std::size_t max_part_header_size =
+				stream_parser_t::default_max_part_header_size )
+		:	m_parser{ boundary, std::move( part_handler ), max_part_header_size }
+	{}
+
+	incoming_body::chunk_handling_result_t
+	on_chunk( string_view_t chunk ) override
+	{
+		if( m_error )
+			std::rethrow_exception( m_error );
+
+		try
+		{
+			m_parser.consume( chunk );
+		}
+		catch( ... )
+		{
+			m_error = std::current_exception();
+			throw;
+		}
+
+		return incoming_body::continue_reading();
+	}
+
+	void
+	on_complete() override
+	{
+		m_result = m_parser.finish();
+	}
+
+	void
+	on_interrupted() noexcept override
+	{
+		m_parser.interrupt();
+	}
+
+	//! Get the result of parsing.
+	/*!
+	 * Returns enumeration_error_t::unexpected_error if the body
+	 * isn't completely received.
+	 */
+	const expected_t< std::size_t, enumeration_error_t > &
+	result() const noexcept
+	{
+		return m_result;
+	}
+
+	//! Get the exception thrown by a part handler or a part sink.
+	/*!
+	 * Returns nullptr if there was no exception.
+	 */
+	std::exception_ptr
+	error() const noexcept
+	{
+		return m_error;
+	}
+
+private:
+	stream_parser_t m_parser;
+
+	//! The first exception thrown during the parsing.
+	std::exception_ptr m_error;
+
+	expected_t< std::size_t, enumeration_error_t > m_result{
+		make_unexpected( enumeration_error_t::unexpected_error ) };
+};
+
+//
+// make_body_sink
+//
+/*!
+ * @brief A helper function for creation of body_sink_t for a request.
+ *
+ * Detects the boundary from Content-Type field of @a header.
+ *
+ * Usage example:
+ * @code
+ * struct sink_factory_t
+ * {
+ * 	restinio::incoming_body::sink_handle_t
+ * 	make_sink(
+ * 		const restinio::http_request_header_t & header,
+ * 		restinio::incoming_body::resumer_t )
+ * 	{
+ * 		using namespace restinio::multipart_body;
+ * 		auto sink = make_body_sink( header,
+ * 			[]( parsed_part_t part ) -> part_sink_handle_t {...},
+ * 			"multipart", "form-data" );
+ * 		// Body of a request without proper Content-Type will be
+ * 		// accumulated as usual.
+ * 		return sink ? *sink : nullptr;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline expected_t< std::shared_ptr< body_sink_t >, enumeration_error_t >
+make_body_sink(
+	//! Header of a request.
+	const http_request_header_t & header,
+	//! Handler for headers of parts.
+	stream_parser_t::part_handler_t part_handler,
+	//! The expected value of 'type' part of 'media-type' from Content-Type.
+	string_view_t expected_media_type = string_view_t{ "multipart" },
+	//! The optional expected value of 'subtype' part of 'media-type'
+	//! from Content-Type.
+	optional_t< string_view_t > expected_media_subtype = nullopt )
+{
+	const auto boundary = detect_boundary_for_multipart_body(
+			header,
+			expected_media_type,
+			expected_media_subtype );
+	if( !boundary )
+		return make_unexpected( boundary.error() );
+
+	return std::make_shared< body_sink_t >(
+			*boundary, std::move( part_handler ) );
+}
+
+} /* namespace multipart_body */
+
+} /* namespace restinio */
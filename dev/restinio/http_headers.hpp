@@ -16,13 +16,20 @@
 #include <restinio/string_view.hpp>
 #include <restinio/optional.hpp>
 #include <restinio/common_types.hpp>
+#include <restinio/compiler_features.hpp>
 
 #include <http_parser.h>
 
 #include <iosfwd>
 #include <string>
+#include <array>
 #include <vector>
+#include <memory>
+#include <mutex>
+#include <limits>
 #include <algorithm>
+#include <iterator>
+#include <utility>
 
 namespace restinio
 {
@@ -241,307 +248,205 @@ enum class http_field_t : std::uint8_t //By now 152 + 34 + 1 items fits to uint8
 //! Helper alies to omitt `_t` suffix.
 using http_field = http_field_t;
 
+namespace impl
+{
+
 //
-// string_to_field()
+// http_field_perfect_hash_t
 //
-
-//! Helper function to get method string name.
-//! \{
-inline http_field_t
-string_to_field( string_view_t field ) noexcept
+/*!
+ * @brief Perfect hash table for detection of http_field_t by field name.
+ *
+ * The table is built once (at the first use) from RESTINIO_HTTP_FIELDS_MAP
+ * by hash-and-displace method: fields are split into buckets by the hash
+ * of the name and for every bucket a displacement is selected in such
+ * a way that all fields from the bucket fall into free slots of the table.
+ * Because of that the detection of a field requires just one calculation
+ * of the hash and one comparison of names.
+ *
+ * @since v.0.6.9
+ */
+class http_field_perfect_hash_t
 {
-	const char * field_name = field.data();
-	const std::size_t field_name_size = field.size();
+	public:
+		//! Get the table.
+		static const http_field_perfect_hash_t &
+		instance() noexcept
+		{
+			static const http_field_perfect_hash_t table;
+			return table;
+		}
 
-#define RESTINIO_HTTP_CHECK_FOR_FIELD( field_id, candidate_field_name ) \
-	if( impl::is_equal_caseless(field_name, #candidate_field_name , field_name_size ) ) \
-		return http_field_t:: field_id;
+		//! Find a field by name.
+		http_field_t
+		find( string_view_t name ) const noexcept
+		{
+			if( name.size() < min_name_size )
+				return http_field_t::field_unspecified;
 
-	// TODO: make most popular fields to be checked first.
+			const auto h = hash( name );
+			const auto candidate = m_slots[
+					slot( h, m_displacements[ bucket( h ) ] ) ];
 
-	switch( field_name_size )
-	{
-		case 2:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_,                          If )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( im,                           IM )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( te,                           TE )
-			break;
-
-		case 3:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( age,                          Age )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( dav,                          DAV )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ext,                          Ext )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( man,                          Man )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( opt,                          Opt )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( p3p,                          P3P )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pep,                          PEP )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( tcn,                          TCN )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ttl,                          TTL )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( uri,                          URI )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( via,                          Via )
-			break;
-
-		case 4:
-			// Known to be more used first:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( host,                         Host )
-
-			RESTINIO_HTTP_CHECK_FOR_FIELD( a_im,                         A-IM )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alpn,                         ALPN )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( dasl,                         DASL )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( date,                         Date )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( etag,                         ETag )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( from,                         From )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( link,                         Link )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( safe,                         Safe )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( slug,                         SLUG )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( vary,                         Vary )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cost,                         Cost )
-			break;
-
-		case 5:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( allow,                        Allow )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_ext,                        C-Ext )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_man,                        C-Man )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_opt,                        C-Opt )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_pep,                        C-PEP )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( close,                        Close )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( depth,                        Depth )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( label,                        Label )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( meter,                        Meter )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( range,                        Range )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( topic,                        Topic )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( subok,                        SubOK )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( subst,                        Subst )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( title,                        Title )
-			break;
-
-		case 6:
-			// Known to be more used first:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept,                       Accept )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cookie,                       Cookie )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( server,                       Server )
-
-			RESTINIO_HTTP_CHECK_FOR_FIELD( digest,                       Digest )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( expect,                       Expect )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( origin,                       Origin )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pragma,                       Pragma )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( prefer,                       Prefer )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( public_,                      Public )
-			break;
-
-		case 7:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alt_svc,                      Alt-Svc )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cookie2,                      Cookie2 )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( expires,                      Expires )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( hobareg,                      Hobareg )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( referer,                      Referer )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( timeout,                      Timeout )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( trailer,                      Trailer )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( urgency,                      Urgency )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( upgrade,                      Upgrade )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( warning,                      Warning )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( version,                      Version )
-			break;
-
-		case 8:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alt_used,                     Alt-Used )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_match,                     If-Match )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_range,                     If-Range )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( location,                     Location )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pep_info,                     Pep-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( position,                     Position )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol,                     Protocol )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( optional,                     Optional )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_color,                     UA-Color )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_media,                     UA-Media )
-			break;
-
-		case 9:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( forwarded,                    Forwarded )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( negotiate,                    Negotiate )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( overwrite,                    Overwrite )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_pixels,                    UA-Pixels )
-			break;
-
-		case 10:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alternates,                   Alternates )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_pep_info,                   C-PEP-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_id,                   Content-ID )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( delta_base,                   Delta-Base )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( getprofile,                   GetProfile )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( keep_alive,                   Keep-Alive )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( lock_token,                   Lock-Token )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pics_label,                   PICS-Label )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( set_cookie,                   Set-Cookie )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( setprofile,                   SetProfile )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( soapaction,                   SoapAction )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( status_uri,                   Status-URI )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( user_agent,                   User-Agent )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( compliance,                   Compliance )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( message_id,                   Message-ID )
-			break;
-
-		case 11:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_post,                  Accept-Post )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_md5,                  Content-MD5 )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( destination,                  Destination )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( retry_after,                  Retry-After )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( set_cookie2,                  Set-Cookie2 )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( want_digest,                  Want-Digest )
-			break;
-
-		case 12:
-			// Known to be more used first:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_type,                 Content-Type )
-
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_patch,                 Accept-Patch )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_base,                 Content-Base )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( derived_from,                 Derived-From )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( max_forwards,                 Max-Forwards )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( mime_version,                 MIME-Version )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( schedule_tag,                 Schedule-Tag )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( redirect_ref,                 Redirect-Ref )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( variant_vary,                 Variant-Vary )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( method_check,                 Method-Check )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( referer_root,                 Referer-Root )
-			break;
-
-		case 13:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_ranges,                Accept-Ranges )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( authorization,                Authorization )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cache_control,                Cache-Control )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_range,                Content-Range )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( default_style,                Default-Style )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_none_match,                If-None-Match )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( last_modified,                Last-Modified )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ordering_type,                Ordering-Type )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( profileobject,                ProfileObject )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol_info,                Protocol-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_resolution,                UA-Resolution )
-			break;
-
-		case 14:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_charset,               Accept-Charset )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( http2_settings,               HTTP2-Settings )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol_query,               Protocol-Query )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_features,               Proxy-Features )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( schedule_reply,               Schedule-Reply )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( non_compliance,               Non-Compliance )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control,               Access-Control )
-			break;
-
-		case 15:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_encoding,              Accept-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_features,              Accept-Features )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_language,              Accept-Language )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_datetime,              Accept-Datetime )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_version,              Content-Version )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( differential_id,              Differential-ID )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( public_key_pins,              Public-Key-Pins )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( security_scheme,              Security-Scheme )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_frame_options,              X-Frame-Options )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept,              X-Device-Accept )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( resolution_hint,              Resolution-Hint )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ediint_features,              EDIINT-Features )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_windowpixels,              UA-Windowpixels )
-			break;
-
-		case 16:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_additions,             Accept-Additions )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( caldav_timezones,             CalDAV-Timezones )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_encoding,             Content-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_language,             Content-Language )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_location,             Content-Location )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( memento_datetime,             Memento-Datetime )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol_request,             Protocol-Request )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( www_authenticate,             WWW-Authenticate )
-			break;
-
-		case 17:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_modified_since,            If-Modified-Since )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_instruction,            Proxy-Instruction )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_key,            Sec-WebSocket-Key )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( surrogate_control,            Surrogate-Control )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( transfer_encoding,            Transfer-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( resolver_location,            Resolver-Location )
-			break;
-
-		case 18:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_style_type,           Content-Style-Type )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( preference_applied,           Preference-Applied )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_authenticate,           Proxy-Authenticate )
-			break;
-
-		case 19:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( authentication_info,          Authentication-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_disposition,          Content-Disposition )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_script_type,          Content-Script-Type )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_unmodified_since,          If-Unmodified-Since )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_authorization,          Proxy-Authorization )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_user_agent,          X-Device-User-Agent )
-			break;
-
-		case 20:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_accept,         Sec-WebSocket-Accept )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( surrogate_capability,         Surrogate-Capability )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( method_check_expires,         Method-Check-Expires )
-			break;
-
-		case 21:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( apply_to_redirect_ref,        Apply-To-Redirect-Ref )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_schedule_tag_match,        If-Schedule-Tag-Match )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_version,        Sec-WebSocket-Version )
-			break;
-
-		case 22:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( authentication_control,       Authentication-Control )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_protocol,       Sec-WebSocket-Protocol )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_max_age,       Access-Control-Max-Age )
-			break;
-
-		case 23:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept_charset,      X-Device-Accept-Charset )
-			break;
-
-		case 24:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_extensions,     Sec-WebSocket-Extensions )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept_encoding,     X-Device-Accept-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept_language,     X-Device-Accept-Language )
-			break;
-
-		case 25:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( optional_www_authenticate,    Optional-WWW-Authenticate )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_authentication_info,    Proxy-Authentication-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( strict_transport_security,    Strict-Transport-Security )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_transfer_encoding,    Content-Transfer-Encoding )
-			break;
-
-		case 27:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( public_key_pins_report_only,  Public-Key-Pins-Report-Only )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_origin,  Access-Control-Allow-Origin )
-			break;
-
-		case 28:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_headers, Access-Control-Allow-Headers )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_methods, Access-Control-Allow-Methods )
-			break;
-
-		case 29:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_request_method,    Access-Control-Request-Method )
-			break;
-
-		case 30:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_request_headers,   Access-Control-Request-Headers )
-			break;
-
-		case 32:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_credentials, Access-Control-Allow-Credentials )
-			break;
-	}
+			if( http_field_t::field_unspecified != candidate &&
+				is_equal_caseless(
+						name, m_names[ static_cast< std::size_t >( candidate ) ] ) )
+				return candidate;
+
+			return http_field_t::field_unspecified;
+		}
+
+	private:
+		static constexpr std::size_t known_fields_count =
+				static_cast< std::size_t >( http_field_t::field_unspecified );
+		//! The length of the shortest name of a known field.
+		static constexpr std::size_t min_name_size = 2u;
+		static constexpr std::size_t buckets_count = 64u;
+		static constexpr std::size_t slots_count = 512u;
+
+		//! Displacement for every bucket.
+		std::array< std::uint16_t, buckets_count > m_displacements;
+		//! Fields in slots of the table.
+		std::array< http_field_t, slots_count > m_slots;
+		//! Names of all fields.
+		std::array< string_view_t, known_fields_count > m_names;
+
+		http_field_perfect_hash_t() noexcept
+		{
+			std::size_t index = 0u;
+#define RESTINIO_HTTP_FIELD_NAME_GEN( ignored, string_name ) \
+			m_names[ index++ ] = string_view_t{ #string_name };
 
-#undef RESTINIO_HTTP_CHECK_FOR_FIELD
+			RESTINIO_HTTP_FIELDS_MAP( RESTINIO_HTTP_FIELD_NAME_GEN )
+#undef RESTINIO_HTTP_FIELD_NAME_GEN
 
-	return http_field_t::field_unspecified;
+			m_displacements.fill( 0u );
+			m_slots.fill( http_field_t::field_unspecified );
+
+			std::array< std::uint64_t, known_fields_count > hashes;
+			std::array< std::size_t, buckets_count > bucket_sizes{};
+			for( std::size_t i = 0u; i != known_fields_count; ++i )
+			{
+				hashes[ i ] = hash( m_names[ i ] );
+				++bucket_sizes[ bucket( hashes[ i ] ) ];
+			}
+
+			// Buckets with more fields are placed first.
+			const auto max_size = *std::max_element(
+					bucket_sizes.begin(), bucket_sizes.end() );
+			for( std::size_t size = max_size; size; --size )
+				for( std::size_t b = 0u; b != buckets_count; ++b )
+					if( size == bucket_sizes[ b ] )
+						place_bucket( b, hashes );
+		}
+
+		//! Select the displacement for a bucket and fill slots for it.
+		void
+		place_bucket(
+			std::size_t bucket_index,
+			const std::array< std::uint64_t, known_fields_count > & hashes ) noexcept
+		{
+			std::array< std::size_t, known_fields_count > occupied;
+
+			for( std::uint32_t d = 0u; d != 0x10000u; ++d )
+			{
+				std::size_t occupied_count = 0u;
+				bool success = true;
+
+				for( std::size_t i = 0u; i != known_fields_count; ++i )
+				{
+					if( bucket_index != bucket( hashes[ i ] ) )
+						continue;
+
+					const auto s = slot( hashes[ i ], d );
+					if( http_field_t::field_unspecified != m_slots[ s ] )
+					{
+						success = false;
+						break;
+					}
+
+					m_slots[ s ] = static_cast< http_field_t >( i );
+					occupied[ occupied_count++ ] = s;
+				}
+
+				if( success )
+				{
+					m_displacements[ bucket_index ] = static_cast< std::uint16_t >( d );
+					return;
+				}
+
+				// Rollback.
+				for( std::size_t i = 0u; i != occupied_count; ++i )
+					m_slots[ occupied[ i ] ] = http_field_t::field_unspecified;
+			}
+		}
+
+		//! Caseless hash of a name.
+		/*!
+			Only the length of a name and four characters of it are
+			taken into account: the first one, the last two and the middle
+			one. This combination is unique for all names from
+			RESTINIO_HTTP_FIELDS_MAP, so different known fields always
+			have different hashes.
+
+			Letters are converted to lower case by setting 0x20 bit. It
+			also changes some non-letter characters, but it isn't a problem
+			because the name found in the table is compared with the
+			original one.
+
+			@attention
+			\a name should contain at least 2 characters.
+		*/
+		static std::uint64_t
+		hash( string_view_t name ) noexcept
+		{
+			const auto ch = [&name]( std::size_t i ) noexcept {
+				return static_cast< std::uint64_t >(
+						static_cast< unsigned char >( name[ i ] ) | 0x20u );
+			};
+
+			const std::size_t n = name.size();
+			const std::uint64_t key =
+					( static_cast< std::uint64_t >( n ) << 32 ) |
+					( ch( 0u ) << 24 ) |
+					( ch( n / 2u ) << 16 ) |
+					( ch( n - 2u ) << 8 ) |
+					ch( n - 1u );
+
+			return key * 0x9E3779B97F4A7C15ull;
+		}
+
+		//! Bucket for a hash.
+		static std::size_t
+		bucket( std::uint64_t h ) noexcept
+		{
+			// The highest bits of the hash are used.
+			return static_cast< std::size_t >( h >> 58 );
+		}
+
+		//! Slot for a hash with the displacement.
+		static std::size_t
+		slot( std::uint64_t h, std::uint64_t displacement ) noexcept
+		{
+			return static_cast< std::size_t >(
+					( ( h ^ displacement ) * 0xC2B2AE3D27D4EB4Full ) >> 55 );
+		}
+};
+
+} /* namespace impl */
+
+//
+// string_to_field()
+//
+
+//! Helper function to get method string name.
+/*!
+	Since v.0.6.9 a perfect hash table is used for detection of the field.
+*/
+inline http_field_t
+string_to_field( string_view_t field ) noexcept
+{
+	return impl::http_field_perfect_hash_t::instance().find( field );
 }
 
 //
@@ -602,6 +507,30 @@ class http_header_field_t
 			,	m_field_id{ string_to_field( m_name ) }
 		{}
 
+		//! Initializing constructors for the case when field id is known.
+		/*!
+			@since v.0.6.9
+		*/
+		//! \{
+		http_header_field_t(
+			std::string name,
+			std::string value,
+			http_field_t field_id )
+			:	m_name{ std::move( name ) }
+			,	m_value{ std::move( value ) }
+			,	m_field_id{ field_id }
+		{}
+
+		http_header_field_t(
+			string_view_t name,
+			string_view_t value,
+			http_field_t field_id )
+			:	m_name{ name.data(), name.size() }
+			,	m_value{ value.data(), value.size() }
+			,	m_field_id{ field_id }
+		{}
+		//! \}
+
 		http_header_field_t(
 			http_field_t field_id,
 			std::string value )
@@ -668,6 +597,660 @@ append_last_field_accessor( http_header_fields_t &, string_view_t );
 	#define RESTINIO_HEADER_FIELDS_DEFAULT_RESERVE_COUNT 4
 #endif
 
+//
+// incoming_header_storage
+//
+/*!
+ * @brief Types for selection of the storage for header fields of
+ * incoming requests.
+ *
+ * The storage is selected via `incoming_header_storage_t` typedef
+ * in server traits.
+ *
+ * @since v.0.6.9
+ */
+namespace incoming_header_storage
+{
+
+//! Every header field is stored as a pair of std::string objects.
+/*!
+ * This is the default storage. It requires up to two memory allocations
+ * for every header field (for long names and values that don't fit
+ * into std::string's SSO buffer).
+ */
+struct owning_strings_t {};
+
+//! All header fields of a request are stored in one per-request block.
+/*!
+ * Names and values of fields are copied into a single buffer allocated
+ * once per request. Fields are kept as views into that buffer, so
+ * there are no memory allocations for individual fields.
+ *
+ * Header fields can be accessed without any allocations via
+ * http_header_fields_t::has_field(), http_header_fields_t::value_of(),
+ * http_header_fields_t::opt_value_of() and
+ * http_header_fields_t::for_each_field_view().
+ * Other methods (like get_field() that return references to std::string
+ * or methods that modify fields) convert views into ordinary
+ * http_header_field_t objects on the first call.
+ *
+ * @note
+ * That conversion is performed only once inside the shared storage
+ * of fields and it's thread safe. So const methods of the same header
+ * object can be called from several threads.
+ * Methods that require the conversion aren't `noexcept` because of that.
+ *
+ * Usage example:
+ * @code
+ * struct my_traits : public restinio::default_traits_t {
+ * 	using incoming_header_storage_t =
+ * 		restinio::incoming_header_storage::arena_views_t;
+ * };
+ * @endcode
+ */
+struct arena_views_t {};
+
+} /* namespace incoming_header_storage */
+
+#if !defined( RESTINIO_HEADER_FIELDS_ARENA_DEFAULT_CAPACITY )
+	#define RESTINIO_HEADER_FIELDS_ARENA_DEFAULT_CAPACITY 1024
+#endif
+
+#if !defined( RESTINIO_HEADER_FIELDS_ARENA_DEFAULT_FIELDS_COUNT )
+	#define RESTINIO_HEADER_FIELDS_ARENA_DEFAULT_FIELDS_COUNT 16
+#endif
+
+namespace impl
+{
+
+//
+// known_fields_index_t
+//
+/*!
+ * @brief An index of positions of known fields in a container of fields.
+ *
+ * Holds a position of the first occurrence of every known field
+ * (a field with id other than http_field_t::field_unspecified).
+ * It allows to find a known field without scanning all fields.
+ *
+ * Positions are stored as one byte values. Fields with positions
+ * that don't fit into a byte aren't indexed and should be found by
+ * the ordinary scan.
+ *
+ * @since v.0.6.9
+ */
+class known_fields_index_t
+{
+	public:
+		//! Special value for the case when the field isn't present.
+		static constexpr std::size_t not_found =
+				std::numeric_limits< std::size_t >::max();
+		//! Special value for the case when the field should be
+		//! found by the ordinary scan.
+		static constexpr std::size_t not_indexed = not_found - 1u;
+
+		known_fields_index_t() noexcept
+		{
+			m_positions.fill( std::uint8_t{ absent } );
+		}
+
+		//! Get the position of a field.
+		/*!
+		 * @return not_found if there is no such field, not_indexed if
+		 * the field should be found by the ordinary scan.
+		 */
+		std::size_t
+		find( http_field_t field_id ) const noexcept
+		{
+			const auto v = m_positions[ static_cast< std::size_t >( field_id ) ];
+			if( absent == v )
+				return not_found;
+			else if( unindexed == v )
+				return not_indexed;
+
+			return v;
+		}
+
+		//! Register a new field added to the end of the container.
+		void
+		on_field_added( http_field_t field_id, std::size_t position ) noexcept
+		{
+			if( http_field_t::field_unspecified == field_id )
+				return;
+
+			auto & v = m_positions[ static_cast< std::size_t >( field_id ) ];
+			if( absent == v )
+				v = position < unindexed ?
+						static_cast< std::uint8_t >( position ) : unindexed;
+		}
+
+		//! Rebuild the whole index.
+		/*!
+		 * Should be called when fields are removed from the container.
+		 */
+		template< typename Container >
+		void
+		rebuild( const Container & fields ) noexcept
+		{
+			m_positions.fill( std::uint8_t{ absent } );
+
+			for( std::size_t i = 0u, n = fields.size(); i != n; ++i )
+				on_field_added( fields[ i ].field_id(), i );
+		}
+
+	private:
+		static constexpr std::uint8_t absent = 0xFFu;
+		static constexpr std::uint8_t unindexed = 0xFEu;
+
+		//! Positions of fields. There is also an item for
+		//! http_field_t::field_unspecified, it is always absent.
+		std::array<
+				std::uint8_t,
+				static_cast< std::size_t >( http_field_t::field_unspecified ) + 1u >
+			m_positions;
+};
+
+//
+// find_field
+//
+/*!
+ * @brief Find a field in a container of fields with an index of known fields.
+ *
+ * A known field is found via @a index. Only fields with
+ * unspecified id are scanned for a custom name.
+ *
+ * @since v.0.6.9
+ */
+//! \{
+template< typename Container >
+auto
+find_field(
+	Container & fields,
+	const known_fields_index_t & index,
+	http_field_t field_id ) noexcept -> decltype( fields.begin() )
+{
+	const auto pos = http_field_t::field_unspecified != field_id ?
+			index.find( field_id ) :
+			known_fields_index_t::not_indexed;
+
+	if( known_fields_index_t::not_found == pos )
+		return fields.end();
+	else if( known_fields_index_t::not_indexed == pos )
+		return std::find_if(
+			fields.begin(),
+			fields.end(),
+			[&]( const auto & f ){
+				return f.field_id() == field_id;
+			} );
+
+	return fields.begin() + static_cast< std::ptrdiff_t >( pos );
+}
+
+template< typename Container >
+auto
+find_field(
+	Container & fields,
+	const known_fields_index_t & index,
+	http_field_t field_id,
+	string_view_t field_name ) noexcept -> decltype( fields.begin() )
+{
+	if( http_field_t::field_unspecified != field_id )
+		return find_field( fields, index, field_id );
+
+	return std::find_if(
+		fields.begin(),
+		fields.end(),
+		[&]( const auto & f ){
+			return http_field_t::field_unspecified == f.field_id() &&
+				impl::is_equal_caseless( f.name(), field_name );
+		} );
+}
+//! \}
+
+//
+// header_fields_arena_t
+//
+/*!
+ * @brief A storage for header fields of an incoming request that keeps
+ * all names and values in one buffer.
+ *
+ * Fields are stored as offsets in the buffer, so the buffer can grow
+ * while the header is being parsed.
+ *
+ * Fields are filled by http-parser's callbacks in the following order:
+ * start_name(), append_name() (zero or more times), start_value(),
+ * append_value() (zero or more times).
+ *
+ * When the header is parsed the arena isn't modified anymore.
+ * Fields are converted into http_header_field_t objects only if
+ * they are requested by fields(). The conversion is performed only once
+ * and is thread safe, so const methods of an arena can be called
+ * from several threads at the same time.
+ *
+ * @since v.0.6.9
+ */
+class header_fields_arena_t
+{
+	public:
+		//! Type of container for fields converted to http_header_field_t.
+		using fields_container_t = std::vector< http_header_field_t >;
+
+		header_fields_arena_t()
+		{
+			m_data.reserve( RESTINIO_HEADER_FIELDS_ARENA_DEFAULT_CAPACITY );
+			m_entries.reserve( RESTINIO_HEADER_FIELDS_ARENA_DEFAULT_FIELDS_COUNT );
+		}
+
+		//! Start a new field.
+		void
+		start_name( string_view_t name_part )
+		{
+			m_entries.push_back( entry_t{ m_data.size(), 0u, 0u, 0u,
+					http_field_t::field_unspecified } );
+			append_name( name_part );
+		}
+
+		//! Append a part of the name to the last field.
+		void
+		append_name( string_view_t name_part )
+		{
+			m_data.append( name_part.data(), name_part.size() );
+			m_entries.back().m_name_size += name_part.size();
+		}
+
+		//! Start the value of the last field.
+		/*!
+		 * The name of the field is complete at this point, so the field
+		 * id is detected here.
+		 */
+		void
+		start_value( string_view_t value_part )
+		{
+			auto & e = m_entries.back();
+			e.m_field_id = string_to_field( name( e ) );
+			e.m_value_offset = m_data.size();
+			append_value( value_part );
+		}
+
+		//! Append a part of the value to the last field.
+		void
+		append_value( string_view_t value_part )
+		{
+			m_data.append( value_part.data(), value_part.size() );
+			m_entries.back().m_value_size += value_part.size();
+		}
+
+		//! Size of the name of the last field.
+		std::size_t
+		last_name_size() const noexcept
+		{
+			return m_entries.back().m_name_size;
+		}
+
+		//! Count of stored fields.
+		std::size_t
+		size() const noexcept { return m_entries.size(); }
+
+		//! Name of the field with the specified index.
+		string_view_t
+		name( std::size_t index ) const noexcept
+		{
+			return name( m_entries[ index ] );
+		}
+
+		//! Value of the field with the specified index.
+		string_view_t
+		value( std::size_t index ) const noexcept
+		{
+			const auto & e = m_entries[ index ];
+			return { m_data.data() + e.m_value_offset, e.m_value_size };
+		}
+
+		//! ID of the field with the specified index.
+		http_field_t
+		field_id( std::size_t index ) const noexcept
+		{
+			return m_entries[ index ].m_field_id;
+		}
+
+		//! Find the value of a field by name.
+		/*!
+		 * If there are several fields with the same name then the value
+		 * of the last one is returned. It's the same behavior as
+		 * for the case when fields are stored via
+		 * http_header_fields_t::set_field().
+		 */
+		optional_t< string_view_t >
+		find_value( string_view_t field_name ) const noexcept
+		{
+			return find_last_value( [&]( const entry_t & e ) {
+					return impl::is_equal_caseless( name( e ), field_name );
+				} );
+		}
+
+		//! Find the value of a field by ID.
+		optional_t< string_view_t >
+		find_value( http_field_t field_id ) const noexcept
+		{
+			return find_last_value( [&]( const entry_t & e ) {
+					return e.m_field_id == field_id;
+				} );
+		}
+
+		//! Fields converted into http_header_field_t objects.
+		/*!
+		 * The conversion is performed on the first call.
+		 *
+		 * @attention
+		 * This method is used by `noexcept` methods of
+		 * http_header_fields_t, so it's `noexcept` too. The conversion
+		 * can fail only because of lack of memory, and in that case
+		 * std::terminate() is called.
+		 */
+		const fields_container_t &
+		fields() const noexcept
+		{
+			std::call_once( m_conversion_flag, [this] {
+					copy_fields_to( m_converted_fields, m_converted_index );
+				} );
+
+			return m_converted_fields;
+		}
+
+		//! Index of known fields in the container returned by fields().
+		/*!
+		 * Can be used only after a call to fields().
+		 */
+		const known_fields_index_t &
+		fields_index() const noexcept { return m_converted_index; }
+
+		//! Convert fields into http_header_field_t objects.
+		/*!
+		 * Fields are appended to @a to. If there are several fields with
+		 * the same name then they are merged the same way as by
+		 * http_header_fields_t::set_field().
+		 */
+		void
+		copy_fields_to(
+			fields_container_t & to,
+			known_fields_index_t & index ) const
+		{
+			to.reserve( to.size() + m_entries.size() );
+			for( const auto & e : m_entries )
+			{
+				const auto n = name( e );
+				const auto v = string_view_t{
+						m_data.data() + e.m_value_offset, e.m_value_size };
+
+				const auto it = find_field( to, index, e.m_field_id, n );
+				if( to.end() != it )
+				{
+					it->name( std::string{ n.data(), n.size() } );
+					it->value( std::string{ v.data(), v.size() } );
+				}
+				else
+				{
+					to.emplace_back( n, v, e.m_field_id );
+					index.on_field_added( e.m_field_id, to.size() - 1u );
+				}
+			}
+		}
+
+	private:
+		struct entry_t
+		{
+			std::size_t m_name_offset;
+			std::size_t m_name_size;
+			std::size_t m_value_offset;
+			std::size_t m_value_size;
+			http_field_t m_field_id;
+		};
+
+		string_view_t
+		name( const entry_t & e ) const noexcept
+		{
+			return { m_data.data() + e.m_name_offset, e.m_name_size };
+		}
+
+		template< typename Predicate >
+		optional_t< string_view_t >
+		find_last_value( Predicate && pred ) const noexcept
+		{
+			optional_t< string_view_t > result;
+
+			const auto it = std::find_if(
+					m_entries.rbegin(), m_entries.rend(), pred );
+			if( m_entries.rend() != it )
+				result = string_view_t{
+						m_data.data() + it->m_value_offset, it->m_value_size };
+
+			return result;
+		}
+
+		std::string m_data;
+		std::vector< entry_t > m_entries;
+
+		//! Data for fields().
+		//! \{
+		mutable std::once_flag m_conversion_flag;
+		mutable fields_container_t m_converted_fields;
+		mutable known_fields_index_t m_converted_index;
+		//! \}
+};
+
+//! Alias for shared pointer to header_fields_arena_t.
+using header_fields_arena_shared_ptr_t =
+		std::shared_ptr< header_fields_arena_t >;
+
+void
+use_fields_arena_accessor(
+	http_header_fields_t &,
+	header_fields_arena_shared_ptr_t );
+
+//
+// parsed_field_value_t
+//
+/*!
+ * @brief Type of the result of parsing a field value by
+ * `Parsed_Field_Type::try_parse()`.
+ *
+ * It's `expected_t<Parsed_Field_Type, easy_parser::parse_error_t>`
+ * for parsers from restinio::http_field_parsers.
+ *
+ * @since v.0.6.9
+ */
+template< typename Parsed_Field_Type >
+using parsed_field_value_t = decltype(
+		Parsed_Field_Type::try_parse( std::declval< string_view_t >() ) );
+
+//
+// parsed_fields_cache_t
+//
+/*!
+ * @brief A cache of parsed values of header fields.
+ *
+ * Every entry holds the result of `Parsed_Field_Type::try_parse()`
+ * for a field and the version of header fields at the moment of
+ * parsing. The version is changed by every modification of fields,
+ * so an entry is parsed again if fields are modified after parsing.
+ *
+ * Access to entries is protected by a mutex, so get() can be called
+ * on the same cache from different threads.
+ *
+ * Parsed values are shared between copies of the cache.
+ *
+ * @since v.0.6.9
+ */
+class parsed_fields_cache_t
+{
+	public:
+		parsed_fields_cache_t() = default;
+
+		parsed_fields_cache_t( const parsed_fields_cache_t & other )
+			:	m_entries{ other.copy_entries() }
+		{}
+
+		// Moved object can't be accessed from other threads.
+		parsed_fields_cache_t( parsed_fields_cache_t && other ) noexcept
+			:	m_entries{ std::move( other.m_entries ) }
+		{}
+
+		parsed_fields_cache_t &
+		operator=( const parsed_fields_cache_t & other )
+		{
+			if( this != &other )
+			{
+				auto entries = other.copy_entries();
+
+				std::lock_guard< std::mutex > lock{ m_lock };
+				m_entries.swap( entries );
+			}
+
+			return *this;
+		}
+
+		parsed_fields_cache_t &
+		operator=( parsed_fields_cache_t && other ) noexcept
+		{
+			m_entries = std::move( other.m_entries );
+			return *this;
+		}
+
+		//! Get the parsed value of a field.
+		/*!
+		 * The field is identified by @a field_id or by @a field_name
+		 * if @a field_id is http_field_t::field_unspecified.
+		 *
+		 * The raw value is parsed only if there is no entry for that field
+		 * and Parsed_Field_Type or the entry was made for another
+		 * @a fields_version.
+		 *
+		 * \note
+		 * The mutex is locked only for a lookup and for a store of
+		 * the result, the value is parsed without the lock. If several
+		 * threads parse the same value at the same time then the result
+		 * of the first of them is stored and returned to all of them.
+		 *
+		 * The returned value isn't changed by subsequent calls, even if
+		 * the value is parsed again for another @a fields_version.
+		 */
+		template< typename Parsed_Field_Type >
+		std::shared_ptr< const parsed_field_value_t< Parsed_Field_Type > >
+		get(
+			http_field_t field_id,
+			string_view_t field_name,
+			std::uint64_t fields_version,
+			string_view_t raw_value )
+		{
+			using value_t = parsed_field_value_t< Parsed_Field_Type >;
+
+			const void * type_key = &type_key_holder_t< Parsed_Field_Type >::key;
+
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+
+				const auto it = find_entry( type_key, field_id, field_name );
+				if( m_entries.end() != it &&
+						fields_version == it->m_fields_version )
+					return std::static_pointer_cast< const value_t >(
+							it->m_value );
+			}
+
+			std::shared_ptr< const void > value =
+					std::make_shared< const value_t >(
+							Parsed_Field_Type::try_parse( raw_value ) );
+
+			std::lock_guard< std::mutex > lock{ m_lock };
+
+			auto it = find_entry( type_key, field_id, field_name );
+			if( m_entries.end() == it )
+			{
+				m_entries.emplace_back();
+				it = std::prev( m_entries.end() );
+				it->m_type_key = type_key;
+				it->m_field_id = field_id;
+				if( http_field_t::field_unspecified == field_id )
+					it->m_field_name.assign( field_name.data(), field_name.size() );
+			}
+			else if( fields_version == it->m_fields_version )
+				// The value is already stored by another thread.
+				return std::static_pointer_cast< const value_t >( it->m_value );
+
+			it->m_value = std::move( value );
+			it->m_fields_version = fields_version;
+
+			return std::static_pointer_cast< const value_t >( it->m_value );
+		}
+
+		//! Remove all entries.
+		void
+		clear() noexcept
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			m_entries.clear();
+		}
+
+	private:
+		//! A holder of an unique address for every type.
+		template< typename T >
+		struct type_key_holder_t
+		{
+			static const char key;
+		};
+
+		struct entry_t
+		{
+			//! The address of type_key_holder_t<Parsed_Field_Type>::key.
+			const void * m_type_key;
+			http_field_t m_field_id;
+			//! The name of the field. It's used only for fields with
+			//! http_field_t::field_unspecified id.
+			std::string m_field_name;
+			//! The version of fields the m_value is parsed for.
+			std::uint64_t m_fields_version;
+			//! The result of Parsed_Field_Type::try_parse().
+			std::shared_ptr< const void > m_value;
+		};
+
+		using entries_container_t = std::vector< entry_t >;
+
+		//! Find an entry for a type and a field.
+		/*!
+		 * \note
+		 * The mutex should be locked by the caller.
+		 */
+		entries_container_t::iterator
+		find_entry(
+			const void * type_key,
+			http_field_t field_id,
+			string_view_t field_name )
+		{
+			return std::find_if( m_entries.begin(), m_entries.end(),
+				[&]( const entry_t & e ) {
+					return type_key == e.m_type_key &&
+						field_id == e.m_field_id &&
+						( http_field_t::field_unspecified != field_id ||
+							impl::is_equal_caseless( e.m_field_name, field_name ) );
+				} );
+		}
+
+		entries_container_t
+		copy_entries() const
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			return m_entries;
+		}
+
+		mutable std::mutex m_lock;
+
+		entries_container_t m_entries;
+};
+
+template< typename T >
+const char parsed_fields_cache_t::type_key_holder_t< T >::key{};
+
+} /* namespace impl */
+
 //
 // http_header_fields_t
 //
@@ -704,6 +1287,11 @@ class http_header_fields_t
 		friend void
 		impl::append_last_field_accessor( http_header_fields_t &, string_view_t );
 
+		friend void
+		impl::use_fields_arena_accessor(
+			http_header_fields_t &,
+			impl::header_fields_arena_shared_ptr_t );
+
 	public:
 		using fields_container_t = std::vector< http_header_field_t >;
 
@@ -725,13 +1313,21 @@ class http_header_fields_t
 		swap_fields( http_header_fields_t & http_header_fields )
 		{
 			std::swap( m_fields, http_header_fields.m_fields );
+			std::swap( m_index, http_header_fields.m_index );
+			std::swap( m_arena, http_header_fields.m_arena );
+
+			on_fields_modified();
+			http_header_fields.on_fields_modified();
 		}
 
 		//! Check field by name.
 		bool
 		has_field( string_view_t field_name ) const noexcept
 		{
-			return m_fields.cend() != cfind( field_name );
+			if( m_arena )
+				return static_cast<bool>( m_arena->find_value( field_name ) );
+
+			return nullptr != cfind( field_name );
 		}
 
 		//! Check field by field-id.
@@ -743,7 +1339,10 @@ class http_header_fields_t
 		bool
 		has_field( http_field_t field_id ) const noexcept
 		{
-			return m_fields.cend() != cfind( field_id );
+			if( m_arena )
+				return static_cast<bool>( m_arena->find_value( field_id ) );
+
+			return nullptr != cfind( field_id );
 		}
 
 		//! Set header field via http_header_field_t.
@@ -770,7 +1369,7 @@ class http_header_fields_t
 			}
 			else
 			{
-				m_fields.emplace_back( std::move( http_header_field ) );
+				emplace_new_field( std::move( http_header_field ) );
 			}
 		}
 
@@ -780,7 +1379,10 @@ class http_header_fields_t
 			std::string field_name,
 			std::string field_value )
 		{
-			const auto it = find( field_name );
+			// The id of the field is detected only once.
+			const auto field_id = string_to_field( field_name );
+			const auto it = impl::find_field(
+					fields(), m_index, field_id, field_name );
 
 			if( m_fields.end() != it )
 			{
@@ -789,9 +1391,10 @@ class http_header_fields_t
 			}
 			else
 			{
-				m_fields.emplace_back(
+				emplace_new_field(
 					std::move( field_name ),
-					std::move( field_value ) );
+					std::move( field_value ),
+					field_id );
 			}
 		}
 
@@ -815,7 +1418,7 @@ class http_header_fields_t
 				}
 				else
 				{
-					m_fields.emplace_back(
+					emplace_new_field(
 						field_id,
 						std::move( field_value ) );
 				}
@@ -836,7 +1439,7 @@ class http_header_fields_t
 			}
 			else
 			{
-				m_fields.emplace_back( field_name, field_value );
+				emplace_new_field( field_name, field_value );
 			}
 		}
 
@@ -860,7 +1463,7 @@ class http_header_fields_t
 				}
 				else
 				{
-					m_fields.emplace_back( field_id, field_value );
+					emplace_new_field( field_id, field_value );
 				}
 			}
 		}
@@ -869,13 +1472,13 @@ class http_header_fields_t
 		const std::string &
 		get_field( string_view_t field_name ) const
 		{
-			const auto it = cfind( field_name );
+			const auto * f = cfind( field_name );
 
-			if( m_fields.end() == it )
+			if( !f )
 				throw exception_t{
 					fmt::format( "field '{}' doesn't exist", field_name ) };
 
-			return it->value();
+			return f->value();
 		}
 
 		//! Try to get the value of a field by field name.
@@ -893,11 +1496,11 @@ class http_header_fields_t
 		nullable_pointer_t<const std::string>
 		try_get_field( string_view_t field_name ) const noexcept
 		{
-			const auto it = cfind( field_name );
-			if( m_fields.end() == it )
+			const auto * f = cfind( field_name );
+			if( !f )
 				return nullptr;
 			else
-				return std::addressof(it->value());
+				return std::addressof(f->value());
 		}
 
 		//! Get field by id.
@@ -911,9 +1514,9 @@ class http_header_fields_t
 						"unspecified fields cannot be searched by id" ) };
 			}
 
-			const auto it = cfind( field_id );
+			const auto * f = cfind( field_id );
 
-			if( m_fields.end() == it )
+			if( !f )
 			{
 				throw exception_t{
 					fmt::format(
@@ -921,7 +1524,7 @@ class http_header_fields_t
 						field_to_string( field_id ) ) };
 			}
 
-			return it->value();
+			return f->value();
 		}
 
 		//! Try to get the value of a field by field ID.
@@ -941,9 +1544,8 @@ class http_header_fields_t
 		{
 			if( http_field_t::field_unspecified != field_id )
 			{
-				const auto it = cfind( field_id );
-				if( m_fields.end() != it )
-					return std::addressof(it->value());
+				if( const auto * f = cfind( field_id ) )
+					return std::addressof(f->value());
 			}
 
 			return nullptr;
@@ -960,12 +1562,12 @@ class http_header_fields_t
 			string_view_t field_name,
 			string_view_t default_value ) const
 		{
-			const auto it = cfind( field_name );
+			const auto * f = cfind( field_name );
 
-			if( m_fields.end() == it )
+			if( !f )
 				return std::string( default_value.data(), default_value.size() );
 
-			return it->value();
+			return f->value();
 		}
 
 		//! Get field value by field name or default value if the field not found.
@@ -979,12 +1581,12 @@ class http_header_fields_t
 			string_view_t field_name,
 			std::string && default_value ) const
 		{
-			const auto it = cfind( field_name );
+			const auto * f = cfind( field_name );
 
-			if( m_fields.end() == it )
+			if( !f )
 				return std::move(default_value);
 
-			return it->value();
+			return f->value();
 		}
 
 		//! Get field by name or default value if the field not found.
@@ -1024,10 +1626,8 @@ class http_header_fields_t
 		{
 			if( http_field_t::field_unspecified != field_id )
 			{
-				const auto it = cfind( field_id );
-
-				if( m_fields.end() != it )
-					return it->value();
+				if( const auto * f = cfind( field_id ) )
+					return f->value();
 			}
 
 			return std::string( default_value.data(), default_value.size() );
@@ -1070,10 +1670,8 @@ class http_header_fields_t
 		{
 			if( http_field_t::field_unspecified != field_id )
 			{
-				const auto it = cfind( field_id );
-
-				if( m_fields.end() != it )
-					return it->value();
+				if( const auto * f = cfind( field_id ) )
+					return f->value();
 			}
 
 			return std::move( default_value );
@@ -1088,6 +1686,7 @@ class http_header_fields_t
 			if( m_fields.end() != it )
 			{
 				m_fields.erase( it );
+				m_index.rebuild( m_fields );
 			}
 		}
 
@@ -1102,6 +1701,7 @@ class http_header_fields_t
 				if( m_fields.end() != it )
 				{
 					m_fields.erase( it );
+					m_index.rebuild( m_fields );
 				}
 			}
 		}
@@ -1116,6 +1716,16 @@ class http_header_fields_t
 			//! Name of a field.
 			string_view_t name ) const
 		{
+			if( m_arena )
+			{
+				const auto v = m_arena->find_value( name );
+				if( !v )
+					throw exception_t{
+						fmt::format( "field '{}' doesn't exist", name ) };
+
+				return *v;
+			}
+
 			return { this->get_field(name) };
 		}
 
@@ -1125,6 +1735,18 @@ class http_header_fields_t
 			//! ID of a field.
 			http_field_t field_id ) const
 		{
+			if( m_arena && http_field_t::field_unspecified != field_id )
+			{
+				const auto v = m_arena->find_value( field_id );
+				if( !v )
+					throw exception_t{
+						fmt::format(
+							"field '{}' doesn't exist",
+							field_to_string( field_id ) ) };
+
+				return *v;
+			}
+
 			return { this->get_field(field_id) };
 		}
 
@@ -1145,6 +1767,9 @@ class http_header_fields_t
 			//! Name of a field.
 			string_view_t name ) const noexcept
 		{
+			if( m_arena )
+				return m_arena->find_value( name );
+
 			optional_t< string_view_t > result;
 
 			if( auto * ptr = this->try_get_field(name) )
@@ -1170,6 +1795,9 @@ class http_header_fields_t
 			//! ID of a field.
 			http_field_t field_id ) const noexcept
 		{
+			if( m_arena && http_field_t::field_unspecified != field_id )
+				return m_arena->find_value( field_id );
+
 			optional_t< string_view_t > result;
 
 			if( auto * ptr = this->try_get_field(field_id) )
@@ -1191,7 +1819,10 @@ class http_header_fields_t
 			void(http_header_field_t);
 			\endcode
 
-			This method is `noexcept` if \a lambda is `noexcept`.
+			@note
+			Fields stored in incoming_header_storage::arena_views_t
+			are converted into http_header_field_t objects on the first
+			call. Use for_each_field_view() to avoid that conversion.
 
 			Usage example:
 			\code
@@ -1206,26 +1837,84 @@ class http_header_fields_t
 				noexcept(noexcept(lambda(
 						std::declval<const http_header_field_t &>())))
 		{
-			for( const auto & f : m_fields )
+			for( const auto & f : fields() )
 				lambda( f );
 		}
 
+		//! Enumeration of fields without creation of http_header_field_t.
+		/*!
+			Calls \a lambda for each field in the container.
+
+			Lambda should have the following format:
+			\code
+			void(string_view_t name, string_view_t value);
+			\endcode
+
+			Unlike for_each_field() this method doesn't require
+			creation of http_header_field_t objects if fields of
+			an incoming request are stored in
+			incoming_header_storage::arena_views_t.
+
+			@note
+			If there are several fields with the same name in
+			an incoming request then all of them are enumerated.
+
+			@since v.0.6.9
+		*/
+		template< typename Lambda >
+		void
+		for_each_field_view( Lambda && lambda ) const
+				noexcept(noexcept(lambda(
+						std::declval<string_view_t>(),
+						std::declval<string_view_t>())))
+		{
+			if( m_arena )
+			{
+				for( std::size_t i = 0u, n = m_arena->size(); i != n; ++i )
+					lambda( m_arena->name( i ), m_arena->value( i ) );
+			}
+			else
+			{
+				for( const auto & f : m_fields )
+					lambda( string_view_t{ f.name() }, string_view_t{ f.value() } );
+			}
+		}
+
+		//! \name Access to fields as http_header_field_t objects.
+		/*!
+			@note
+			Fields stored in incoming_header_storage::arena_views_t
+			are converted into http_header_field_t objects on the first
+			call.
+		*/
+		//! \{
 		const_iterator
 		begin() const noexcept
 		{
-			return m_fields.cbegin();
+			return fields().cbegin();
 		}
 
 		const_iterator
 		end() const noexcept
 		{
-			return m_fields.cend();
+			return fields().cend();
 		}
 
 		auto fields_count() const noexcept
 		{
-			return m_fields.size();
+			return fields().size();
 		}
+		//! \}
+
+	protected:
+		//! The version of fields.
+		/*!
+			It's changed by every modification of fields.
+
+			@since v.0.6.9
+		*/
+		std::uint64_t
+		fields_version() const noexcept { return m_fields_version; }
 
 	private:
 		//! Appends last added field.
@@ -1240,56 +1929,151 @@ class http_header_fields_t
 		void
 		append_last_field( string_view_t field_value )
 		{
+			on_fields_modified();
 			m_fields.back().append_value( field_value );
 		}
 
-		fields_container_t::iterator
-		find( string_view_t field_name ) noexcept
+		//! Access to fields with conversion from arena if necessary.
+		/*!
+			The non-const version moves fields from the arena into
+			m_fields, because they are going to be modified.
+
+			The const version doesn't modify the object. Fields are
+			converted inside the arena (only once, in a thread safe manner).
+			It's `noexcept`, see header_fields_arena_t::fields().
+
+			@since v.0.6.9
+		*/
+		//! \{
+		fields_container_t &
+		fields()
 		{
-			return std::find_if(
-				m_fields.begin(),
-				m_fields.end(),
-				[&]( const auto & f ){
-					return impl::is_equal_caseless( f.name(), field_name );
-				} );
+			// Fields can be modified via the returned reference.
+			on_fields_modified();
+
+			if( m_arena )
+			{
+				m_arena->copy_fields_to( m_fields, m_index );
+				m_arena.reset();
+			}
+			return m_fields;
 		}
 
-		fields_container_t::const_iterator
-		cfind( string_view_t field_name ) const noexcept
+		const fields_container_t &
+		fields() const noexcept
 		{
-			return std::find_if(
-				m_fields.cbegin(),
-				m_fields.cend(),
-				[&]( const auto & f ){
-					return impl::is_equal_caseless( f.name(), field_name );
-				} );
+			return m_arena ? m_arena->fields() : m_fields;
+		}
+		//! \}
+
+		//! Add a new field to the end of fields.
+		/*!
+			@since v.0.6.9
+		*/
+		template< typename... Args >
+		void
+		emplace_new_field( Args && ...args )
+		{
+			on_fields_modified();
+			m_fields.emplace_back( std::forward< Args >( args )... );
+			m_index.on_field_added(
+					m_fields.back().field_id(), m_fields.size() - 1u );
 		}
 
 		fields_container_t::iterator
-		find( http_field_t field_id ) noexcept
+		find( string_view_t field_name )
+		{
+			return impl::find_field(
+					fields(), m_index, string_to_field( field_name ), field_name );
+		}
+
+		fields_container_t::iterator
+		find( http_field_t field_id )
+		{
+			return impl::find_field( fields(), m_index, field_id );
+		}
+
+		//! Find a field without modification of the object.
+		/*!
+			@return nullptr if the field isn't found.
+		*/
+		//! \{
+		const http_header_field_t *
+		cfind( string_view_t field_name ) const
 		{
-			return std::find_if(
-				m_fields.begin(),
-				m_fields.end(),
-				[&]( const auto & f ){
-					return f.field_id() == field_id;
+			const auto field_id = string_to_field( field_name );
+			return cfind_impl( [&]( const auto & all_fields, const auto & index ) {
+					return impl::find_field(
+							all_fields, index, field_id, field_name );
 				} );
 		}
 
-		fields_container_t::const_iterator
-		cfind( http_field_t field_id ) const noexcept
+		const http_header_field_t *
+		cfind( http_field_t field_id ) const
 		{
-			return std::find_if(
-				m_fields.cbegin(),
-				m_fields.cend(),
-				[&]( const auto & f ){
-					return f.field_id() == field_id;
+			return cfind_impl( [&]( const auto & all_fields, const auto & index ) {
+					return impl::find_field( all_fields, index, field_id );
 				} );
 		}
 
+		template< typename Finder >
+		const http_header_field_t *
+		cfind_impl( Finder && finder ) const
+		{
+			const auto & all_fields = fields();
+			const auto & index = m_arena ? m_arena->fields_index() : m_index;
+
+			const auto it = finder( all_fields, index );
+			return all_fields.end() != it ? std::addressof( *it ) : nullptr;
+		}
+		//! \}
+
+		void
+		on_fields_modified() noexcept { ++m_fields_version; }
+
+		//! Fields stored as http_header_field_t objects.
 		fields_container_t m_fields;
+
+		//! Index of known fields in m_fields.
+		/*!
+			@since v.0.6.9
+		*/
+		impl::known_fields_index_t m_index;
+
+		//! Fields of an incoming request stored in an arena.
+		/*!
+			It is not empty only if incoming_header_storage::arena_views_t
+			is used and fields are not modified yet.
+
+			@since v.0.6.9
+		*/
+		std::shared_ptr< const impl::header_fields_arena_t > m_arena;
+
+		//! The counter of modifications of fields.
+		/*!
+			@since v.0.6.9
+		*/
+		std::uint64_t m_fields_version{ 0u };
 };
 
+namespace impl
+{
+
+//! Make an empty http_header_fields_t object to use fields from an arena.
+/*!
+ * @since v.0.6.9
+ */
+inline void
+use_fields_arena_accessor(
+	http_header_fields_t & fields,
+	header_fields_arena_shared_ptr_t arena )
+{
+	fields.m_arena = std::move( arena );
+	fields.on_fields_modified();
+}
+
+} /* namespace impl */
+
 //
 // http_connection_header_t
 //
@@ -1709,11 +2493,101 @@ struct http_request_header_t final
 			m_request_target.append( at, length );
 		}
 
+		//! Parsed values of fields.
+		//! \{
+
+		//! Get the parsed value of a field.
+		/*!
+			The value of the field is parsed by
+			`Parsed_Field_Type::try_parse()` on the first call. The result
+			is stored in the header and is returned by subsequent calls
+			without parsing the field again (unless the field is modified).
+
+			Usage example:
+			@code
+			auto on_post(const restinio::request_handle_t & req) {
+				using namespace restinio::http_field_parsers;
+
+				const auto content_type =
+						req->header().parsed< content_type_value_t >(
+								restinio::http_field::content_type );
+				if( content_type && *content_type ) {
+					// Content-Type is present and is successfully parsed.
+					if( "multipart" == (*content_type)->media_type.type ) {
+						...
+					}
+				}
+			}
+			@endcode
+
+			@return nullptr if there is no such field. Otherwise a shared
+			pointer to the result of `Parsed_Field_Type::try_parse()` (it's
+			`expected_t<Parsed_Field_Type, easy_parser::parse_error_t>`
+			for parsers from restinio::http_field_parsers).
+			The pointed value isn't changed by subsequent modifications
+			of the header: a modified field is parsed again into a new
+			object by the next call to parsed().
+
+			\note
+			Parsed values are stored in the header object under a mutex
+			(the value itself is parsed without the lock), so parsed()
+			can be called from different threads for the same header.
+			But the header shouldn't be modified in parallel.
+
+			@since v.0.6.9
+		*/
+		template< typename Parsed_Field_Type >
+		RESTINIO_NODISCARD
+		std::shared_ptr< const impl::parsed_field_value_t< Parsed_Field_Type > >
+		parsed( http_field_t field_id ) const
+		{
+			if( http_field_t::field_unspecified == field_id )
+				return nullptr;
+
+			const auto raw_value = opt_value_of( field_id );
+			if( !raw_value )
+				return nullptr;
+
+			return m_parsed_fields.get< Parsed_Field_Type >(
+					field_id, string_view_t{}, fields_version(), *raw_value );
+		}
+
+		//! Get the parsed value of a field by its name.
+		/*!
+			The same as parsed(http_field_t) but the field is identified
+			by its name.
+
+			@since v.0.6.9
+		*/
+		template< typename Parsed_Field_Type >
+		RESTINIO_NODISCARD
+		std::shared_ptr< const impl::parsed_field_value_t< Parsed_Field_Type > >
+		parsed( string_view_t field_name ) const
+		{
+			const auto field_id = string_to_field( field_name );
+			if( http_field_t::field_unspecified != field_id )
+				return parsed< Parsed_Field_Type >( field_id );
+
+			const auto raw_value = opt_value_of( field_name );
+			if( !raw_value )
+				return nullptr;
+
+			return m_parsed_fields.get< Parsed_Field_Type >(
+					field_id, field_name, fields_version(), *raw_value );
+		}
+		//! \}
+
 	private:
 		http_method_id_t m_method{ http_method_get() };
 		std::string m_request_target;
 		std::size_t m_query_separator_pos{ 0 };
 		std::size_t m_fragment_separator_pos{ 0 };
+
+		//! Parsed values of fields.
+		/*!
+			@since v.0.6.9
+		*/
+		mutable impl::parsed_fields_cache_t m_parsed_fields;
 };
 
 //
@@ -197,6 +197,11 @@ class http_server_t
 			settings.ensure_valid_connection_state_listener();
 			// The presence of IP-blocker should also be checked.
 			settings.ensure_valid_ip_blocker();
+			// Since v.0.6.9 the presence of body sink factory should
+			// be checked too.
+			settings.ensure_valid_body_sink_factory();
+			// And the presence of pre-handler too.
+			settings.ensure_valid_pre_handler();
 
 			// Now we can continue preparation of HTTP server.
 
@@ -356,6 +361,37 @@ class http_server_t
 			}
 		}
 
+		//! Get the count of alive connections.
+		/*!
+			Websocket connections are counted too.
+
+			For sharded servers it is the count for that shard only.
+
+			\note This method is thread-safe.
+
+			\since v.0.6.9
+		*/
+		std::size_t
+		connections_count() const
+		{
+			return m_acceptor->connection_count_limiter().connections_count();
+		}
+
+		//! Is accepting of new connections paused?
+		/*!
+			Accepting is paused when the count of alive connections reaches
+			the limit set by server_settings_t::max_connections().
+
+			\note This method is thread-safe.
+
+			\since v.0.6.9
+		*/
+		bool
+		is_accept_paused() const
+		{
+			return m_acceptor->connection_count_limiter().is_accept_paused();
+		}
+
 	private:
 		//! A wrapper for asio io_context where server is running.
 		io_context_shared_ptr_t m_io_context;
@@ -13,6 +13,10 @@
 
 #include <restinio/http_server.hpp>
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace restinio
 {
 
@@ -902,6 +906,418 @@ public :
 	wait() noexcept { m_pool.wait(); }
 };
 
+//
+// run_on_thread_pool_sharded_settings_t
+//
+/*!
+ * @brief Settings for the case when several instances of http_server
+ * must be run on a thread pool, one instance per thread.
+ *
+ * @note
+ * Shouldn't be used directly. Only as result of on_thread_pool_sharded()
+ * function as parameter for run().
+ *
+ * @since v.0.6.9
+ */
+template<typename Traits, typename Configurator>
+class run_on_thread_pool_sharded_settings_t final
+{
+	//! Size of the pool.
+	std::size_t m_pool_size;
+
+	//! Configurator for settings of every shard.
+	Configurator m_configurator;
+
+	//! Should worker threads be pinned to CPUs?
+	bool m_pin_threads_to_cpus{ false };
+
+public:
+	//! Constructor.
+	run_on_thread_pool_sharded_settings_t(
+		//! Size of the pool.
+		std::size_t pool_size,
+		//! Configurator for settings of every shard.
+		Configurator configurator )
+		:	m_pool_size{ pool_size }
+		,	m_configurator{ std::move(configurator) }
+	{}
+
+	//! Get the pool size.
+	std::size_t
+	pool_size() const noexcept { return m_pool_size; }
+
+	//! Get the configurator.
+	Configurator &
+	configurator() noexcept { return m_configurator; }
+
+	//! Should worker threads be pinned to CPUs?
+	/*!
+	 * If `true` then the thread of the i-th shard is bound to
+	 * the CPU `i % std::thread::hardware_concurrency()`.
+	 *
+	 * @note
+	 * Thread affinity is supported only on Linux. This flag is
+	 * ignored on other platforms.
+	 */
+	//! \{
+	run_on_thread_pool_sharded_settings_t &
+	pin_threads_to_cpus( bool value ) & noexcept
+	{
+		m_pin_threads_to_cpus = value;
+		return *this;
+	}
+
+	run_on_thread_pool_sharded_settings_t &&
+	pin_threads_to_cpus( bool value ) && noexcept
+	{
+		return std::move(this->pin_threads_to_cpus( value ));
+	}
+
+	bool
+	pin_threads_to_cpus() const noexcept { return m_pin_threads_to_cpus; }
+	//! \}
+};
+
+//
+// on_thread_pool_sharded
+//
+/*!
+ * @brief A special marker for the case when http_server must be
+ * run in io_context-per-thread mode.
+ *
+ * In that mode every thread of the pool has its own io_context and
+ * its own instance of http_server_t with its own acceptor. All
+ * acceptors are bound to the same address with SO_REUSEPORT option,
+ * so incoming connections are distributed between threads by the OS
+ * kernel. A connection is served only by the thread that accepted it,
+ * so there is no need in strands and other synchronization between
+ * threads. Because of that the default traits for that mode is
+ * default_single_thread_traits_t.
+ *
+ * The @a configurator is called once for every shard, so every shard
+ * gets its own request handler, logger and so on. Because the
+ * configurator can be called on different threads the objects shared
+ * between shards should be thread-safe. Limits like
+ * server_settings_t::max_connections() are applied to every shard
+ * separately.
+ *
+ * Usage example:
+ * @code
+ * restinio::run(
+ * 	restinio::on_thread_pool_sharded( 8,
+ * 		[]( auto & settings ) {
+ * 			settings
+ * 				.port( 8080 )
+ * 				.address( "localhost" )
+ * 				.request_handler( ... );
+ * 		} )
+ * 	.pin_threads_to_cpus( true ) );
+ * @endcode
+ *
+ * @note
+ * This mode requires SO_REUSEPORT support from the OS. An exception
+ * is thrown by run() if it isn't supported.
+ *
+ * @since v.0.6.9
+ */
+template<
+	typename Traits = default_single_thread_traits_t,
+	typename Configurator >
+run_on_thread_pool_sharded_settings_t< Traits, std::decay_t<Configurator> >
+on_thread_pool_sharded(
+	//! Size of the pool.
+	std::size_t pool_size,
+	//! Configurator for settings of every shard.
+	//! Should have the format `void(server_settings_t<Traits> &)`.
+	Configurator && configurator )
+{
+	return run_on_thread_pool_sharded_settings_t<
+			Traits, std::decay_t<Configurator> >{
+		pool_size,
+		std::forward<Configurator>(configurator) };
+}
+
+namespace impl {
+
+#if defined(SO_REUSEPORT)
+//! A type of SO_REUSEPORT socket option.
+/*!
+ * @since v.0.6.9
+ */
+using reuse_port_option_t = asio_ns::detail::socket_option::boolean<
+		SOL_SOCKET, SO_REUSEPORT >;
+#endif
+
+/*!
+ * @brief Modify the settings of a shard to use SO_REUSEPORT for
+ * the acceptor.
+ *
+ * The acceptor options setter specified by a user is preserved and
+ * called before setting SO_REUSEPORT.
+ *
+ * @throw exception_t if SO_REUSEPORT isn't supported by the platform.
+ *
+ * @since v.0.6.9
+ */
+template<typename Traits>
+void
+enable_reuse_port( server_settings_t<Traits> & settings )
+{
+#if defined(SO_REUSEPORT)
+	acceptor_options_setter_t user_setter{
+			std::move( *(settings.acceptor_options_setter()) ) };
+
+	settings.acceptor_options_setter(
+		[user_setter = std::move(user_setter)]( acceptor_options_t & options ) {
+			user_setter( options );
+			options.set_option( reuse_port_option_t{ true } );
+		} );
+#else
+	(void)settings;
+	throw exception_t{ "SO_REUSEPORT isn't supported by the platform" };
+#endif
+}
+
+} /* namespace impl */
+
+//
+// sharded_servers_runner_t
+//
+/*!
+ * @brief Helper class for running several instances of HTTP-server in
+ * io_context-per-thread mode without blocking the current thread.
+ *
+ * Creates a separate io_context and a separate instance of
+ * http_server_t<Traits> for every thread of the pool. All servers
+ * listen the same address and port with SO_REUSEPORT option.
+ * See on_thread_pool_sharded() for more details.
+ *
+ * Every server has its own connection limit, so
+ * server_settings_t::max_connections() is a limit for one shard.
+ *
+ * Usage example:
+ * @code
+ * restinio::sharded_servers_runner_t< my_traits > runner{
+ * 	8, // Count of threads/shards.
+ * 	false, // Don't pin threads to CPUs.
+ * 	[]( auto & settings ) {
+ * 		settings.port( 8080 ).address( "localhost" ).request_handler( ... );
+ * 	} };
+ * runner.start();
+ *
+ * ... // Some application specific code here.
+ *
+ * runner.stop();
+ * runner.wait();
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+template<typename Traits>
+class sharded_servers_runner_t
+{
+public :
+	using server_t = http_server_t<Traits>;
+
+private :
+	//! Pool with io_context for every thread.
+	impl::ioctx_per_thread_pool_t m_pool;
+
+	//! Servers to be run. One for every thread.
+	std::vector< std::unique_ptr< server_t > > m_servers;
+
+public :
+	sharded_servers_runner_t( const sharded_servers_runner_t & ) = delete;
+	sharded_servers_runner_t( sharded_servers_runner_t && ) = delete;
+
+	//! Initializing constructor.
+	template<typename Configurator>
+	sharded_servers_runner_t(
+		//! Size of thread pool (and count of servers).
+		std::size_t pool_size,
+		//! Should threads be pinned to CPUs?
+		bool pin_threads_to_cpus,
+		//! Configurator for settings of every server.
+		Configurator && configurator )
+		:	m_pool{ pool_size, pin_threads_to_cpus }
+	{
+		m_servers.reserve( pool_size );
+		for( std::size_t i = 0u; i != pool_size; ++i )
+		{
+			auto settings = exec_configurator< Traits, Configurator & >(
+					configurator );
+			impl::enable_reuse_port( settings );
+
+			m_servers.emplace_back( std::make_unique< server_t >(
+					restinio::external_io_context( m_pool.io_context( i ) ),
+					std::move(settings) ) );
+		}
+	}
+
+	//! Makes sure the servers are stopped.
+	~sharded_servers_runner_t()
+	{
+		if( started() )
+		{
+			stop();
+			wait();
+		}
+	}
+
+	//! Count of servers (and threads).
+	std::size_t
+	size() const noexcept { return m_servers.size(); }
+
+	//! Access to a server.
+	server_t &
+	server( std::size_t index ) noexcept { return *(m_servers[ index ]); }
+
+	/*!
+	 * @brief Start all servers with callbacks that will be called on
+	 * success or failure.
+	 *
+	 * The @a on_ok is called once when all servers are opened.
+	 * The @a on_error is called once for the first failure.
+	 * In that case all threads are stopped.
+	 *
+	 * Both callbacks are called on a thread from the pool and
+	 * should be noexcept functions/functors.
+	 */
+	template<
+		typename On_Ok_Callback,
+		typename On_Error_Callback >
+	void
+	start(
+		On_Ok_Callback && on_ok,
+		On_Error_Callback && on_error )
+	{
+		static_assert( noexcept(on_ok()), "On_Ok_Callback should be noexcept" );
+		static_assert( noexcept(on_error(std::declval<std::exception_ptr>())),
+				"On_Error_Callback should be noexcept" );
+
+		auto ok_callback = std::make_shared< std::decay_t<On_Ok_Callback> >(
+				std::forward<On_Ok_Callback>(on_ok) );
+		auto error_callback = std::make_shared< std::decay_t<On_Error_Callback> >(
+				std::forward<On_Error_Callback>(on_error) );
+		auto servers_to_open = std::make_shared< std::atomic<std::size_t> >(
+				m_servers.size() );
+		auto failed = std::make_shared< std::atomic<bool> >( false );
+
+		for( auto & s : m_servers )
+		{
+			s->open_async(
+				[ok_callback, servers_to_open]{
+					if( 1u == servers_to_open->fetch_sub( 1u ) )
+						(*ok_callback)();
+				},
+				[this, error_callback, failed]( std::exception_ptr ex ){
+					if( !failed->exchange( true ) )
+					{
+						// There is no sense to run pool.
+						m_pool.stop();
+
+						(*error_callback)( std::move(ex) );
+					}
+				} );
+		}
+
+		m_pool.start();
+	}
+
+	//! Start all servers.
+	void
+	start()
+	{
+		this->start(
+				[]() noexcept { /* nothing to do */ },
+				[]( std::exception_ptr ) noexcept { /* nothing to do */ } );
+	}
+
+	//! Are servers started.
+	bool
+	started() const noexcept { return m_pool.started(); }
+
+	//! Stop all servers.
+	/*!
+	 * Threads of the pool are stopped when all servers are closed.
+	 */
+	void
+	stop() noexcept
+	{
+		auto servers_to_close = std::make_shared< std::atomic<std::size_t> >(
+				m_servers.size() );
+
+		for( auto & s : m_servers )
+		{
+			s->close_async(
+				[this, servers_to_close]{
+					if( 1u == servers_to_close->fetch_sub( 1u ) )
+						m_pool.stop();
+				},
+				[this]( std::exception_ptr /*ex*/ ){
+					// There is no way to handle an error here.
+					// Just stop the pool.
+					m_pool.stop();
+				} );
+		}
+	}
+
+	//! Wait for full stop of all servers.
+	void
+	wait() noexcept { m_pool.wait(); }
+};
+
+//! Helper function for running servers in io_context-per-thread mode
+//! until ctrl+c is hit.
+/*!
+ * Usage example:
+ * \code
+ * restinio::run(
+ * 		restinio::on_thread_pool_sharded(4,
+ * 			[]( auto & settings ) {
+ * 				settings
+ * 					.port(8080)
+ * 					.address("localhost")
+ * 					.request_handler([](auto req) {...});
+ * 			} ) );
+ * \endcode
+ *
+ * \since
+ * v.0.6.9
+ */
+template<typename Traits, typename Configurator>
+inline void
+run( run_on_thread_pool_sharded_settings_t<Traits, Configurator> && settings )
+{
+	sharded_servers_runner_t<Traits> runner{
+			settings.pool_size(),
+			settings.pin_threads_to_cpus(),
+			settings.configurator() };
+
+	std::exception_ptr exception_caught;
+
+	asio_ns::signal_set break_signals{ runner.server( 0u ).io_context(), SIGINT };
+	break_signals.async_wait(
+		[&]( const asio_ns::error_code & ec, int ){
+			if( !ec )
+				runner.stop();
+		} );
+
+	runner.start(
+		[]() noexcept { /* Ok. */ },
+		[&exception_caught]( std::exception_ptr ex ) noexcept {
+			// We can't throw an exception here!
+			// Store it to rethrow later.
+			exception_caught = ex;
+		} );
+
+	runner.wait();
+
+	// If an error was detected it should be propagated.
+	if( exception_caught )
+		std::rethrow_exception( exception_caught );
+}
+
 // Forward declaration.
 // It's necessary for running_server_handle_t.
 template< typename Http_Server >
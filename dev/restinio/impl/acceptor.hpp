@@ -13,6 +13,7 @@
 #include <restinio/impl/include_fmtlib.hpp>
 
 #include <restinio/impl/connection.hpp>
+#include <restinio/impl/connection_count_limiter.hpp>
 
 #include <restinio/utils/suppress_exceptions.hpp>
 
@@ -149,6 +150,42 @@ struct ip_blocker_holder_t< restinio::ip_blocker::noop_ip_blocker_t >
 	}
 };
 
+/*!
+ * @brief Initial delay before the retry of failed accept operation.
+ *
+ * The delay is doubled after every subsequent failure.
+ *
+ * @since v.0.6.9
+ */
+constexpr std::chrono::milliseconds accept_retry_initial_delay{ 10 };
+
+/*!
+ * @brief Max delay before the retry of failed accept operation.
+ *
+ * @since v.0.6.9
+ */
+constexpr std::chrono::milliseconds accept_retry_max_delay{ 1000 };
+
+/*!
+ * @brief Is accept failed because of lack of system resources?
+ *
+ * The acceptor can't do anything in that case but wait for
+ * resources to be freed.
+ *
+ * @since v.0.6.9
+ */
+inline bool
+is_resource_exhaustion_error( const asio_ns::error_code & ec ) noexcept
+{
+	return asio_ns::error::no_descriptors == ec ||
+		asio_ns::error::no_buffer_space == ec ||
+		asio_ns::error::no_memory == ec
+#if defined( ENFILE )
+		|| asio_ns::error_code{ ENFILE, asio_ns::error::get_system_category() } == ec
+#endif
+		;
+}
+
 } /* namespace acceptor_details */
 
 //
@@ -195,7 +232,18 @@ class acceptor_t final
 			,	m_separate_accept_and_create_connect{ settings.separate_accept_and_create_connect() }
 			,	m_connection_factory{ std::move( connection_factory ) }
 			,	m_logger{ logger }
-		{}
+			,	m_connection_count_limiter{
+					std::make_shared< connection_count_limiter_t >(
+						settings.max_connections(),
+						this->cuncurrent_accept_sockets_count() ) }
+		{
+			m_accept_retry_timers.reserve( this->cuncurrent_accept_sockets_count() );
+			for( std::size_t i = 0; i != this->cuncurrent_accept_sockets_count(); ++i )
+				m_accept_retry_timers.emplace_back( io_context );
+			m_accept_retry_delays.resize(
+					this->cuncurrent_accept_sockets_count(),
+					acceptor_details::accept_retry_initial_delay );
+		}
 
 		//! Start listen on port specified in ctor.
 		void
@@ -241,6 +289,20 @@ class acceptor_t final
 				m_acceptor.bind( ep );
 				m_acceptor.listen( asio_ns::socket_base::max_connections );
 
+				// Accept slots paused before the previous close
+				// will be started below.
+				m_connection_count_limiter->reset_paused_slots();
+				m_connection_count_limiter->resume_accept_callback(
+					[weak_ctx = std::weak_ptr< acceptor_t >{ this->shared_from_this() }]
+					( std::size_t i ) {
+						if( auto ctx = weak_ctx.lock() )
+						{
+							asio_ns::post(
+								ctx->get_executor(),
+								[ctx, i]{ ctx->resume_accept( i ); } );
+						}
+					} );
+
 				// Call accept connections routine.
 				for( std::size_t i = 0; i< this->cuncurrent_accept_sockets_count(); ++i )
 				{
@@ -294,6 +356,16 @@ class acceptor_t final
 			return m_open_close_operations_executor;
 		}
 
+		//! Get the limiter that counts alive connections.
+		/*!
+		 * @since v.0.6.9
+		 */
+		const connection_count_limiter_t &
+		connection_count_limiter() const noexcept
+		{
+			return *m_connection_count_limiter;
+		}
+
 	private:
 		//! Get executor for acceptor.
 		auto & get_executor() noexcept { return m_executor; }
@@ -310,19 +382,102 @@ class acceptor_t final
 		 */
 		void
 		accept_next( std::size_t i ) noexcept
+		{
+			// Since v.0.6.9 the count of connections can be limited.
+			if( m_connection_count_limiter->try_start_accept( i ) )
+				do_accept_next( i );
+			else
+				restinio::utils::log_trace_noexcept( m_logger,
+					[&]{
+						return fmt::format(
+								"accept on socket #{} paused: "
+								"max connections count reached: {}",
+								i,
+								m_connection_count_limiter->max_connections() );
+					} );
+		}
+
+		//! Resume accepting on a paused slot.
+		/*!
+		 * A place for a new connection is already reserved by
+		 * connection_count_limiter.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		resume_accept( std::size_t i ) noexcept
+		{
+			if( !m_acceptor.is_open() )
+			{
+				m_connection_count_limiter->accept_failed();
+				return;
+			}
+
+			restinio::utils::log_trace_noexcept( m_logger,
+				[&]{
+					return fmt::format( "accept on socket #{} resumed", i );
+				} );
+
+			do_accept_next( i );
+		}
+
+		//! Start async_accept for a slot.
+		/*!
+		 * A place for a new connection must be reserved by
+		 * connection_count_limiter.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		do_accept_next( std::size_t i ) noexcept
 		{
 			m_acceptor.async_accept(
 				this->socket( i ).lowest_layer(),
 				asio_ns::bind_executor(
 					get_executor(),
 					[i, ctx = this->shared_from_this()]( const auto & ec ) noexcept {
-						if( !ec )
-						{
-							ctx->accept_current_connection( i, ec );
-						}
+						ctx->accept_current_connection( i, ec );
 					} ) );
 		}
 
+		//! Retry accept on a slot after a delay.
+		/*!
+		 * The delay grows exponentially while accept fails.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		retry_accept_after_delay( std::size_t i ) noexcept
+		{
+			auto & delay = m_accept_retry_delays[ i ];
+			const auto current_delay = delay;
+			delay = std::min( delay * 2, acceptor_details::accept_retry_max_delay );
+
+			restinio::utils::log_warn_noexcept( m_logger,
+				[&]{
+					return fmt::format(
+							"accept on socket #{} will be retried in {}ms",
+							i,
+							current_delay.count() );
+				} );
+
+			restinio::utils::suppress_exceptions(
+				m_logger,
+				"retry_accept_after_delay",
+				[&] {
+					auto & timer = m_accept_retry_timers[ i ];
+					timer.expires_after( current_delay );
+					timer.async_wait(
+						asio_ns::bind_executor(
+							get_executor(),
+							[i, ctx = this->shared_from_this()](
+								const asio_ns::error_code & ec ) noexcept {
+								if( !ec && ctx->m_acceptor.is_open() )
+									ctx->accept_next( i );
+							} ) );
+				} );
+		}
+
 		//! Accept current connection.
 		/*!
 		 * @note
@@ -332,19 +487,34 @@ class acceptor_t final
 		accept_current_connection(
 			//! socket index in the pool of sockets.
 			std::size_t i,
-			const std::error_code & ec ) noexcept
+			const asio_ns::error_code & ec ) noexcept
 		{
 			if( !ec )
 			{
+				m_accept_retry_delays[ i ] =
+						acceptor_details::accept_retry_initial_delay;
+
+				// The place for the connection is occupied
+				// until the guard is destroyed.
+				auto lifetime_guard = m_connection_count_limiter->accepted();
+
 				restinio::utils::suppress_exceptions(
 						m_logger,
 						"accept_current_connection",
-						[this, i] {
-							accept_connection_for_socket_with_index( i );
+						[this, i, &lifetime_guard] {
+							accept_connection_for_socket_with_index(
+									i, std::move( lifetime_guard ) );
 						} );
 			}
 			else
 			{
+				m_connection_count_limiter->accept_failed();
+
+				// Acceptor is closed, nothing to do.
+				if( asio_ns::error::operation_aborted == ec ||
+						!m_acceptor.is_open() )
+					return;
+
 				// Something goes wrong with connection.
 				restinio::utils::log_error_noexcept( m_logger,
 					[&]{
@@ -353,6 +523,14 @@ class acceptor_t final
 							i,
 							ec.message() );
 					} );
+
+				// Since v.0.6.9 accepting isn't continued immediately
+				// if there are no resources for new connections.
+				if( acceptor_details::is_resource_exhaustion_error( ec ) )
+				{
+					retry_accept_after_delay( i );
+					return;
+				}
 			}
 
 			// Continue accepting.
@@ -370,7 +548,9 @@ class acceptor_t final
 		void
 		accept_connection_for_socket_with_index(
 			//! socket index in the pool of sockets.
-			std::size_t i )
+			std::size_t i,
+			//! The place of the connection in connection_count_limiter.
+			connection_lifetime_guard_t lifetime_guard )
 		{
 			auto incoming_socket = this->move_socket( i );
 
@@ -405,7 +585,8 @@ class acceptor_t final
 				// Acception of the connection can be continued.
 				do_accept_current_connection(
 						std::move(incoming_socket),
-						remote_endpoint );
+						remote_endpoint,
+						std::move(lifetime_guard) );
 			break;
 			}
 		}
@@ -413,12 +594,14 @@ class acceptor_t final
 		void
 		do_accept_current_connection(
 			stream_socket_t incoming_socket,
-			endpoint_t remote_endpoint )
+			endpoint_t remote_endpoint,
+			connection_lifetime_guard_t lifetime_guard )
 		{
 			auto create_and_init_connection =
 				[sock = std::move(incoming_socket),
 				factory = m_connection_factory,
 				ep = std::move(remote_endpoint),
+				guard = std::move(lifetime_guard),
 				logger = &m_logger]() mutable noexcept {
 					// NOTE: this code block shouldn't throw!
 					restinio::utils::suppress_exceptions(
@@ -430,7 +613,7 @@ class acceptor_t final
 								// the case of an error. Because of that there is
 								// no need to check the value returned.
 								auto conn = factory->create_new_connection(
-										std::move(sock), std::move(ep) );
+										std::move(sock), std::move(ep), std::move(guard) );
 
 								// Start waiting for request message.
 								conn->init();
@@ -464,6 +647,10 @@ class acceptor_t final
 
 			m_acceptor.close();
 
+			// Pending retries of failed accepts should be cancelled.
+			for( auto & timer : m_accept_retry_timers )
+				timer.cancel();
+
 			m_logger.info( [&]{
 				return fmt::format( "server closed on {}", ep );
 			} );
@@ -493,6 +680,18 @@ class acceptor_t final
 		connection_factory_shared_ptr_t m_connection_factory;
 
 		logger_t & m_logger;
+
+		//! Counter of alive connections.
+		//! @since v.0.6.9
+		connection_count_limiter_handle_t m_connection_count_limiter;
+
+		//! Timers for retrying failed accepts (one per accept slot).
+		//! @since v.0.6.9
+		std::vector< asio_ns::steady_timer > m_accept_retry_timers;
+
+		//! Current delays for retrying failed accepts.
+		//! @since v.0.6.9
+		std::vector< std::chrono::milliseconds > m_accept_retry_delays;
 };
 
 } /* namespace impl */
@@ -17,14 +17,18 @@
 #include <restinio/exception.hpp>
 #include <restinio/http_headers.hpp>
 #include <restinio/request_handler.hpp>
+#include <restinio/incoming_body.hpp>
+#include <restinio/incoming_http_msg_limits.hpp>
 #include <restinio/impl/connection_base.hpp>
 #include <restinio/impl/header_helpers.hpp>
 #include <restinio/impl/response_coordinator.hpp>
 #include <restinio/impl/connection_settings.hpp>
 #include <restinio/impl/fixed_buffer.hpp>
+#include <restinio/impl/connection_pool.hpp>
 #include <restinio/impl/write_group_output_ctx.hpp>
 #include <restinio/impl/executor_wrapper.hpp>
 #include <restinio/impl/sendfile_operation.hpp>
+#include <restinio/impl/connection_count_limiter.hpp>
 
 #include <restinio/utils/impl/safe_uint_truncate.hpp>
 #include <restinio/utils/at_scope_exit.hpp>
@@ -35,6 +39,22 @@ namespace restinio
 namespace impl
 {
 
+//
+// limit_violation_t
+//
+
+//! Kind of violation of limits for incoming HTTP message.
+/*!
+ * @since v.0.6.9
+ */
+enum class limit_violation_t : std::uint8_t
+{
+	none,
+	url_too_long,
+	header_fields_too_large,
+	body_too_large
+};
+
 //
 // http_parser_ctx_t
 //
@@ -61,15 +81,158 @@ struct http_parser_ctx_t
 	//! Flag: is http message parsed completely.
 	bool m_message_complete{ false };
 
+	//! Flag: should the parser be paused when headers are parsed.
+	/*!
+	 * This is a configuration value, it isn't changed by reset().
+	 *
+	 * @since v.0.6.9
+	 */
+	bool m_pause_on_headers_complete{ false };
+
+	//! Flag: are headers of http message parsed completely.
+	/*!
+	 * Is set only if m_pause_on_headers_complete is true.
+	 *
+	 * @since v.0.6.9
+	 */
+	bool m_headers_complete{ false };
+
+	//! Sink for the body of the current request.
+	/*!
+	 * If it is not empty then the body is passed to the sink
+	 * instead of accumulation in m_body.
+	 *
+	 * @since v.0.6.9
+	 */
+	incoming_body::sink_handle_t m_body_sink;
+
+	//! Flag: the reading of the body is paused by the body sink.
+	/*!
+	 * @since v.0.6.9
+	 */
+	bool m_body_reading_paused{ false };
+
+	//! Flag: `100 Continue` should be sent when responses to
+	//! previous requests are written.
+	/*!
+	 * @since v.0.6.9
+	 */
+	bool m_continue_response_postponed{ false };
+
+	//! Flag: the body should be read but not stored.
+	/*!
+	 * @since v.0.6.9
+	 */
+	bool m_discard_body{ false };
+
+	//! Limits for incoming HTTP message.
+	/*!
+	 * This is a configuration value, it isn't changed by reset().
+	 *
+	 * @since v.0.6.9
+	 */
+	incoming_http_msg_limits_t m_limits;
+
+	//! Counters for checking limits.
+	//! \{
+	std::size_t m_field_count{ 0u };
+	std::size_t m_current_field_value_size{ 0u };
+	std::uint64_t m_body_size{ 0u };
+	//! \}
+
+	//! The limit that was exceeded (if any).
+	/*!
+	 * @since v.0.6.9
+	 */
+	limit_violation_t m_limit_violation{ limit_violation_t::none };
+
+	//! Flag: should header fields be stored in an arena.
+	/*!
+	 * This is a configuration value, it isn't changed by reset().
+	 *
+	 * @since v.0.6.9
+	 */
+	bool m_use_header_fields_arena{ false };
+
+	//! Flag: header fields of the current request should be stored
+	//! in an arena.
+	/*!
+	 * Is set by reset() if m_use_header_fields_arena is true and is
+	 * dropped when headers of the current request are parsed.
+	 *
+	 * @since v.0.6.9
+	 */
+	bool m_header_fields_to_arena{ false };
+
+	//! Arena for header fields of the current request.
+	/*!
+	 * It's created by the first header field, so there is no
+	 * allocation for a connection that waits for a request.
+	 *
+	 * Is not empty only if m_header_fields_to_arena is true.
+	 *
+	 * @since v.0.6.9
+	 */
+	header_fields_arena_shared_ptr_t m_header_fields_arena;
+
+	//! Handling of parts of header fields from parser callbacks.
+	/*!
+	 * @since v.0.6.9
+	 */
+	//! \{
+	void
+	start_field_name( string_view_t part )
+	{
+		if( m_header_fields_to_arena && !m_header_fields_arena )
+		{
+			m_header_fields_arena = std::make_shared< header_fields_arena_t >();
+			use_fields_arena_accessor( m_header, m_header_fields_arena );
+		}
+
+		if( m_header_fields_arena )
+			m_header_fields_arena->start_name( part );
+		else
+			m_current_field_name.assign( part.data(), part.size() );
+	}
+
+	void
+	append_field_name( string_view_t part )
+	{
+		if( m_header_fields_arena )
+			m_header_fields_arena->append_name( part );
+		else
+			m_current_field_name.append( part.data(), part.size() );
+	}
+
+	std::size_t
+	current_field_name_size() const noexcept
+	{
+		return m_header_fields_arena ?
+				m_header_fields_arena->last_name_size() :
+				m_current_field_name.size();
+	}
+	//! \}
+
 	//! Prepare context to handle new request.
 	void
 	reset()
 	{
 		m_header = http_request_header_t{};
+		m_header_fields_to_arena = m_use_header_fields_arena;
+		m_header_fields_arena.reset();
 		m_body.clear();
 		m_current_field_name.clear();
 		m_last_was_value = true;
 		m_message_complete = false;
+		m_headers_complete = false;
+		m_body_sink.reset();
+		m_body_reading_paused = false;
+		m_continue_response_postponed = false;
+		m_discard_body = false;
+		m_field_count = 0u;
+		m_current_field_value_size = 0u;
+		m_body_size = 0u;
+		m_limit_violation = limit_violation_t::none;
 	}
 };
 
@@ -108,7 +271,7 @@ create_parser_settings() noexcept
 
 	parser_settings.on_headers_complete =
 		[]( http_parser * parser ) -> int {
-			return restinio_headers_complete_cb( parser );
+			return restinio_headers_complete_cb< Http_Methods >( parser );
 		};
 
 	parser_settings.on_body =
@@ -151,9 +314,26 @@ enum class connection_upgrade_stage_t : std::uint8_t
 //! Data associated with connection read routine.
 struct connection_input_t
 {
-	connection_input_t( std::size_t buffer_size )
-		:	m_buf{ buffer_size }
-	{}
+	connection_input_t(
+		std::size_t buffer_size,
+		//! Already allocated storage for the input buffer.
+		//! @since v.0.6.9
+		std::vector< char > buffer_storage,
+		bool pause_on_headers_complete,
+		const incoming_http_msg_limits_t & limits,
+		bool use_header_fields_arena,
+		//! Should the buffer be released while connection waits
+		//! for a new request?
+		//! @since v.0.6.9
+		bool release_idle_buffer )
+		:	m_buf{ buffer_size, std::move( buffer_storage ) }
+		,	m_release_idle_buffer{ release_idle_buffer }
+		,	m_adaptive_buffer_size{ buffer_size }
+	{
+		m_parser_ctx.m_pause_on_headers_complete = pause_on_headers_complete;
+		m_parser_ctx.m_limits = limits;
+		m_parser_ctx.m_use_header_fields_arena = use_header_fields_arena;
+	}
 
 	//! HTTP-parser.
 	//! \{
@@ -171,6 +351,50 @@ struct connection_input_t
 	//! Flag to track whether read operation is performed now.
 	bool m_read_operation_is_running{ false };
 
+	//! Is the buffer released while connection waits for a new request?
+	/*!
+		If it is true the buffer is borrowed from
+		thread_local_buffers_cache_t only when there is data to read.
+		The size of the buffer is calculated by m_adaptive_buffer_size.
+
+		@since v.0.6.9
+	*/
+	const bool m_release_idle_buffer;
+
+	//! Size of the buffer for the case when m_release_idle_buffer is true.
+	//! @since v.0.6.9
+	adaptive_buffer_size_t m_adaptive_buffer_size;
+
+	//! Return the buffer if there are no unconsumed bytes in it.
+	/*!
+		The buffer is kept if a read operation is in progress:
+		the operation reads data into that buffer.
+
+		@since v.0.6.9
+	*/
+	void
+	release_buffer_if_idle() noexcept
+	{
+		if( m_release_idle_buffer && !m_read_operation_is_running &&
+				0u == m_buf.length() && m_buf.has_storage() )
+			thread_local_buffers_cache_t::release( m_buf.release_storage() );
+	}
+
+	//! Borrow the buffer if it was released.
+	/*!
+		@since v.0.6.9
+	*/
+	void
+	acquire_buffer_if_released()
+	{
+		if( !m_buf.has_storage() )
+		{
+			const auto size = m_adaptive_buffer_size.current();
+			m_buf.reset_storage(
+					size, thread_local_buffers_cache_t::acquire( size ) );
+		}
+	}
+
 	//! Prepare parser for reading new http-message.
 	void
 	reset_parser()
@@ -196,6 +420,46 @@ prepare_connection_and_start_read(
 	start_read_cb();
 }
 
+//
+// wait_for_readability_t
+//
+
+/*!
+	@brief Helper for waiting for incoming data without reading it.
+
+	It is supported only for plain TCP sockets. TLS-socket can have
+	already decrypted data that is not seen by the OS.
+
+	@since v.0.6.9
+*/
+template< typename Socket >
+struct wait_for_readability_t
+{
+	static constexpr bool is_supported = false;
+
+	template< typename Handler >
+	static void
+	async_wait( Socket &, Handler && )
+	{
+		throw exception_t{ "waiting for readability isn't supported" };
+	}
+};
+
+template<>
+struct wait_for_readability_t< asio_ns::ip::tcp::socket >
+{
+	static constexpr bool is_supported = true;
+
+	template< typename Handler >
+	static void
+	async_wait( asio_ns::ip::tcp::socket & socket, Handler && handler )
+	{
+		socket.async_wait(
+				asio_ns::ip::tcp::socket::wait_read,
+				std::forward< Handler >( handler ) );
+	}
+};
+
 // An overload for the case of non-TLS-connection.
 inline tls_socket_t *
 make_tls_socket_pointer_for_state_listener(
@@ -246,14 +510,56 @@ class connection_t final
 			//! Settings that are common for connections.
 			connection_settings_handle_t< Traits > settings,
 			//! Remote endpoint for that connection.
-			endpoint_t remote_endpoint )
+			endpoint_t remote_endpoint,
+			//! The place of the connection in connection_count_limiter.
+			//! @since v.0.6.9
+			connection_lifetime_guard_t lifetime_guard )
+			:	connection_t{
+					conn_id,
+					std::move( socket ),
+					std::move( settings ),
+					std::move( remote_endpoint ),
+					std::move( lifetime_guard ),
+					pooled_connection_storage_t{} }
+		{}
+
+		connection_t(
+			//! Connection id.
+			connection_id_t conn_id,
+			//! Connection socket.
+			stream_socket_t && socket,
+			//! Settings that are common for connections.
+			connection_settings_handle_t< Traits > settings,
+			//! Remote endpoint for that connection.
+			endpoint_t remote_endpoint,
+			//! The place of the connection in connection_count_limiter.
+			connection_lifetime_guard_t lifetime_guard,
+			//! Already allocated storages for the connection.
+			/*!
+				@since v.0.6.9
+			*/
+			pooled_connection_storage_t storage )
 			:	connection_base_t{ conn_id }
 			,	executor_wrapper_base_t{ socket.get_executor() }
 			,	m_socket{ std::move( socket ) }
 			,	m_settings{ std::move( settings ) }
 			,	m_remote_endpoint{ std::move( remote_endpoint ) }
-			,	m_input{ m_settings->m_buffer_size }
-			,	m_response_coordinator{ m_settings->m_max_pipelined_requests }
+			,	m_lifetime_guard{ std::move( lifetime_guard ) }
+			,	m_input{
+					m_settings->m_buffer_size,
+					std::move( storage.m_input_buffer ),
+					connection_settings_t< Traits >::has_actual_body_sink_factory ||
+					connection_settings_t< Traits >::has_actual_pre_handler,
+					m_settings->m_incoming_http_msg_limits,
+					std::is_same<
+							typename Traits::incoming_header_storage_t,
+							incoming_header_storage::arena_views_t >::value,
+					m_settings->m_release_idle_input_buffers &&
+					wait_for_readability_t< stream_socket_t >::is_supported }
+			,	m_write_output_ctx{ std::move( storage.m_asio_bufs ) }
+			,	m_response_coordinator{
+					m_settings->m_max_pipelined_requests,
+					std::move( storage.m_response_contexts ) }
 			,	m_timer_guard{ m_settings->create_timer_guard() }
 			,	m_request_handler{ *( m_settings->m_request_handler ) }
 			,	m_logger{ *( m_settings->m_logger ) }
@@ -281,6 +587,20 @@ class connection_t final
 						"[connection:{}] destructor called",
 						connection_id() );
 				} );
+
+			// Body sink should know that the body won't be completed.
+			interrupt_body_sink();
+
+			// Since v.0.6.9 dynamic storages can be reused by
+			// next connections.
+			if( m_settings->m_connection_pool )
+			{
+				m_settings->m_connection_pool->release_storage(
+					pooled_connection_storage_t{
+						m_input.m_buf.release_storage(),
+						m_write_output_ctx.release_asio_bufs_storage(),
+						m_response_coordinator.release_storage() } );
+			}
 		}
 
 		void
@@ -347,6 +667,10 @@ class connection_t final
 			}
 			else
 			{
+				// Since v.0.6.9 the buffer isn't held by an idle connection
+				// (if it is enabled in settings).
+				m_input.release_buffer_if_idle();
+
 				// Next request (if any) must be obtained from socket.
 				consume_message();
 			}
@@ -360,13 +684,17 @@ class connection_t final
 
 			upgrade_internals_t(
 				connection_settings_handle_t< Traits > settings,
-				stream_socket_t socket )
+				stream_socket_t socket,
+				connection_lifetime_guard_t lifetime_guard )
 				:	m_settings{ std::move( settings ) }
 				,	m_socket{ std::move( socket ) }
+				,	m_lifetime_guard{ std::move( lifetime_guard ) }
 			{}
 
 			connection_settings_handle_t< Traits > m_settings;
 			stream_socket_t m_socket;
+			//! @since v.0.6.9
+			connection_lifetime_guard_t m_lifetime_guard;
 		};
 
 		//! Move socket out of connection.
@@ -375,7 +703,8 @@ class connection_t final
 		{
 			return upgrade_internals_t{
 				m_settings,
-				std::move( m_socket ) };
+				std::move( m_socket ),
+				std::move( m_lifetime_guard ) };
 		}
 
 	private:
@@ -393,17 +722,10 @@ class connection_t final
 
 
 				m_input.m_read_operation_is_running = true;
-				m_socket.async_read_some(
-					m_input.m_buf.make_asio_buffer(),
-					asio_ns::bind_executor(
-						this->get_executor(),
-						[this, ctx = shared_from_this()]
-						// NOTE: this lambda is noexcept since v.0.6.0.
-						( const asio_ns::error_code & ec,
-							std::size_t length ) noexcept {
-							m_input.m_read_operation_is_running = false;
-							RESTINIO_ENSURE_NOEXCEPT_CALL( after_read( ec, length ) );
-						} ) );
+				if( m_input.m_buf.has_storage() )
+					start_read_some();
+				else
+					wait_for_readability();
 			}
 			else
 			{
@@ -415,10 +737,75 @@ class connection_t final
 			}
 		}
 
+		//! Initiate read operation.
+		/*!
+			@since v.0.6.9
+		*/
+		void
+		start_read_some()
+		{
+			m_socket.async_read_some(
+				m_input.m_buf.make_asio_buffer(),
+				asio_ns::bind_executor(
+					this->get_executor(),
+					[this, ctx = shared_from_this()]
+					// NOTE: this lambda is noexcept since v.0.6.0.
+					( const asio_ns::error_code & ec,
+						std::size_t length ) noexcept {
+						m_input.m_read_operation_is_running = false;
+						RESTINIO_ENSURE_NOEXCEPT_CALL( after_read( ec, length ) );
+					} ) );
+		}
+
+		//! Wait for incoming data without holding the input buffer.
+		/*!
+			The buffer is borrowed when data arrives.
+
+			@since v.0.6.9
+		*/
+		void
+		wait_for_readability()
+		{
+			wait_for_readability_t< stream_socket_t >::async_wait(
+				m_socket,
+				asio_ns::bind_executor(
+					this->get_executor(),
+					[this, ctx = shared_from_this()]
+					( const asio_ns::error_code & ec ) noexcept {
+						if( ec )
+						{
+							m_input.m_read_operation_is_running = false;
+							RESTINIO_ENSURE_NOEXCEPT_CALL( after_read( ec, 0u ) );
+							return;
+						}
+
+						try
+						{
+							m_input.acquire_buffer_if_released();
+							start_read_some();
+						}
+						catch( const std::exception & x )
+						{
+							m_input.m_read_operation_is_running = false;
+							trigger_error_and_close( [&] {
+									return fmt::format(
+											"[connection:{}] unable to start reading "
+											"of incoming data: {}",
+											connection_id(),
+											x.what() );
+								} );
+						}
+					} ) );
+		}
+
 		//! Handle read operation result.
 		inline void
 		after_read( const asio_ns::error_code & ec, std::size_t length ) noexcept
 		{
+			if( !ec && m_input.m_release_idle_buffer )
+				m_input.m_adaptive_buffer_size.on_read(
+						m_input.m_buf.size(), length );
+
 			if( !ec )
 			{
 				// Exceptions shouldn't go out of `after_read`.
@@ -507,6 +894,15 @@ class connection_t final
 			if( HPE_OK != parser.http_errno &&
 				HPE_PAUSED != parser.http_errno )
 			{
+				if( limit_violation_t::none !=
+					m_input.m_parser_ctx.m_limit_violation )
+				{
+					// Some limit is exceeded, the client should be
+					// informed about that.
+					handle_limit_violation();
+					return;
+				}
+
 				// PARSE ERROR:
 				auto err = HTTP_PARSER_ERRNO( &parser );
 
@@ -527,10 +923,328 @@ class connection_t final
 			{
 				on_request_message_complete();
 			}
+			else if( m_input.m_parser_ctx.m_headers_complete )
+			{
+				on_request_headers_complete();
+			}
+			else if( m_input.m_parser_ctx.m_body_reading_paused )
+			{
+				m_logger.trace( [&]{
+					return fmt::format(
+							"[connection:{}] reading of request body paused",
+							connection_id() );
+				} );
+
+				// There is no pending read operation now, so the connection
+				// should keep itself alive until the sink resumes the reading.
+				m_paused_reading_holder = shared_from_this();
+
+				// The read timeout doesn't run while the sink holds
+				// the reading, but the pause itself is limited.
+				suspend_read_timeout();
+
+				// Nothing to do until the body sink resumes reading.
+			}
+			else
+				consume_message();
+		}
+
+		//! Reject a request that exceeds limits for incoming HTTP messages.
+		/*!
+		 * @since v.0.6.9
+		 */
+		void
+		handle_limit_violation()
+		{
+			const auto & stats = m_settings->m_incoming_http_msg_limits_stats;
+
+			const auto status_line = [&]{
+				switch( m_input.m_parser_ctx.m_limit_violation )
+				{
+					case limit_violation_t::url_too_long:
+						if( stats ) stats->inc_url_too_long();
+						return status_uri_too_long();
+
+					case limit_violation_t::header_fields_too_large:
+						if( stats ) stats->inc_header_fields_too_large();
+						return status_request_header_fields_too_large();
+
+					default:
+						if( stats ) stats->inc_body_too_large();
+						return status_payload_too_large();
+				}
+			}();
+
+			m_logger.warn( [&]{
+				return fmt::format(
+						"[connection:{}] limit for incoming message exceeded: {}",
+						connection_id(),
+						status_line.reason_phrase() );
+			} );
+
+			reject_incoming_request( status_line );
+		}
+
+		//! Continue parsing of data that is already in the buffer
+		//! or start a new read operation.
+		/*!
+		 * @since v.0.6.9
+		 */
+		void
+		continue_consuming()
+		{
+			if( 0 != m_input.m_buf.length() )
+				consume_data( m_input.m_buf.bytes(), m_input.m_buf.length() );
 			else
 				consume_message();
 		}
 
+		//! Handle headers of a request before the reading of its body.
+		/*!
+		 * Is called only if a body sink factory or a pre-handler
+		 * is specified in traits.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		on_request_headers_complete()
+		{
+			auto & parser = m_input.m_parser;
+			auto & parser_ctx = m_input.m_parser_ctx;
+
+			parser_ctx.m_headers_complete = false;
+
+			if( connection_settings_t< Traits >::has_actual_pre_handler )
+			{
+				const auto verdict = m_settings->call_pre_handler(
+						pre_handler::incoming_info_t{
+								connection_id(),
+								m_remote_endpoint,
+								parser_ctx.m_header } );
+
+				if( !verdict.accepted() )
+				{
+					// The body won't be read, so the parser stays paused.
+					reject_incoming_request( verdict.status_line() );
+					return;
+				}
+
+				parser_ctx.m_discard_body =
+						pre_handler::body_policy_t::discard == verdict.body_policy();
+
+				send_continue_response_if_expected();
+			}
+
+			// There is no sense to create a sink for upgrade requests.
+			if( 0 == parser.upgrade && !parser_ctx.m_discard_body )
+			{
+				parser_ctx.m_body_sink = m_settings->make_body_sink(
+						parser_ctx.m_header,
+						incoming_body::resumer_t{
+								shared_from_concrete< connection_base_t >() } );
+			}
+
+			if( !parser_ctx.m_body_sink &&
+				!parser_ctx.m_discard_body &&
+				ULLONG_MAX != parser.content_length &&
+				0 < parser.content_length )
+			{
+				parser_ctx.m_body.reserve(
+						::restinio::utils::impl::uint64_to_size_t(
+								parser.content_length) );
+			}
+
+			http_parser_pause( &parser, 0 );
+			continue_consuming();
+		}
+
+		//! Answer to a request that is rejected before it is read completely.
+		/*!
+		 * The response has `Connection: close` header, so the connection
+		 * will be closed after writing it.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		reject_incoming_request(
+			const http_status_line_t & status_line )
+		{
+			const auto request_id = m_response_coordinator.register_new_request();
+
+			m_logger.trace( [&]{
+				return fmt::format(
+						"[connection:{}] incoming request rejected (#{}), "
+						"status: {}",
+						connection_id(),
+						request_id,
+						status_line.status_code().raw_code() );
+			} );
+
+			http_response_header_t header{ status_line };
+			header.connection( http_connection_header_t::close );
+			header.content_length( 0u );
+
+			writable_items_container_t bufs;
+			bufs.emplace_back( create_header_string( header ) );
+
+			write_response_parts_impl(
+				request_id,
+				response_output_flags_t{
+					response_parts_attr_t::final_parts,
+					response_connection_attr_t::connection_close },
+				write_group_t{ std::move( bufs ) } );
+		}
+
+		//! Send `100 Continue` if the client waits for it.
+		/*!
+		 * If there are responses to previous requests that aren't
+		 * written yet, the interim response is postponed until they
+		 * are written (see init_write()).
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		send_continue_response_if_expected()
+		{
+			const auto & parser = m_input.m_parser;
+			const auto & header = m_input.m_parser_ctx.m_header;
+
+			if( 1 == parser.http_major && 0 == parser.http_minor )
+				// HTTP/1.0 clients don't know about 100 Continue.
+				return;
+
+			const auto expect = header.opt_value_of( http_field::expect );
+			if( !expect ||
+				!impl::is_equal_caseless( *expect, string_view_t{ "100-continue" } ) )
+				return;
+
+			if( m_response_coordinator.empty() &&
+				!m_write_output_ctx.transmitting() )
+			{
+				send_continue_response();
+			}
+			else
+			{
+				m_logger.trace( [&]{
+					return fmt::format(
+							"[connection:{}] 100 Continue postponed until "
+							"previous responses are written",
+							connection_id() );
+				} );
+
+				m_input.m_parser_ctx.m_continue_response_postponed = true;
+			}
+		}
+
+		//! Start writing of `100 Continue`.
+		/*!
+		 * @since v.0.6.9
+		 */
+		void
+		send_continue_response()
+		{
+			m_logger.trace( [&]{
+				return fmt::format(
+						"[connection:{}] send 100 Continue",
+						connection_id() );
+			} );
+
+			m_input.m_parser_ctx.m_continue_response_postponed = false;
+
+			// The read should not be reinitiated after that write.
+			m_init_read_after_this_write = false;
+			m_write_output_ctx.start_next_write_group(
+					write_group_t{ create_continue_resp() } );
+			handle_current_write_ctx();
+		}
+
+		//! Resume reading of the body paused by a body sink.
+		/*!
+		 * Can be called from any thread, the actual resumption is
+		 * performed on the connection's executor.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		resume_incoming_body_reading() override
+		{
+			asio_ns::post(
+				this->get_executor(),
+				[ this, ctx = shared_from_this() ]
+				() noexcept
+				{
+					try
+					{
+						resume_incoming_body_reading_impl();
+					}
+					catch( const std::exception & ex )
+					{
+						trigger_error_and_close( [&]{
+							return fmt::format(
+								"[connection:{}] unable to resume reading "
+								"of request body: {}",
+								connection_id(),
+								ex.what() );
+						} );
+					}
+				} );
+		}
+
+		//! Should `Date` field be added to every response?
+		/*!
+		 * @since v.0.6.9
+		 */
+		bool
+		always_add_date_field() const noexcept override
+		{
+			return m_settings->m_always_add_date_field;
+		}
+
+		//! Actual resumption of reading of the body.
+		/*!
+		 * @since v.0.6.9
+		 */
+		void
+		resume_incoming_body_reading_impl()
+		{
+			auto & parser_ctx = m_input.m_parser_ctx;
+
+			// The connection will be held by a pending read operation
+			// (if any) from now.
+			const auto holder = std::move( m_paused_reading_holder );
+
+			if( !parser_ctx.m_body_reading_paused || !m_socket.is_open() )
+				// Reading isn't paused or connection is already closed.
+				return;
+
+			m_logger.trace( [&]{
+				return fmt::format(
+						"[connection:{}] reading of request body resumed",
+						connection_id() );
+			} );
+
+			parser_ctx.m_body_reading_paused = false;
+			http_parser_pause( &m_input.m_parser, 0 );
+			resume_read_timeout();
+			continue_consuming();
+		}
+
+		//! Inform body sink that the body won't be read completely.
+		/*!
+		 * @since v.0.6.9
+		 */
+		void
+		interrupt_body_sink() noexcept
+		{
+			auto & parser_ctx = m_input.m_parser_ctx;
+
+			if( parser_ctx.m_body_sink )
+			{
+				auto sink = std::move( parser_ctx.m_body_sink );
+				sink->on_interrupted();
+			}
+		}
+
 		//! Handle a given request message.
 		void
 		on_request_message_complete()
@@ -573,12 +1287,21 @@ class connection_t final
 					// so it is possible to omit this timer scheduling.
 					guard_request_handling_operation();
 
+					// Since v.0.6.9 the body can be passed to a sink.
+					// The sink is informed about the completion of the body
+					// and is detached from the parser context.
+					incoming_body::sink_handle_t body_sink =
+							std::move( parser_ctx.m_body_sink );
+					if( body_sink )
+						body_sink->on_complete();
+
 					if( request_rejected() ==
 						m_request_handler(
 							std::make_shared< request_t >(
 								request_id,
 								std::move( parser_ctx.m_header ),
 								std::move( parser_ctx.m_body ),
+								std::move( body_sink ),
 								shared_from_concrete< connection_base_t >(),
 								m_remote_endpoint ) ) )
 					{
@@ -891,14 +1614,15 @@ class connection_t final
 
 			if( next_write_group )
 			{
-				m_logger.trace( [&]{
-					return fmt::format(
-						"[connection:{}] start next write group for response (#{}), "
-						"size: {}",
-						this->connection_id(),
-						next_write_group->second,
-						next_write_group->first.items_count() );
-				} );
+				trace_next_write_group( *next_write_group );
+
+				// Initialize write context with a new write group.
+				m_write_output_ctx.start_next_write_group(
+					std::move( next_write_group->first ) );
+
+				// Groups of already completed pipelined responses
+				// are sent by the same gather write (since v.0.6.9).
+				coalesce_ready_write_groups();
 
 				// Check if all response cells busy:
 				const bool response_coordinator_full_after =
@@ -909,43 +1633,85 @@ class connection_t final
 					response_coordinator_full_before &&
 					!response_coordinator_full_after;
 
-				if( 0 < next_write_group->first.status_line_size() )
-				{
-					// We need to extract status line out of the first buffer
-					assert(
-						writable_item_type_t::trivial_write_operation ==
-						next_write_group->first.items().front().write_type() );
-
-					m_logger.trace( [&]{
-						// Get status line:
-						const string_view_t
-							status_line{
-								asio_ns::buffer_cast< const char * >(
-									next_write_group->first.items().front().buf() ),
-								next_write_group->first.status_line_size() };
-
-						return
-							fmt::format(
-								"[connection:{}] start response (#{}): {}",
-								this->connection_id(),
-								next_write_group->second,
-								status_line );
-					} );
-				}
-
-				// Initialize write context with a new write group.
-				m_write_output_ctx.start_next_write_group(
-					std::move( next_write_group->first ) );
-
 				// Start the loop of sending data from current write group.
 				handle_current_write_ctx();
 			}
+			else if( m_input.m_parser_ctx.m_continue_response_postponed &&
+				!m_input.m_parser_ctx.m_message_complete &&
+				m_response_coordinator.empty() )
+			{
+				// All responses to previous requests are written.
+				send_continue_response();
+			}
 			else
 			{
 				handle_nothing_to_write();
 			}
 		}
 
+		//! Log the start of a write group.
+		void
+		trace_next_write_group(
+			const std::pair< write_group_t, request_id_t > & next_write_group )
+		{
+			m_logger.trace( [&]{
+				return fmt::format(
+					"[connection:{}] start next write group for response (#{}), "
+					"size: {}",
+					this->connection_id(),
+					next_write_group.second,
+					next_write_group.first.items_count() );
+			} );
+
+			if( 0 < next_write_group.first.status_line_size() )
+			{
+				// We need to extract status line out of the first buffer
+				assert(
+					writable_item_type_t::trivial_write_operation ==
+					next_write_group.first.items().front().write_type() );
+
+				m_logger.trace( [&]{
+					// Get status line:
+					const string_view_t
+						status_line{
+							asio_ns::buffer_cast< const char * >(
+								next_write_group.first.items().front().buf() ),
+							next_write_group.first.status_line_size() };
+
+					return
+						fmt::format(
+							"[connection:{}] start response (#{}): {}",
+							this->connection_id(),
+							next_write_group.second,
+							status_line );
+				} );
+			}
+		}
+
+		//! Add ready write groups to the current write operation.
+		/*!
+			Takes write groups from the response coordinator while
+			they can be written by the same gather write with
+			the current write group.
+
+			@since v.0.6.9
+		*/
+		void
+		coalesce_ready_write_groups()
+		{
+			for( const write_group_t * wg =
+					m_response_coordinator.front_ready_group();
+				wg && m_write_output_ctx.can_be_coalesced( *wg );
+				wg = m_response_coordinator.front_ready_group() )
+			{
+				auto next_write_group = m_response_coordinator.pop_ready_buffers();
+				trace_next_write_group( *next_write_group );
+
+				m_write_output_ctx.coalesce_write_group(
+					std::move( next_write_group->first ) );
+			}
+		}
+
 		// Use aliases for shorter names.
 		using none_write_operation_t = write_group_output_ctx_t::none_write_operation_t;
 		using trivial_write_operation_t = write_group_output_ctx_t::trivial_write_operation_t;
@@ -1332,6 +2098,25 @@ class connection_t final
 
 			RESTINIO_ENSURE_NOEXCEPT_CALL( m_response_coordinator.reset() );
 
+			// Body sink should know that the body won't be completed.
+			interrupt_body_sink();
+
+			// The connection can't be destroyed inside close(), so
+			// the reference held while the reading is paused is released
+			// later on the connection's executor.
+			restinio::utils::suppress_exceptions(
+				m_logger,
+				"connection.release_paused_reading_holder",
+				[this] {
+					if( m_paused_reading_holder )
+					{
+						asio_ns::post(
+							this->get_executor(),
+							[holder = m_paused_reading_holder]() noexcept {} );
+						m_paused_reading_holder.reset();
+					}
+				} );
+
 			restinio::utils::log_trace_noexcept( m_logger,
 				[&]{
 					return fmt::format(
@@ -1377,6 +2162,10 @@ class connection_t final
 		//! Remote endpoint for this connection.
 		const endpoint_t m_remote_endpoint;
 
+		//! The place of the connection in connection_count_limiter.
+		//! @since v.0.6.9
+		connection_lifetime_guard_t m_lifetime_guard;
+
 		//! Input routine.
 		connection_input_t m_input;
 
@@ -1516,8 +2305,98 @@ class connection_t final
 		{
 			if( m_response_coordinator.empty() )
 			{
+				if( m_input.m_parser_ctx.m_body_reading_paused )
+				{
+					// The timer will be started when the body sink
+					// resumes the reading.
+					m_suspended_read_timeout =
+						m_settings->m_read_next_http_message_timelimit;
+					guard_paused_body_reading();
+				}
+				else
+				{
+					m_suspended_read_timeout = nullopt;
+					schedule_operation_timeout_callback(
+						m_settings->m_read_next_http_message_timelimit,
+						&connection_t::handle_read_timeout );
+				}
+			}
+		}
+
+		//! A reference to the connection itself that is held while
+		//! the reading of the body is paused by a body sink.
+		/*!
+		 * @since v.0.6.9
+		 */
+		tcp_connection_ctx_handle_t m_paused_reading_holder;
+
+		//! The rest of the read timeout suspended while the body sink
+		//! holds the reading.
+		/*!
+		 * @since v.0.6.9
+		 */
+		optional_t< std::chrono::steady_clock::duration >
+				m_suspended_read_timeout;
+
+		void
+		handle_paused_body_reading_timeout()
+		{
+			handle_xxx_timeout( "wait for resumption of body reading" );
+		}
+
+		//! Start guard of the reading paused by a body sink.
+		/*!
+		 * @since v.0.6.9
+		 */
+		void
+		guard_paused_body_reading() noexcept
+		{
+			m_current_timeout_after = std::chrono::steady_clock::now() +
+				m_settings->m_paused_body_reading_timelimit;
+			m_current_timeout_cb =
+				&connection_t::handle_paused_body_reading_timeout;
+		}
+
+		//! Suspend the read timeout while reading is paused by a body sink.
+		/*!
+		 * The pause is guarded by its own timeout. The read timeout is
+		 * restarted by resume_read_timeout() when the reading is resumed.
+		 *
+		 * If another operation is guarded now then its timeout is kept,
+		 * the pause will be guarded by guard_read_operation() when
+		 * that operation is finished.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		suspend_read_timeout() noexcept
+		{
+			if( &connection_t::handle_read_timeout == m_current_timeout_cb )
+			{
+				const auto now = std::chrono::steady_clock::now();
+				m_suspended_read_timeout =
+					m_current_timeout_after > now ?
+						m_current_timeout_after - now :
+						std::chrono::steady_clock::duration::zero();
+
+				guard_paused_body_reading();
+			}
+		}
+
+		//! Restart the read timeout suspended by suspend_read_timeout().
+		/*!
+		 * @since v.0.6.9
+		 */
+		void
+		resume_read_timeout()
+		{
+			if( m_suspended_read_timeout )
+			{
+				const auto left = *m_suspended_read_timeout;
+				m_suspended_read_timeout = nullopt;
+
 				schedule_operation_timeout_callback(
-					m_settings->m_read_next_http_message_timelimit,
+					left,
 					&connection_t::handle_read_timeout );
 			}
 		}
@@ -1606,7 +2485,9 @@ class connection_factory_t
 		auto
 		create_new_connection(
 			stream_socket_t socket,
-			endpoint_t remote_endpoint )
+			endpoint_t remote_endpoint,
+			//! @since v.0.6.9
+			connection_lifetime_guard_t lifetime_guard )
 		{
 			using connection_type_t = connection_t< Traits >;
 
@@ -1615,11 +2496,27 @@ class connection_factory_t
 				(*m_socket_options_setter)( options );
 			}
 
+			// Since v.0.6.9 connection objects and their storages
+			// can be taken from the pool.
+			const auto & pool = m_connection_settings->m_connection_pool;
+			if( pool )
+			{
+				return std::allocate_shared< connection_type_t >(
+					connection_pool_allocator_t< connection_type_t >{ pool },
+					m_connection_id_counter++,
+					std::move( socket ),
+					m_connection_settings,
+					std::move( remote_endpoint ),
+					std::move( lifetime_guard ),
+					pool->acquire_storage() );
+			}
+
 			return std::make_shared< connection_type_t >(
 				m_connection_id_counter++,
 				std::move( socket ),
 				m_connection_settings,
-				std::move( remote_endpoint ) );
+				std::move( remote_endpoint ),
+				std::move( lifetime_guard ) );
 		}
 
 	private:
@@ -41,6 +41,28 @@ class connection_base_t
 			response_output_flags_t response_output_flags,
 			//! Part of the response data.
 			write_group_t wg ) = 0;
+
+		//! Resume reading of the incoming body paused by a body sink.
+		/*!
+		 * Default implementation does nothing.
+		 *
+		 * @since v.0.6.9
+		 */
+		virtual void
+		resume_incoming_body_reading()
+		{}
+
+		//! Should `Date` field be added to every response?
+		/*!
+		 * Default implementation returns false.
+		 *
+		 * @since v.0.6.9
+		 */
+		virtual bool
+		always_add_date_field() const noexcept
+		{
+			return false;
+		}
 };
 
 //! Alias for http connection handle.
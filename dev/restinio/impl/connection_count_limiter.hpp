@@ -0,0 +1,272 @@
+/*
+	restinio
+*/
+
+/*!
+	Limiter for the count of parallel connections.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <restinio/exception.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <functional>
+
+namespace restinio
+{
+
+namespace impl
+{
+
+class connection_count_limiter_t;
+
+//
+// connection_lifetime_guard_t
+//
+
+//! A guard that holds a place of a connection in connection_count_limiter.
+/*!
+	The place is released when the guard is destroyed.
+	The guard is owned by a connection object (and moved
+	to websocket connection in the case of connection upgrade).
+
+	@since v.0.6.9
+*/
+class connection_lifetime_guard_t
+{
+		friend class connection_count_limiter_t;
+
+		std::shared_ptr< connection_count_limiter_t > m_limiter;
+
+		connection_lifetime_guard_t(
+			std::shared_ptr< connection_count_limiter_t > limiter ) noexcept
+			:	m_limiter{ std::move( limiter ) }
+		{}
+
+	public:
+		//! Makes an empty guard that holds nothing.
+		connection_lifetime_guard_t() noexcept = default;
+
+		connection_lifetime_guard_t( const connection_lifetime_guard_t & ) = delete;
+		connection_lifetime_guard_t &
+		operator=( const connection_lifetime_guard_t & ) = delete;
+
+		connection_lifetime_guard_t(
+			connection_lifetime_guard_t && ) noexcept = default;
+
+		connection_lifetime_guard_t &
+		operator=( connection_lifetime_guard_t && other ) noexcept
+		{
+			connection_lifetime_guard_t tmp{ std::move( other ) };
+			std::swap( m_limiter, tmp.m_limiter );
+			return *this;
+		}
+
+		inline ~connection_lifetime_guard_t();
+};
+
+//
+// connection_count_limiter_t
+//
+
+//! Counter of alive connections and controller of accept operations.
+/*!
+	Every accept operation reserves a place for a new connection, so
+	the count of alive connections can't exceed the limit even if there
+	are several accept operations in parallel.
+
+	If there is no room for a new accept the accept slot is paused.
+	Paused slots are resumed one by one when connections are closed.
+
+	The limiter can be used from different threads.
+
+	@since v.0.6.9
+*/
+class connection_count_limiter_t
+	:	public std::enable_shared_from_this< connection_count_limiter_t >
+{
+		friend class connection_lifetime_guard_t;
+
+	public:
+		//! Type of callback for resuming paused accept slot.
+		/*!
+			It is called when a place for a new connection is reserved for
+			the slot. The callback is called on the thread on which the last
+			connection is closed and it is called without locking the limiter.
+
+			If the callback throws the slot remains paused.
+		*/
+		using resume_accept_cb_t = std::function< void( std::size_t ) >;
+
+		connection_count_limiter_t(
+			//! Max count of parallel connections. Zero means no limit.
+			std::size_t max_connections,
+			//! The count of accept slots.
+			std::size_t accept_slots_count )
+			:	m_max_connections{ max_connections }
+		{
+			m_paused_slots.reserve( accept_slots_count );
+		}
+
+		//! Set callback for resuming paused accept slots.
+		void
+		resume_accept_callback( resume_accept_cb_t cb )
+		{
+			auto holder = std::make_shared< const resume_accept_cb_t >(
+					std::move( cb ) );
+
+			std::lock_guard< std::mutex > lock{ m_lock };
+			m_resume_accept_cb = std::move( holder );
+		}
+
+		//! Try to reserve a place for a connection to be accepted.
+		/*!
+			@retval true accept can be started for @a slot.
+			@retval false accept for @a slot is paused. Slot will be
+			passed to resume_accept_cb when a place is freed.
+		*/
+		bool
+		try_start_accept( std::size_t slot ) noexcept
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+
+			if( has_room() )
+			{
+				++m_accepts_in_progress;
+				return true;
+			}
+
+			m_paused_slots.push_back( slot );
+			return false;
+		}
+
+		//! Accept operation failed, the reserved place is released.
+		void
+		accept_failed() noexcept
+		{
+			release( [this]{ --m_accepts_in_progress; } );
+		}
+
+		//! Accept operation completed, the reserved place is occupied.
+		connection_lifetime_guard_t
+		accepted() noexcept
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			--m_accepts_in_progress;
+			++m_connections_count;
+
+			return connection_lifetime_guard_t{ shared_from_this() };
+		}
+
+		//! Forget about paused slots.
+		/*!
+			Must be called before reopening of the acceptor.
+		*/
+		void
+		reset_paused_slots() noexcept
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			m_paused_slots.clear();
+		}
+
+		//! Max count of parallel connections. Zero means no limit.
+		std::size_t
+		max_connections() const noexcept
+		{
+			return m_max_connections;
+		}
+
+		//! The count of alive connections.
+		std::size_t
+		connections_count() const
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			return m_connections_count;
+		}
+
+		//! Is there at least one paused accept slot?
+		bool
+		is_accept_paused() const
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			return !m_paused_slots.empty();
+		}
+
+	private:
+		//! The callback is held by shared_ptr, so it can be taken
+		//! from the limiter without an allocation.
+		using resume_accept_cb_holder_t =
+			std::shared_ptr< const resume_accept_cb_t >;
+
+		bool
+		has_room() const noexcept
+		{
+			return 0u == m_max_connections ||
+				m_connections_count + m_accepts_in_progress < m_max_connections;
+		}
+
+		template< typename Decrement >
+		void
+		release( Decrement decrement ) noexcept
+		{
+			std::size_t slot_to_resume = 0u;
+			resume_accept_cb_holder_t cb;
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+				decrement();
+
+				if( !m_paused_slots.empty() && has_room() && m_resume_accept_cb )
+				{
+					slot_to_resume = m_paused_slots.back();
+					m_paused_slots.pop_back();
+					++m_accepts_in_progress;
+					cb = m_resume_accept_cb;
+				}
+			}
+
+			if( cb )
+			{
+				try
+				{
+					(*cb)( slot_to_resume );
+				}
+				catch( ... )
+				{
+					// The slot isn't resumed, so it is paused again.
+					// There is no reallocation because of reserved capacity.
+					std::lock_guard< std::mutex > lock{ m_lock };
+					--m_accepts_in_progress;
+					m_paused_slots.push_back( slot_to_resume );
+				}
+			}
+		}
+
+		const std::size_t m_max_connections;
+
+		mutable std::mutex m_lock;
+
+		std::size_t m_connections_count{ 0u };
+		std::size_t m_accepts_in_progress{ 0u };
+
+		std::vector< std::size_t > m_paused_slots;
+
+		resume_accept_cb_holder_t m_resume_accept_cb;
+};
+
+using connection_count_limiter_handle_t =
+	std::shared_ptr< connection_count_limiter_t >;
+
+inline connection_lifetime_guard_t::~connection_lifetime_guard_t()
+{
+	if( m_limiter )
+		m_limiter->release( [this]{ --m_limiter->m_connections_count; } );
+}
+
+} /* namespace impl */
+
+} /* namespace restinio */
@@ -0,0 +1,373 @@
+/*
+	restinio
+*/
+
+/*!
+	Pool of memory blocks and buffers for connection objects.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <restinio/asio_include.hpp>
+
+#include <restinio/impl/response_coordinator.hpp>
+
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <new>
+#include <cstddef>
+
+namespace restinio
+{
+
+namespace impl
+{
+
+//
+// pooled_connection_storage_t
+//
+
+//! Dynamic storages used by a connection object.
+/*!
+	A connection returns these storages to connection_pool_t when
+	it is destroyed. Next connection picks them up and reuses already
+	allocated memory.
+
+	@since v.0.6.9
+*/
+struct pooled_connection_storage_t
+{
+	//! Storage for input buffer.
+	std::vector< char > m_input_buffer;
+
+	//! Storage for asio buffers for gather write operations.
+	std::vector< asio_ns::const_buffer > m_asio_bufs;
+
+	//! Storage for contexts of pipelined responses.
+	std::vector< response_context_t > m_response_contexts;
+};
+
+//
+// connection_pool_t
+//
+
+//! Pool of memory blocks and storages for connection objects.
+/*!
+	Keeps up to `capacity` free memory blocks for connection objects and
+	up to `capacity` sets of connection storages for every thread
+	the pool is used on.
+
+	Free items are kept in thread-local lists, so there is no locking
+	and io threads of a server don't contend with each other.
+	An item released on one thread can be reused on that thread only.
+
+	Memory blocks are of the same size: the size is taken from the
+	first allocation. Requests of other sizes are served by
+	operator new.
+
+	There is one pool for a server. Thread-local lists of a destroyed
+	pool are freed on the next use of any pool on the thread (or at
+	the thread exit).
+
+	@since v.0.6.9
+*/
+class connection_pool_t
+{
+		//! Free items of the pool on a thread.
+		struct local_lists_t
+		{
+			//! Token of the owner pool.
+			std::weak_ptr< const void > m_owner;
+
+			std::vector< void * > m_free_blocks;
+			std::vector< pooled_connection_storage_t > m_free_storages;
+
+			local_lists_t(
+				std::weak_ptr< const void > owner,
+				std::size_t capacity )
+				:	m_owner{ std::move( owner ) }
+			{
+				// Release operations push items into containers without
+				// reallocation, so they can't throw.
+				m_free_blocks.reserve( capacity );
+				m_free_storages.reserve( capacity );
+			}
+
+			~local_lists_t()
+			{
+				for( auto * block : m_free_blocks )
+					::operator delete( block );
+			}
+		};
+
+		using local_lists_container_t =
+			std::vector< std::unique_ptr< local_lists_t > >;
+
+	public:
+		connection_pool_t( const connection_pool_t & ) = delete;
+		connection_pool_t & operator=( const connection_pool_t & ) = delete;
+		connection_pool_t( connection_pool_t && ) = delete;
+		connection_pool_t & operator=( connection_pool_t && ) = delete;
+
+		explicit connection_pool_t(
+			//! Max count of free items of every kind kept in the pool
+			//! for every thread.
+			std::size_t capacity )
+			:	m_capacity{ capacity }
+			,	m_token{ std::make_shared< char >( '\0' ) }
+		{}
+
+		~connection_pool_t()
+		{
+			// Lists of other threads will be freed later.
+			m_token.reset();
+			remove_expired_lists();
+		}
+
+		//! Get a memory block for connection object.
+		void *
+		allocate_block( std::size_t size )
+		{
+			std::size_t expected = 0u;
+			m_block_size.compare_exchange_strong( expected, size );
+
+			auto & lists = local_lists();
+			if( size == m_block_size.load( std::memory_order_relaxed ) &&
+					!lists.m_free_blocks.empty() )
+			{
+				void * block = lists.m_free_blocks.back();
+				lists.m_free_blocks.pop_back();
+				return block;
+			}
+
+			return ::operator new( size );
+		}
+
+		//! Return a memory block to the pool.
+		void
+		deallocate_block( void * block, std::size_t size ) noexcept
+		{
+			auto * lists = local_lists_if_possible();
+			if( lists &&
+					size == m_block_size.load( std::memory_order_relaxed ) &&
+					lists->m_free_blocks.size() < m_capacity )
+				lists->m_free_blocks.push_back( block );
+			else
+				::operator delete( block );
+		}
+
+		//! Get storages for a new connection.
+		/*!
+			Empty storages are returned if the pool is empty.
+		*/
+		pooled_connection_storage_t
+		acquire_storage()
+		{
+			pooled_connection_storage_t result;
+
+			auto & lists = local_lists();
+			if( !lists.m_free_storages.empty() )
+			{
+				result = std::move( lists.m_free_storages.back() );
+				lists.m_free_storages.pop_back();
+			}
+
+			return result;
+		}
+
+		//! Return storages of a destroyed connection to the pool.
+		void
+		release_storage( pooled_connection_storage_t storage ) noexcept
+		{
+			auto * lists = local_lists_if_possible();
+			if( lists && lists->m_free_storages.size() < m_capacity )
+				lists->m_free_storages.push_back( std::move( storage ) );
+			// Otherwise the storage is just destroyed.
+		}
+
+		//! Max count of free items of every kind for a thread.
+		std::size_t
+		capacity() const noexcept
+		{
+			return m_capacity;
+		}
+
+		//! The count of free memory blocks for the current thread.
+		std::size_t
+		free_blocks_count() const
+		{
+			const auto * lists = find_local_lists();
+			return lists ? lists->m_free_blocks.size() : 0u;
+		}
+
+		//! The count of free sets of storages for the current thread.
+		std::size_t
+		free_storages_count() const
+		{
+			const auto * lists = find_local_lists();
+			return lists ? lists->m_free_storages.size() : 0u;
+		}
+
+	private:
+		static local_lists_container_t &
+		all_local_lists() noexcept
+		{
+			thread_local local_lists_container_t lists;
+			return lists;
+		}
+
+		static void
+		remove_expired_lists() noexcept
+		{
+			auto & all = all_local_lists();
+			all.erase(
+				std::remove_if( all.begin(), all.end(),
+					[]( const std::unique_ptr< local_lists_t > & l ) noexcept {
+						return l->m_owner.expired();
+					} ),
+				all.end() );
+		}
+
+		bool
+		is_owner_of( const local_lists_t & lists ) const noexcept
+		{
+			return !lists.m_owner.owner_before( m_token ) &&
+				!m_token.owner_before( lists.m_owner );
+		}
+
+		local_lists_t *
+		find_local_lists() const noexcept
+		{
+			for( auto & l : all_local_lists() )
+				if( is_owner_of( *l ) )
+					return l.get();
+
+			return nullptr;
+		}
+
+		//! Get lists for the current thread, create them if necessary.
+		local_lists_t &
+		local_lists()
+		{
+			if( auto * lists = find_local_lists() )
+				return *lists;
+
+			// Lists of destroyed pools aren't needed anymore.
+			remove_expired_lists();
+
+			auto & all = all_local_lists();
+			all.push_back( std::make_unique< local_lists_t >( m_token, m_capacity ) );
+			return *all.back();
+		}
+
+		//! Get lists for the current thread.
+		/*!
+			Returns nullptr if lists can't be created.
+		*/
+		local_lists_t *
+		local_lists_if_possible() noexcept
+		{
+			try
+			{
+				return &local_lists();
+			}
+			catch( ... )
+			{
+				return nullptr;
+			}
+		}
+
+		const std::size_t m_capacity;
+
+		//! Token for identification of lists of that pool.
+		/*!
+			Thread-local lists hold weak references to it, so lists
+			of a destroyed pool are detected even if a new pool is
+			created at the same address.
+		*/
+		std::shared_ptr< const void > m_token;
+
+		//! The size of pooled memory blocks.
+		/*!
+			Zero means that there were no allocations yet.
+		*/
+		std::atomic< std::size_t > m_block_size{ 0u };
+};
+
+using connection_pool_handle_t = std::shared_ptr< connection_pool_t >;
+
+//
+// connection_pool_allocator_t
+//
+
+//! Allocator that takes memory blocks from connection_pool_t.
+/*!
+	Intended to be used with std::allocate_shared, so the connection
+	object and the control block of shared_ptr live in the same pooled
+	block.
+
+	The allocator holds the pool, so the pool is alive while there are
+	allocated blocks.
+
+	@since v.0.6.9
+*/
+template< typename T >
+class connection_pool_allocator_t
+{
+	template< typename U >
+	friend class connection_pool_allocator_t;
+
+	public:
+		using value_type = T;
+
+		explicit connection_pool_allocator_t(
+			connection_pool_handle_t pool ) noexcept
+			:	m_pool{ std::move( pool ) }
+		{}
+
+		template< typename U >
+		connection_pool_allocator_t(
+			const connection_pool_allocator_t< U > & other ) noexcept
+			:	m_pool{ other.m_pool }
+		{}
+
+		T *
+		allocate( std::size_t n )
+		{
+			static_assert( alignof(T) <= alignof(std::max_align_t),
+					"over-aligned types are not supported" );
+
+			return static_cast< T * >( m_pool->allocate_block( n * sizeof(T) ) );
+		}
+
+		void
+		deallocate( T * p, std::size_t n ) noexcept
+		{
+			m_pool->deallocate_block( p, n * sizeof(T) );
+		}
+
+		template< typename U >
+		bool
+		operator==( const connection_pool_allocator_t< U > & other ) const noexcept
+		{
+			return m_pool == other.m_pool;
+		}
+
+		template< typename U >
+		bool
+		operator!=( const connection_pool_allocator_t< U > & other ) const noexcept
+		{
+			return m_pool != other.m_pool;
+		}
+
+	private:
+		connection_pool_handle_t m_pool;
+};
+
+} /* namespace impl */
+
+} /* namespace restinio */
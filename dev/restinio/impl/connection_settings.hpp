@@ -14,6 +14,12 @@
 #include <http_parser.h>
 
 #include <restinio/connection_state_listener.hpp>
+#include <restinio/incoming_body.hpp>
+#include <restinio/pre_handler.hpp>
+#include <restinio/incoming_http_msg_limits.hpp>
+#include <restinio/http_headers.hpp>
+
+#include <restinio/impl/connection_pool.hpp>
 
 #include <restinio/utils/suppress_exceptions.hpp>
 
@@ -94,6 +100,112 @@ struct state_listener_holder_t< connection_state::noop_listener_t >
 	}
 };
 
+/*!
+ * @brief A class for holding actual body sink factory.
+ *
+ * This class holds shared pointer to actual body sink factory object
+ * and provides actual make_body_sink() implementation.
+ *
+ * @since v.0.6.9
+ */
+template< typename Factory >
+struct body_sink_factory_holder_t
+{
+	static constexpr bool has_actual_body_sink_factory = true;
+
+	std::shared_ptr< Factory > m_body_sink_factory;
+
+	template< typename Settings >
+	body_sink_factory_holder_t(
+		const Settings & settings )
+		:	m_body_sink_factory{ settings.body_sink_factory() }
+	{}
+
+	incoming_body::sink_handle_t
+	make_body_sink(
+		const http_request_header_t & header,
+		incoming_body::resumer_t resumer ) const
+	{
+		return m_body_sink_factory->make_sink( header, std::move(resumer) );
+	}
+};
+
+/*!
+ * @brief A specialization of body_sink_factory_holder for case of
+ * noop_sink_factory.
+ *
+ * This class doesn't hold anything and doesn't do anything.
+ *
+ * @since v.0.6.9
+ */
+template<>
+struct body_sink_factory_holder_t< incoming_body::noop_sink_factory_t >
+{
+	static constexpr bool has_actual_body_sink_factory = false;
+
+	template< typename Settings >
+	body_sink_factory_holder_t( const Settings & ) { /* nothing to do */ }
+
+	incoming_body::sink_handle_t
+	make_body_sink(
+		const http_request_header_t & /*header*/,
+		incoming_body::resumer_t /*resumer*/ ) const noexcept
+	{
+		return {};
+	}
+};
+
+/*!
+ * @brief A class for holding actual pre-handler.
+ *
+ * This class holds shared pointer to actual pre-handler object
+ * and provides actual call_pre_handler() implementation.
+ *
+ * @since v.0.6.9
+ */
+template< typename Pre_Handler >
+struct pre_handler_holder_t
+{
+	static constexpr bool has_actual_pre_handler = true;
+
+	std::shared_ptr< Pre_Handler > m_pre_handler;
+
+	template< typename Settings >
+	pre_handler_holder_t(
+		const Settings & settings )
+		:	m_pre_handler{ settings.pre_handler() }
+	{}
+
+	pre_handler::verdict_t
+	call_pre_handler( const pre_handler::incoming_info_t & info ) const
+	{
+		return m_pre_handler->on_headers_complete( info );
+	}
+};
+
+/*!
+ * @brief A specialization of pre_handler_holder for case of
+ * noop_pre_handler.
+ *
+ * This class doesn't hold anything and accepts every request.
+ *
+ * @since v.0.6.9
+ */
+template<>
+struct pre_handler_holder_t< pre_handler::noop_pre_handler_t >
+{
+	static constexpr bool has_actual_pre_handler = false;
+
+	template< typename Settings >
+	pre_handler_holder_t( const Settings & ) { /* nothing to do */ }
+
+	pre_handler::verdict_t
+	call_pre_handler( const pre_handler::incoming_info_t & /*info*/ ) const
+	{
+		return pre_handler::accept();
+	}
+};
+
 } /* namespace connection_settings_details */
 
 //
@@ -110,6 +222,10 @@ struct connection_settings_t final
 	:	public std::enable_shared_from_this< connection_settings_t< Traits > >
 	,	public connection_settings_details::state_listener_holder_t<
 				typename Traits::connection_state_listener_t >
+	,	public connection_settings_details::body_sink_factory_holder_t<
+				typename Traits::body_sink_factory_t >
+	,	public connection_settings_details::pre_handler_holder_t<
+				typename Traits::pre_handler_t >
 {
 	using timer_manager_t = typename Traits::timer_manager_t;
 	using timer_manager_handle_t = std::shared_ptr< timer_manager_t >;
@@ -120,6 +236,14 @@ struct connection_settings_t final
 			connection_settings_details::state_listener_holder_t<
 					typename Traits::connection_state_listener_t >;
 
+	using body_sink_factory_holder_t =
+			connection_settings_details::body_sink_factory_holder_t<
+					typename Traits::body_sink_factory_t >;
+
+	using pre_handler_holder_t =
+			connection_settings_details::pre_handler_holder_t<
+					typename Traits::pre_handler_t >;
+
 	connection_settings_t( const connection_settings_t & ) = delete;
 	connection_settings_t( const connection_settings_t && ) = delete;
 	connection_settings_t & operator = ( const connection_settings_t & ) = delete;
@@ -131,6 +255,8 @@ struct connection_settings_t final
 		http_parser_settings parser_settings,
 		timer_manager_handle_t timer_manager )
 		:	connection_state_listener_holder_t{ settings }
+		,	body_sink_factory_holder_t{ settings }
+		,	pre_handler_holder_t{ settings }
 		,	m_request_handler{ settings.request_handler() }
 		,	m_parser_settings{ parser_settings }
 		,	m_buffer_size{ settings.buffer_size() }
@@ -140,8 +266,20 @@ struct connection_settings_t final
 				settings.write_http_response_timelimit() }
 		,	m_handle_request_timeout{
 				settings.handle_request_timeout() }
+		,	m_paused_body_reading_timelimit{
+				settings.paused_body_reading_timelimit() }
 		,	m_max_pipelined_requests{ settings.max_pipelined_requests() }
+		,	m_incoming_http_msg_limits{ settings.incoming_http_msg_limits() }
+		,	m_incoming_http_msg_limits_stats{
+				settings.incoming_http_msg_limits_stats() }
 		,	m_logger{ settings.logger() }
+		,	m_release_idle_input_buffers{ settings.release_idle_input_buffers() }
+		,	m_always_add_date_field{ settings.always_add_date_field() }
+		,	m_connection_pool{
+				0u != settings.connection_pool_capacity() ?
+					std::make_shared< connection_pool_t >(
+							settings.connection_pool_capacity() ) :
+					connection_pool_handle_t{} }
 		,	m_timer_manager{ std::move( timer_manager ) }
 	{
 		if( !m_timer_manager )
@@ -170,11 +308,48 @@ struct connection_settings_t final
 	std::chrono::steady_clock::duration
 		m_handle_request_timeout{ std::chrono::seconds( 10 ) };
 
+	//! @since v.0.6.9
+	std::chrono::steady_clock::duration
+		m_paused_body_reading_timelimit{ std::chrono::seconds( 60 ) };
+
 	std::size_t m_max_pipelined_requests;
 
+	//! Limits for incoming HTTP messages.
+	/*!
+	 * @since v.0.6.9
+	 */
+	const incoming_http_msg_limits_t m_incoming_http_msg_limits;
+
+	//! Optional counters of violations of limits.
+	/*!
+	 * @since v.0.6.9
+	 */
+	const std::shared_ptr< incoming_http_msg_limits_stats_t >
+			m_incoming_http_msg_limits_stats;
+
 	const std::unique_ptr< logger_t > m_logger;
+
+	//! Should idle connections release their input buffers?
+	/*!
+	 * @since v.0.6.9
+	 */
+	const bool m_release_idle_input_buffers;
+
+	//! Should `Date` field be added to every response?
+	/*!
+	 * @since v.0.6.9
+	 */
+	const bool m_always_add_date_field;
 	//! \}
 
+	//! Pool for connection objects and their storages.
+	/*!
+	 * It is empty if pooling is turned off.
+	 *
+	 * @since v.0.6.9
+	 */
+	const connection_pool_handle_t m_connection_pool;
+
 	//! Create new timer guard.
 	auto
 	create_timer_guard()
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 
 #include <restinio/asio_include.hpp>
 
@@ -36,6 +37,30 @@ class fixed_buffer_t
 			m_buf.resize( size );
 		}
 
+		//! Initialize buffer with already allocated storage.
+		/*!
+			@since v.0.6.9
+		*/
+		fixed_buffer_t( std::size_t size, std::vector< char > storage )
+			:	m_buf{ std::move( storage ) }
+		{
+			m_buf.resize( size );
+		}
+
+		//! Take the storage away from the buffer.
+		/*!
+			The buffer must not be used after that.
+
+			@since v.0.6.9
+		*/
+		std::vector< char >
+		release_storage() noexcept
+		{
+			m_ready_pos = 0;
+			m_ready_length = 0;
+			return std::move( m_buf );
+		}
+
 		//! Make asio buffer for reading bytes from socket.
 		auto
 		make_asio_buffer() noexcept
@@ -59,6 +84,33 @@ class fixed_buffer_t
 			m_ready_pos += length; // Shift current pos.
 		}
 
+		//! Replace the storage of the buffer.
+		/*!
+			There must be no unconsumed bytes in the buffer.
+
+			@since v.0.6.9
+		*/
+		void
+		reset_storage( std::size_t size, std::vector< char > storage )
+		{
+			storage.resize( size );
+			m_buf = std::move( storage );
+			m_ready_pos = 0;
+			m_ready_length = 0;
+		}
+
+		//! Does the buffer have a storage for reading bytes?
+		/*!
+			@since v.0.6.9
+		*/
+		bool has_storage() const noexcept { return !m_buf.empty(); }
+
+		//! The size of the buffer.
+		/*!
+			@since v.0.6.9
+		*/
+		std::size_t size() const noexcept { return m_buf.size(); }
+
 		//! How many unconsumed bytes are there in buffer.
 		std::size_t length() const noexcept { return m_ready_length; }
 
@@ -82,6 +134,178 @@ class fixed_buffer_t
 		//! \}
 };
 
+//
+// basic_thread_local_buffers_cache_t
+//
+
+//! Cache of free buffers for the current thread.
+/*!
+	A buffer is given only if its capacity is close to the requested
+	size, so a user that needs a small buffer doesn't hold a big
+	one. Buffers that are too big are left for other users
+	(the count of cached buffers is limited) and a new buffer of
+	the requested size is allocated.
+
+	@tparam Tag a type that distinguishes caches for different kinds
+	of buffers. Every tag has its own set of buffers in every thread.
+
+	@since v.0.6.9
+*/
+template< typename Tag >
+class basic_thread_local_buffers_cache_t
+{
+		//! Max count of free buffers kept for a thread.
+		static constexpr std::size_t max_buffers_count = 64u;
+
+		static std::vector< std::vector< char > > &
+		free_buffers() noexcept
+		{
+			thread_local std::vector< std::vector< char > > buffers;
+			return buffers;
+		}
+
+	public:
+		//! Identity of the cache of the current thread.
+		/*!
+			Can be used to check that a buffer is released on the same
+			thread it was acquired on.
+		*/
+		static const void *
+		current_thread_cache() noexcept
+		{
+			return &free_buffers();
+		}
+
+		//! Get a buffer of the specified size.
+		/*!
+			The capacity of the returned buffer doesn't exceed
+			the doubled @a size.
+		*/
+		static std::vector< char >
+		acquire( std::size_t size )
+		{
+			auto & buffers = free_buffers();
+			if( buffers.capacity() < max_buffers_count )
+				// Space is reserved here because release() can't throw.
+				buffers.reserve( max_buffers_count );
+
+			// The best fit: the smallest buffer that is big enough.
+			auto best = buffers.end();
+			for( auto it = buffers.begin(); it != buffers.end(); ++it )
+				if( it->capacity() >= size && it->capacity() / 2u <= size &&
+						( buffers.end() == best || it->capacity() < best->capacity() ) )
+					best = it;
+
+			std::vector< char > result;
+			if( buffers.end() != best )
+			{
+				result = std::move( *best );
+				*best = std::move( buffers.back() );
+				buffers.pop_back();
+			}
+
+			result.resize( size );
+			return result;
+		}
+
+		//! Return a buffer to the cache.
+		/*!
+			The buffer is destroyed if the cache is full.
+		*/
+		static void
+		release( std::vector< char > buffer ) noexcept
+		{
+			auto & buffers = free_buffers();
+			if( !buffer.empty() && buffers.size() < buffers.capacity() )
+				buffers.push_back( std::move( buffer ) );
+		}
+};
+
+//
+// thread_local_buffers_cache_t
+//
+
+//! Tag for the cache of input buffers.
+struct input_buffers_cache_tag_t {};
+
+//! Cache of free input buffers for the current thread.
+/*!
+	Idle connections return their input buffers here and borrow a buffer
+	only when there is data to read.
+
+	@since v.0.6.9
+*/
+using thread_local_buffers_cache_t =
+	basic_thread_local_buffers_cache_t< input_buffers_cache_tag_t >;
+
+//
+// adaptive_buffer_size_t
+//
+
+//! Calculator of input buffer size based on observed reads.
+/*!
+	The size is doubled when a read fills the whole buffer and is halved
+	after a series of reads that use less than a quarter of the buffer.
+
+	The size is applied when a buffer is borrowed from
+	thread_local_buffers_cache_t. The cache doesn't give buffers much
+	bigger than requested, so a shrunk size really reduces memory held
+	by the connection.
+
+	@since v.0.6.9
+*/
+class adaptive_buffer_size_t
+{
+	public:
+		//! The minimal size of the buffer.
+		static constexpr std::size_t default_min_size = 1024u;
+
+		//! The count of small reads after that the buffer shrinks.
+		static constexpr unsigned small_reads_to_shrink = 8u;
+
+		explicit adaptive_buffer_size_t(
+			//! The max size of the buffer (the buffer_size from settings).
+			std::size_t max_size ) noexcept
+			:	m_min_size{ std::min( std::size_t{ default_min_size }, max_size ) }
+			,	m_max_size{ max_size }
+			,	m_current_size{ m_min_size }
+		{}
+
+		//! Current size for the buffer.
+		std::size_t current() const noexcept { return m_current_size; }
+
+		//! Update the size after a read.
+		void
+		on_read(
+			//! The size of the buffer used for reading.
+			std::size_t buffer_size,
+			//! The count of bytes read.
+			std::size_t length ) noexcept
+		{
+			if( length == buffer_size )
+			{
+				m_current_size = std::min( buffer_size * 2u, m_max_size );
+				m_small_reads = 0u;
+			}
+			else if( length * 4u <= m_current_size && m_current_size > m_min_size )
+			{
+				if( ++m_small_reads >= small_reads_to_shrink )
+				{
+					m_current_size = std::max( m_current_size / 2u, m_min_size );
+					m_small_reads = 0u;
+				}
+			}
+			else
+				m_small_reads = 0u;
+		}
+
+	private:
+		const std::size_t m_min_size;
+		const std::size_t m_max_size;
+		std::size_t m_current_size;
+		unsigned m_small_reads{ 0u };
+};
+
 } /* namespace impl */
 
 } /* namespace restinio */
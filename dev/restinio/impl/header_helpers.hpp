@@ -10,15 +10,83 @@
 
 #include <array>
 #include <numeric>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <ctime>
+#include <chrono>
 
 #include <restinio/buffers.hpp>
+#include <restinio/http_headers.hpp>
+#include <restinio/os.hpp>
+#include <restinio/impl/fixed_buffer.hpp>
 
 namespace restinio
 {
 
+//
+// make_date_field_value()
+//
+
+//! Format a timepoint to a string of a propper format.
+inline std::string
+make_date_field_value( std::time_t t )
+{
+	const auto tpoint = make_gmtime( t );
+
+	std::array< char, 64 > buf;
+	// TODO: is there a faster way to get time string?
+	strftime(
+		buf.data(),
+		buf.size(),
+		"%a, %d %b %Y %H:%M:%S GMT",
+		&tpoint );
+
+	return std::string{ buf.data() };
+}
+
+inline std::string
+make_date_field_value( std::chrono::system_clock::time_point tp )
+{
+	return make_date_field_value( std::chrono::system_clock::to_time_t( tp ) );
+}
+
 namespace impl
 {
 
+//
+// cached_date_field_value()
+//
+
+//! Get a formatted value of `Date` field for a time.
+/*!
+	Every thread keeps the last formatted value, so the value
+	is formatted only once a second even if there are thousands of
+	responses per second.
+
+	@since v.0.6.9
+*/
+inline const std::string &
+cached_date_field_value( std::time_t t )
+{
+	struct cache_t
+	{
+		std::time_t m_time{ static_cast< std::time_t >( -1 ) };
+		std::string m_value;
+	};
+
+	thread_local cache_t cache;
+
+	if( cache.m_time != t )
+	{
+		cache.m_value = make_date_field_value( t );
+		cache.m_time = t;
+	}
+
+	return cache.m_value;
+}
+
 //
 // ct_string_len
 //
@@ -36,118 +104,364 @@ enum class content_length_field_presence_t : std::uint8_t
 	skip_content_length
 };
 
+//! Should create_header_string() add `Date` field?
+/*!
+	@since v.0.6.9
+*/
+enum class date_field_presence_t : std::uint8_t
+{
+	//! Header fields are serialized as is.
+	as_is,
+	//! Current date is added if there is no `Date` field in the header.
+	add_if_absent
+};
+
 //
-// calculate_approx_buffer_size_for_header()
+// format_unsigned()
 //
 
-//! Calculate buffer size that is enough for serializing the buffer.
-inline std::size_t
-calculate_approx_buffer_size_for_header(
-	const http_response_header_t & h ) noexcept
-{
-	std::size_t result = 13; // "HTTP/1.1 xxx "
-	result += h.reason_phrase().size() + 2; // 2 is for "\r\n".
-	result += 26; // "Connection: keep-alive\r\n" is also enough for "Connection: close\r\n" (21).
-	result += 20 + 18; // "Content-Length: %llu\r\n" assume size is size_t, and 18 is always ok.
+//! Write decimal representation of a number just before \a end.
+/*!
+	@return pointer to the first written char.
 
-	result += 2; // Final "\r\n\r\n".
+	There must be enough room before \a end (20 chars are
+	always enough).
 
-	h.for_each_field( [&result](const auto & f) noexcept {
-			result += f.name().size() + 2 + f.value().size() + 2;
-		} );
+	@since v.0.6.9
+*/
+inline char *
+format_unsigned( std::uint64_t v, char * end ) noexcept
+{
+	static constexpr char digit_pairs[] =
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899";
+
+	while( v >= 100u )
+	{
+		const auto i = static_cast< std::size_t >( v % 100u ) * 2u;
+		v /= 100u;
+		*(--end) = digit_pairs[ i + 1u ];
+		*(--end) = digit_pairs[ i ];
+	}
 
-	return result;
+	if( v >= 10u )
+	{
+		const auto i = static_cast< std::size_t >( v ) * 2u;
+		*(--end) = digit_pairs[ i + 1u ];
+		*(--end) = digit_pairs[ i ];
+	}
+	else
+		*(--end) = static_cast< char >( '0' + v );
+
+	return end;
 }
 
 //
-// create_header_string()
+// header_serializer_t
 //
 
-//! Creates a string for http response header.
-inline std::string
-create_header_string(
-	const http_response_header_t & h,
-	content_length_field_presence_t content_length_field_presence =
-		content_length_field_presence_t::add_content_length,
-	std::size_t buffer_size = 0 )
+//! Serializer of http response header.
+/*!
+	The exact size of the serialized header is calculated in the
+	constructor, then write() copies all parts into a buffer of that size
+	in a single pass. There are no reallocations and no formatting
+	via printf-like functions.
+
+	\attention The serializer holds a reference to the header, so
+	the header must outlive the serializer.
+
+	@since v.0.6.9
+*/
+class header_serializer_t
 {
-	std::string result;
+	public:
+		header_serializer_t(
+			const http_response_header_t & h,
+			content_length_field_presence_t content_length_field_presence,
+			date_field_presence_t date_field_presence )
+			:	m_header{ h }
+			,	m_connection_field{ connection_field( h.connection() ) }
+		{
+			if( content_length_field_presence_t::add_content_length ==
+				content_length_field_presence )
+			{
+				auto * end = m_content_length.data() + m_content_length.size();
+				auto * begin = format_unsigned( h.content_length(), end );
+				m_content_length_value = string_view_t{
+						begin, static_cast< std::size_t >( end - begin ) };
+			}
+
+			if( date_field_presence_t::add_if_absent == date_field_presence &&
+				!h.has_field( http_field_t::date ) )
+			{
+				m_date_value = cached_date_field_value( std::time( nullptr ) );
+			}
+
+			m_size = calculate_size();
+		}
 
-	if( 0 != buffer_size )
-		result.reserve( buffer_size );
-	else
-		result.reserve( calculate_approx_buffer_size_for_header( h ) );
+		//! The exact size of the serialized header.
+		std::size_t
+		size() const noexcept
+		{
+			return m_size;
+		}
 
-	constexpr const char header_part1[] = "HTTP/";
-	result.append( header_part1, ct_string_len( header_part1 ) );
+		//! Write the header to \a dest.
+		/*!
+			\a dest must have room for size() chars.
 
-	result += static_cast<char>( '0' + h.http_major() );
-	result += '.';
-	result += static_cast<char>( '0' + h.http_minor() );
-	result += ' ';
+			@return pointer to the char following the last written one.
+		*/
+		char *
+		write( char * dest ) const noexcept
+		{
+			dest = append( dest, "HTTP/" );
+			*(dest++) = static_cast< char >( '0' + m_header.http_major() );
+			*(dest++) = '.';
+			*(dest++) = static_cast< char >( '0' + m_header.http_minor() );
+			*(dest++) = ' ';
 
-	const auto sc = h.status_code().raw_code();
+			const auto sc = m_header.status_code().raw_code();
 
 //FIXME: there should be a check for status_code in range 100..999.
 //May be a special type like bounded_value_t<100,999> must be used in
 //http_response_header_t.
-	result += '0' + ( sc / 100 ) % 10;
-	result += '0' + ( sc / 10 ) % 10;
-	result += '0' + ( sc ) % 10;
+			*(dest++) = static_cast< char >( '0' + ( sc / 100 ) % 10 );
+			*(dest++) = static_cast< char >( '0' + ( sc / 10 ) % 10 );
+			*(dest++) = static_cast< char >( '0' + ( sc ) % 10 );
+			*(dest++) = ' ';
+
+			dest = append( dest, m_header.reason_phrase() );
+			dest = append( dest, "\r\n" );
+
+			dest = append( dest, m_connection_field );
+
+			if( !m_content_length_value.empty() )
+			{
+				dest = append( dest, "Content-Length: " );
+				dest = append( dest, m_content_length_value );
+				dest = append( dest, "\r\n" );
+			}
+
+			if( !m_date_value.empty() )
+			{
+				dest = append( dest, "Date: " );
+				dest = append( dest, m_date_value );
+				dest = append( dest, "\r\n" );
+			}
+
+			m_header.for_each_field( [&dest]( const auto & f ) noexcept {
+				dest = append( dest, f.name() );
+				dest = append( dest, ": " );
+				dest = append( dest, f.value() );
+				dest = append( dest, "\r\n" );
+			} );
+
+			return append( dest, "\r\n" );
+		}
 
-	result += ' ';
-	result += h.reason_phrase();
+	private:
+		static string_view_t
+		connection_field( http_connection_header_t connection ) noexcept
+		{
+			switch( connection )
+			{
+				case http_connection_header_t::keep_alive:
+					return string_view_t{ "Connection: keep-alive\r\n" };
 
-	constexpr const char header_rn[] = "\r\n";
-	result.append( header_rn, ct_string_len( header_rn ) );
+				case http_connection_header_t::upgrade:
+					return string_view_t{ "Connection: Upgrade\r\n" };
 
-	switch( h.connection() )
-	{
-		case http_connection_header_t::keep_alive:
+				case http_connection_header_t::close:
+					break;
+			}
+
+			return string_view_t{ "Connection: close\r\n" };
+		}
+
+		template< std::size_t N >
+		static char *
+		append( char * dest, const char (&str)[N] ) noexcept
+		{
+			std::memcpy( dest, str, ct_string_len( str ) );
+			return dest + ct_string_len( str );
+		}
+
+		static char *
+		append( char * dest, string_view_t str ) noexcept
 		{
-			constexpr const char header_part2_1[] = "Connection: keep-alive\r\n";
-			result.append( header_part2_1, ct_string_len( header_part2_1 ) );
-			break;
+			// memcpy can't be called with nullptr even for zero size.
+			if( !str.empty() )
+				std::memcpy( dest, str.data(), str.size() );
+			return dest + str.size();
 		}
 
-		case http_connection_header_t::close:
+		std::size_t
+		calculate_size() const noexcept
 		{
-			constexpr const char header_part2_2[] = "Connection: close\r\n";
-			result.append( header_part2_2, ct_string_len( header_part2_2 ) );
-			break;
+			// "HTTP/1.1 xxx " + reason-phrase + "\r\n".
+			std::size_t result = 13u + m_header.reason_phrase().size() + 2u;
+
+			result += m_connection_field.size();
+
+			if( !m_content_length_value.empty() )
+				// "Content-Length: " + value + "\r\n".
+				result += 16u + m_content_length_value.size() + 2u;
+
+			if( !m_date_value.empty() )
+				// "Date: " + value + "\r\n".
+				result += 6u + m_date_value.size() + 2u;
+
+			m_header.for_each_field( [&result]( const auto & f ) noexcept {
+				result += f.name().size() + 2u + f.value().size() + 2u;
+			} );
+
+			// Final "\r\n".
+			return result + 2u;
 		}
 
-		case http_connection_header_t::upgrade:
+		const http_response_header_t & m_header;
+
+		const string_view_t m_connection_field;
+
+		//! Storage for digits of Content-Length value.
+		std::array< char, 20 > m_content_length;
+
+		//! Value of Content-Length field.
+		/*!
+			Empty if Content-Length field isn't added.
+		*/
+		string_view_t m_content_length_value;
+
+		//! Value of automatically added Date field.
+		/*!
+			Empty if Date field isn't added.
+		*/
+		string_view_t m_date_value;
+
+		std::size_t m_size;
+};
+
+//
+// header_buffers_cache_t
+//
+
+//! Tag for the cache of buffers for serialized headers.
+/*!
+	@since v.0.6.9
+*/
+struct header_buffers_cache_tag_t {};
+
+//! Cache of free buffers for serialized headers for the current thread.
+/*!
+	@since v.0.6.9
+*/
+using header_buffers_cache_t =
+	basic_thread_local_buffers_cache_t< header_buffers_cache_tag_t >;
+
+//
+// header_buffer_t
+//
+
+//! Buffer with serialized header.
+/*!
+	Can be used as a writable_item_t. The memory is taken from
+	header_buffers_cache_t and is returned there when the buffer
+	is destroyed (usually after the write operation is completed).
+
+	The memory is returned to the cache only if the buffer is destroyed
+	on the thread where it was created. When request handlers work on
+	a separate thread pool the headers are serialized on a handler
+	thread but are destroyed on an io thread. In that case the memory
+	is just freed, so the cache gives no benefit but io threads don't
+	collect buffers they never use.
+
+	@since v.0.6.9
+*/
+class header_buffer_t
+{
+	public:
+		explicit header_buffer_t( std::size_t size )
+			:	m_buffer{ header_buffers_cache_t::acquire( size ) }
+			,	m_owner_cache{ header_buffers_cache_t::current_thread_cache() }
+		{}
+
+		header_buffer_t( const header_buffer_t & ) = delete;
+		header_buffer_t & operator=( const header_buffer_t & ) = delete;
+
+		header_buffer_t( header_buffer_t && ) noexcept = default;
+		header_buffer_t & operator=( header_buffer_t && ) noexcept = default;
+
+		~header_buffer_t()
 		{
-			constexpr const char header_part2_3[] = "Connection: Upgrade\r\n";
-			result.append( header_part2_3, ct_string_len( header_part2_3 ) );
-			break;
+			if( header_buffers_cache_t::current_thread_cache() == m_owner_cache )
+				header_buffers_cache_t::release( std::move( m_buffer ) );
 		}
-	}
 
-	if( content_length_field_presence_t::add_content_length ==
-		content_length_field_presence )
-	{
-		std::array< char, 64 > buf;
-		const auto n =
-			std::snprintf(
-				buf.data(),
-				buf.size(),
-				"Content-Length: %llu\r\n",
-				static_cast< unsigned long long >( h.content_length() ) );
-
-		result.append( buf.data(), static_cast<std::string::size_type>(n) );
-	}
+		char * data() noexcept { return m_buffer.data(); }
+		const char * data() const noexcept { return m_buffer.data(); }
+
+		std::size_t size() const noexcept { return m_buffer.size(); }
+
+	private:
+		std::vector< char > m_buffer;
 
-	constexpr const char header_field_sep[] = ": ";
-	h.for_each_field( [&result, header_field_sep, header_rn](const auto & f) {
-		result += f.name();
-		result.append( header_field_sep, ct_string_len( header_field_sep ) );
-		result += f.value();
-		result.append( header_rn, ct_string_len( header_rn ) );
-	} );
+		//! The cache of the thread where the buffer was created.
+		const void * m_owner_cache;
+};
+
+//
+// create_header_string()
+//
+
+//! Creates a string for http response header.
+inline std::string
+create_header_string(
+	const http_response_header_t & h,
+	content_length_field_presence_t content_length_field_presence =
+		content_length_field_presence_t::add_content_length,
+	//! Isn't used since v.0.6.9: the exact size is calculated.
+	std::size_t /*buffer_size*/ = 0,
+	date_field_presence_t date_field_presence = date_field_presence_t::as_is )
+{
+	const header_serializer_t serializer{
+			h, content_length_field_presence, date_field_presence };
 
-	result.append( header_rn, ct_string_len( header_rn ) );
+	std::string result( serializer.size(), '\0' );
+	serializer.write( &result[ 0 ] );
+
+	return result;
+}
+
+//
+// create_header_buffer()
+//
+
+//! Creates a pooled buffer for http response header.
+/*!
+	@since v.0.6.9
+*/
+inline header_buffer_t
+create_header_buffer(
+	const http_response_header_t & h,
+	content_length_field_presence_t content_length_field_presence =
+		content_length_field_presence_t::add_content_length,
+	date_field_presence_t date_field_presence = date_field_presence_t::as_is )
+{
+	const header_serializer_t serializer{
+			h, content_length_field_presence, date_field_presence };
+
+	header_buffer_t result{ serializer.size() };
+	serializer.write( result.data() );
 
 	return result;
 }
@@ -166,6 +480,18 @@ create_not_implemented_resp()
 	return result;
 }
 
+inline auto
+create_continue_resp()
+{
+	constexpr const char raw_100_response[] =
+		"HTTP/1.1 100 Continue\r\n"
+		"\r\n";
+
+	writable_items_container_t result;
+	result.emplace_back( raw_100_response );
+	return result;
+}
+
 inline auto
 create_timeout_resp()
 {
@@ -1,6 +1,13 @@
 #pragma once
 
 #include <thread>
+#include <memory>
+#include <vector>
+
+#if defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+#endif
 
 #include <restinio/asio_include.hpp>
 
@@ -184,6 +191,171 @@ class ioctx_on_thread_pool_t
 		status_t m_status;
 };
 
+//
+// pin_current_thread_to_cpu
+//
+/*!
+ * @brief Bind the current thread to the specified CPU.
+ *
+ * @note
+ * Thread affinity is supported only on Linux. On other platforms
+ * this function does nothing.
+ *
+ * @since v.0.6.9
+ */
+inline void
+pin_current_thread_to_cpu( std::size_t cpu_index ) noexcept
+{
+#if defined(__linux__)
+	const auto cpus = std::thread::hardware_concurrency();
+	if( 0u == cpus )
+		return;
+
+	cpu_set_t cpuset;
+	CPU_ZERO( &cpuset );
+	CPU_SET( static_cast< int >( cpu_index % cpus ), &cpuset );
+
+	// An error is ignored: the thread just remains unpinned.
+	(void)pthread_setaffinity_np(
+			pthread_self(), sizeof( cpuset ), &cpuset );
+#else
+	(void)cpu_index;
+#endif
+}
+
+/*!
+ * Helper class for creating a separate io_context for every thread
+ * of a thread pool and running it on that thread.
+ *
+ * Unlike ioctx_on_thread_pool_t every io_context is run only on one
+ * thread, so objects that work on such io_context don't need any
+ * synchronization.
+ *
+ * \note class is not thread-safe (except `io_context()` and `stop()`
+ * methods). Expected usage scenario is to start and wait it on the same
+ * thread.
+ *
+ * \since
+ * v.0.6.9
+ */
+class ioctx_per_thread_pool_t
+{
+	public:
+		ioctx_per_thread_pool_t( const ioctx_per_thread_pool_t & ) = delete;
+		ioctx_per_thread_pool_t( ioctx_per_thread_pool_t && ) = delete;
+
+		ioctx_per_thread_pool_t(
+			// Pool size.
+			std::size_t pool_size,
+			// Should threads be pinned to CPUs?
+			bool pin_threads_to_cpus )
+			:	m_pin_threads_to_cpus{ pin_threads_to_cpus }
+			,	m_pool( pool_size )
+		{
+			if( 0u == pool_size )
+				throw exception_t{ "pool size can't be 0" };
+
+			m_contexts.reserve( pool_size );
+			for( std::size_t i = 0u; i != pool_size; ++i )
+				// Every io_context will be run on exactly one thread.
+				m_contexts.emplace_back(
+						std::make_unique< asio_ns::io_context >( 1 ) );
+		}
+
+		// Makes sure the pool is stopped.
+		~ioctx_per_thread_pool_t()
+		{
+			if( started() )
+			{
+				stop();
+				wait();
+			}
+		}
+
+		void
+		start()
+		{
+			if( started() )
+			{
+				throw exception_t{
+					"ioctx_per_thread_pool is already started" };
+			}
+
+			try
+			{
+				for( std::size_t i = 0u; i != m_pool.size(); ++i )
+				{
+					m_pool[ i ] = std::thread{ [this, i] {
+						if( m_pin_threads_to_cpus )
+							pin_current_thread_to_cpu( i );
+
+						auto & ioctx = *(m_contexts[ i ]);
+						auto work{ asio_ns::make_work_guard( ioctx ) };
+
+						ioctx.run();
+					} };
+				}
+
+				// When all thread started successfully
+				// status can be changed.
+				m_status = status_t::started;
+			}
+			catch( const std::exception & )
+			{
+				stop();
+				for( auto & t : m_pool )
+					if( t.joinable() )
+						t.join();
+
+				throw;
+			}
+		}
+
+		//! Stop all io_contexts.
+		/*!
+		 * Can be called from any thread (including threads of the pool).
+		 */
+		void
+		stop() noexcept
+		{
+			for( auto & ioctx : m_contexts )
+				ioctx->stop();
+		}
+
+		void
+		wait() noexcept
+		{
+			if( started() )
+			{
+				for( auto & t : m_pool )
+					t.join();
+
+				// When all threads are stopped status can be changed.
+				m_status = status_t::stopped;
+			}
+		}
+
+		bool started() const noexcept { return status_t::started == m_status; }
+
+		//! Count of threads (and io_contexts) in the pool.
+		std::size_t size() const noexcept { return m_contexts.size(); }
+
+		//! Get io_context for the specified thread.
+		asio_ns::io_context &
+		io_context( std::size_t index ) noexcept
+		{
+			return *(m_contexts[ index ]);
+		}
+
+	private:
+		enum class status_t : std::uint8_t { stopped, started };
+
+		const bool m_pin_threads_to_cpus;
+		std::vector< std::unique_ptr< asio_ns::io_context > > m_contexts;
+		std::vector< std::thread > m_pool;
+		status_t m_status{ status_t::stopped };
+};
+
 } /* namespace impl */
 
 } /* namespace restinio */
@@ -0,0 +1,499 @@
+/*
+	restinio
+*/
+
+/*!
+	Helpers for enabling kernel TLS (kTLS) for outgoing data.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <restinio/asio_include.hpp>
+
+#if !defined(RESTINIO_USE_BOOST_ASIO)
+  #include <asio/ssl.hpp>
+#else
+  #include <boost/asio/ssl.hpp>
+#endif
+
+#if defined( __linux__ ) && !defined( RESTINIO_NO_KTLS ) && \
+		defined( __has_include ) && OPENSSL_VERSION_NUMBER >= 0x10101000L
+	#if __has_include( <linux/tls.h> )
+		#define RESTINIO_HAS_KTLS
+	#endif
+#endif
+
+#if defined( RESTINIO_HAS_KTLS )
+	#include <openssl/kdf.h>
+	#include <openssl/evp.h>
+	#include <openssl/crypto.h>
+
+	#include <linux/tls.h>
+	#include <netinet/tcp.h>
+	#include <sys/socket.h>
+
+	#include <cstring>
+	#include <string>
+	#include <array>
+
+	#if !defined( SOL_TLS )
+		#define SOL_TLS 282
+	#endif
+#endif
+
+namespace restinio
+{
+
+namespace impl
+{
+
+namespace ktls
+{
+
+#if defined( RESTINIO_HAS_KTLS )
+
+//
+// server_traffic_secret_t
+//
+
+//! Storage for TLS 1.3 server application traffic secret.
+/*!
+	The secret isn't available via OpenSSL API, it can be received only
+	by keylog callback. The secret is stored in ex_data of SSL object.
+*/
+struct server_traffic_secret_t
+{
+	std::array< unsigned char, EVP_MAX_MD_SIZE > m_data;
+	std::size_t m_size{ 0u };
+
+	~server_traffic_secret_t()
+	{
+		OPENSSL_cleanse( m_data.data(), m_data.size() );
+	}
+};
+
+inline int
+secret_ex_data_index() noexcept
+{
+	static const int index = SSL_get_ex_new_index(
+			0, nullptr, nullptr, nullptr,
+			[]( void *, void * ptr, CRYPTO_EX_DATA *, int, long, void * ) {
+				delete static_cast< server_traffic_secret_t * >( ptr );
+			} );
+	return index;
+}
+
+//! Index of ex_data of SSL_CTX for keylog callback set by a user.
+inline int
+prev_keylog_cb_ex_data_index() noexcept
+{
+	static const int index = SSL_CTX_get_ex_new_index(
+			0, nullptr, nullptr, nullptr, nullptr );
+	return index;
+}
+
+inline bool
+from_hex( const char * hex, std::size_t hex_size, server_traffic_secret_t & to )
+{
+	const auto digit = []( char c ) -> int {
+		if( c >= '0' && c <= '9' ) return c - '0';
+		if( c >= 'a' && c <= 'f' ) return c - 'a' + 10;
+		if( c >= 'A' && c <= 'F' ) return c - 'A' + 10;
+		return -1;
+	};
+
+	if( 0u != hex_size % 2u || hex_size / 2u > to.m_data.size() )
+		return false;
+
+	for( std::size_t i = 0u; i != hex_size; i += 2u )
+	{
+		const int hi = digit( hex[ i ] );
+		const int lo = digit( hex[ i + 1u ] );
+		if( hi < 0 || lo < 0 )
+			return false;
+		to.m_data[ i / 2u ] = static_cast< unsigned char >( hi * 16 + lo );
+	}
+	to.m_size = hex_size / 2u;
+
+	return true;
+}
+
+//! Keylog callback that catches server traffic secret for TLS 1.3.
+inline void
+keylog_callback( const SSL * ssl, const char * line )
+{
+	static constexpr char prefix[] = "SERVER_TRAFFIC_SECRET_0 ";
+	constexpr std::size_t prefix_size = sizeof(prefix) - 1u;
+
+	if( 0 == std::strncmp( line, prefix, prefix_size ) )
+	{
+		// The format is: label client_random secret.
+		const char * client_random = line + prefix_size;
+		const char * secret = std::strchr( client_random, ' ' );
+		if( secret )
+		{
+			++secret;
+			std::unique_ptr< server_traffic_secret_t > value{
+					new server_traffic_secret_t{} };
+			if( from_hex( secret, std::strlen( secret ), *value ) )
+			{
+				// ex_data of SSL is logically mutable.
+				SSL * s = const_cast< SSL * >( ssl );
+				delete static_cast< server_traffic_secret_t * >(
+						SSL_get_ex_data( s, secret_ex_data_index() ) );
+				if( SSL_set_ex_data( s, secret_ex_data_index(), value.get() ) )
+					value.release();
+			}
+		}
+	}
+
+	const auto prev = reinterpret_cast< SSL_CTX_keylog_cb_func >(
+			SSL_CTX_get_ex_data(
+					SSL_get_SSL_CTX( ssl ), prev_keylog_cb_ex_data_index() ) );
+	if( prev )
+		prev( ssl, line );
+}
+
+//
+// prepare_context
+//
+
+//! Prepare TLS context for connections with kTLS.
+/*!
+	Installs keylog callback (the one set by a user is still called)
+	and disables things that can't be used with kTLS for outgoing data:
+	renegotiation and TLS 1.3 session tickets (they are sent after
+	the handshake and would change the sequence number of records).
+
+	@attention
+	The changes affect all connections made with @a context
+	(see use_ktls() of TLS server settings for the whole list).
+*/
+inline void
+prepare_context( asio_ns::ssl::context & context )
+{
+	SSL_CTX * ctx = context.native_handle();
+
+	const auto prev = SSL_CTX_get_keylog_callback( ctx );
+	if( prev != &keylog_callback )
+	{
+		SSL_CTX_set_ex_data( ctx, prev_keylog_cb_ex_data_index(),
+				reinterpret_cast< void * >( prev ) );
+		SSL_CTX_set_keylog_callback( ctx, &keylog_callback );
+	}
+
+	SSL_CTX_set_options( ctx, SSL_OP_NO_RENEGOTIATION );
+	SSL_CTX_set_num_tickets( ctx, 0u );
+}
+
+//! Keys for outgoing data in the format of Linux kernel.
+union crypto_info_t
+{
+	struct tls12_crypto_info_aes_gcm_128 m_aes_128;
+	struct tls12_crypto_info_aes_gcm_256 m_aes_256;
+
+	crypto_info_t() noexcept { std::memset( this, 0, sizeof(*this) ); }
+	~crypto_info_t() { OPENSSL_cleanse( this, sizeof(*this) ); }
+};
+
+//! Helper for automatic release of EVP_PKEY_CTX.
+struct pkey_ctx_deleter_t
+{
+	void operator()( EVP_PKEY_CTX * ctx ) const noexcept
+	{
+		EVP_PKEY_CTX_free( ctx );
+	}
+};
+
+using pkey_ctx_unique_ptr_t = std::unique_ptr< EVP_PKEY_CTX, pkey_ctx_deleter_t >;
+
+//! HKDF-Expand-Label from RFC 8446 with an empty context.
+inline bool
+hkdf_expand_label(
+	const EVP_MD * md,
+	const unsigned char * secret,
+	std::size_t secret_size,
+	const char * label,
+	unsigned char * out,
+	std::size_t out_size )
+{
+	std::string info;
+	info += static_cast< char >( ( out_size >> 8 ) & 0xFFu );
+	info += static_cast< char >( out_size & 0xFFu );
+	const std::string full_label = std::string{ "tls13 " } + label;
+	info += static_cast< char >( full_label.size() );
+	info += full_label;
+	info += '\0';
+
+	pkey_ctx_unique_ptr_t ctx{ EVP_PKEY_CTX_new_id( EVP_PKEY_HKDF, nullptr ) };
+	return ctx &&
+		EVP_PKEY_derive_init( ctx.get() ) > 0 &&
+		EVP_PKEY_CTX_hkdf_mode( ctx.get(), EVP_PKEY_HKDEF_MODE_EXPAND_ONLY ) > 0 &&
+		EVP_PKEY_CTX_set_hkdf_md( ctx.get(), md ) > 0 &&
+		EVP_PKEY_CTX_set1_hkdf_key(
+				ctx.get(), secret, static_cast< int >( secret_size ) ) > 0 &&
+		EVP_PKEY_CTX_add1_hkdf_info(
+				ctx.get(),
+				reinterpret_cast< const unsigned char * >( info.data() ),
+				static_cast< int >( info.size() ) ) > 0 &&
+		EVP_PKEY_derive( ctx.get(), out, &out_size ) > 0;
+}
+
+//! Key expansion for TLS 1.2 (RFC 5246, section 6.3).
+inline bool
+tls12_key_block(
+	const SSL * ssl,
+	const EVP_MD * md,
+	unsigned char * out,
+	std::size_t out_size )
+{
+	std::array< unsigned char, SSL_MAX_MASTER_KEY_LENGTH > master_key;
+	std::array< unsigned char, SSL3_RANDOM_SIZE > client_random;
+	std::array< unsigned char, SSL3_RANDOM_SIZE > server_random;
+
+	const std::size_t master_key_size = SSL_SESSION_get_master_key(
+			SSL_get_session( ssl ), master_key.data(), master_key.size() );
+	SSL_get_client_random( ssl, client_random.data(), client_random.size() );
+	SSL_get_server_random( ssl, server_random.data(), server_random.size() );
+
+	static constexpr char label[] = "key expansion";
+
+	pkey_ctx_unique_ptr_t ctx{ EVP_PKEY_CTX_new_id( EVP_PKEY_TLS1_PRF, nullptr ) };
+	const bool result = ctx &&
+		EVP_PKEY_derive_init( ctx.get() ) > 0 &&
+		EVP_PKEY_CTX_set_tls1_prf_md( ctx.get(), md ) > 0 &&
+		EVP_PKEY_CTX_set1_tls1_prf_secret(
+				ctx.get(),
+				master_key.data(),
+				static_cast< int >( master_key_size ) ) > 0 &&
+		EVP_PKEY_CTX_add1_tls1_prf_seed(
+				ctx.get(),
+				reinterpret_cast< const unsigned char * >( label ),
+				static_cast< int >( sizeof(label) - 1u ) ) > 0 &&
+		EVP_PKEY_CTX_add1_tls1_prf_seed(
+				ctx.get(),
+				server_random.data(),
+				static_cast< int >( server_random.size() ) ) > 0 &&
+		EVP_PKEY_CTX_add1_tls1_prf_seed(
+				ctx.get(),
+				client_random.data(),
+				static_cast< int >( client_random.size() ) ) > 0 &&
+		EVP_PKEY_derive( ctx.get(), out, &out_size ) > 0;
+
+	OPENSSL_cleanse( master_key.data(), master_key.size() );
+
+	return result;
+}
+
+//! Fill key, salt, IV and sequence number of one of AES-GCM structs.
+template< typename Info >
+bool
+fill_crypto_info( const SSL * ssl, const EVP_MD * md, Info & info )
+{
+	constexpr std::size_t key_size = sizeof(info.key);
+	constexpr std::size_t salt_size = sizeof(info.salt);
+	constexpr std::size_t iv_size = sizeof(info.iv);
+
+	if( TLS1_3_VERSION == SSL_version( ssl ) )
+	{
+		const auto * secret = static_cast< const server_traffic_secret_t * >(
+				SSL_get_ex_data( ssl, secret_ex_data_index() ) );
+		if( !secret )
+			return false;
+
+		// Nonce is salt + iv, there are no records sent after
+		// the handshake, so the sequence number is zero.
+		std::array< unsigned char, salt_size + iv_size > nonce;
+		const bool result =
+			hkdf_expand_label( md, secret->m_data.data(), secret->m_size,
+					"key", info.key, key_size ) &&
+			hkdf_expand_label( md, secret->m_data.data(), secret->m_size,
+					"iv", nonce.data(), nonce.size() );
+
+		std::memcpy( info.salt, nonce.data(), salt_size );
+		std::memcpy( info.iv, nonce.data() + salt_size, iv_size );
+		OPENSSL_cleanse( nonce.data(), nonce.size() );
+
+		return result;
+	}
+	else
+	{
+		// Key block for AEAD ciphers: client_write_key, server_write_key,
+		// client_write_IV, server_write_IV.
+		std::array< unsigned char, 2u * ( key_size + salt_size ) > key_block;
+		const bool result = tls12_key_block( ssl, md, key_block.data(), key_block.size() );
+
+		std::memcpy( info.key, key_block.data() + key_size, key_size );
+		std::memcpy( info.salt, key_block.data() + 2u * key_size + salt_size, salt_size );
+		OPENSSL_cleanse( key_block.data(), key_block.size() );
+
+		// Finished message was sent with sequence number 0.
+		// Explicit part of nonce is the sequence number too.
+		info.rec_seq[ sizeof(info.rec_seq) - 1u ] = 1u;
+		info.iv[ iv_size - 1u ] = 1u;
+
+		return result;
+	}
+}
+
+//
+// make_crypto_info
+//
+
+//! Make keys for outgoing data of established TLS connection.
+/*!
+	Only AES-GCM ciphers of TLS 1.2 and TLS 1.3 are supported.
+
+	@return size of data in @a info or 0 if kTLS can't be used.
+*/
+inline std::size_t
+make_crypto_info( const SSL * ssl, crypto_info_t & info )
+{
+	const int version = SSL_version( ssl );
+	if( TLS1_2_VERSION != version && TLS1_3_VERSION != version )
+		return 0u;
+
+	const SSL_CIPHER * cipher = SSL_get_current_cipher( ssl );
+	if( !cipher )
+		return 0u;
+
+	const EVP_MD * md = SSL_CIPHER_get_handshake_digest( cipher );
+	if( !md )
+		return 0u;
+
+	const auto fill_header = [version]( struct tls_crypto_info & header, int cipher_type ) {
+		header.version = static_cast< __u16 >(
+				TLS1_3_VERSION == version ? TLS_1_3_VERSION : TLS_1_2_VERSION );
+		header.cipher_type = static_cast< __u16 >( cipher_type );
+	};
+
+	switch( SSL_CIPHER_get_cipher_nid( cipher ) )
+	{
+		case NID_aes_128_gcm:
+			fill_header( info.m_aes_128.info, TLS_CIPHER_AES_GCM_128 );
+			return fill_crypto_info( ssl, md, info.m_aes_128 ) ?
+					sizeof(info.m_aes_128) : 0u;
+
+		case NID_aes_256_gcm:
+			fill_header( info.m_aes_256.info, TLS_CIPHER_AES_GCM_256 );
+			return fill_crypto_info( ssl, md, info.m_aes_256 ) ?
+					sizeof(info.m_aes_256) : 0u;
+
+		default:
+			return 0u;
+	}
+}
+
+//! Message callback for connections with kTLS.
+/*!
+	OpenSSL can't respond to KeyUpdate with update_requested after
+	the offload, so the connection is closed: the next read reports
+	the end of the stream.
+*/
+inline void
+ktls_msg_callback(
+	int write_p,
+	int /*version*/,
+	int content_type,
+	const void * buf,
+	std::size_t len,
+	SSL * ssl,
+	void * /*arg*/ )
+{
+	// Handshake header is 4 bytes, request_update follows it.
+	const auto * msg = static_cast< const unsigned char * >( buf );
+	if( !write_p && SSL3_RT_HANDSHAKE == content_type && len >= 5u &&
+			SSL3_MT_KEY_UPDATE == msg[ 0 ] &&
+			SSL_KEY_UPDATE_REQUESTED == msg[ 4 ] )
+		SSL_set_shutdown( ssl, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN );
+}
+
+//
+// disable_openssl_writes
+//
+
+//! Forbid OpenSSL to write anything after the offload.
+/*!
+	Records made by OpenSSL itself (close_notify and other alerts,
+	responses to KeyUpdate) would be encrypted by the kernel once more.
+
+	SSL_SENT_SHUTDOWN blocks all writes of OpenSSL but incoming data
+	is still read. Quiet shutdown makes SSL_shutdown() a no-op.
+	For TLS 1.3 the connection is closed if the peer requests
+	KeyUpdate (message callback of the connection is replaced).
+*/
+inline void
+disable_openssl_writes( SSL * ssl ) noexcept
+{
+	SSL_set_quiet_shutdown( ssl, 1 );
+	SSL_set_shutdown( ssl, SSL_SENT_SHUTDOWN );
+
+	if( TLS1_3_VERSION == SSL_version( ssl ) )
+		SSL_set_msg_callback( ssl, &ktls_msg_callback );
+}
+
+//
+// try_enable_tx
+//
+
+//! Try to pass encryption of outgoing data to the kernel.
+/*!
+	Must be called right after the completion of the handshake.
+
+	@retval true kTLS is enabled for outgoing data. All data must be
+	written directly to the socket after that, OpenSSL is used
+	only for reading (see disable_openssl_writes()).
+	@retval false kTLS can't be used (kernel has no support for it,
+	the cipher isn't supported and so on), the connection should be
+	used in the usual way.
+*/
+inline bool
+try_enable_tx( SSL * ssl, asio_ns::ip::tcp::socket & socket ) noexcept
+{
+	const int fd = socket.native_handle();
+
+	crypto_info_t info;
+	const std::size_t info_size = make_crypto_info( ssl, info );
+
+	// The secret isn't needed anymore.
+	delete static_cast< server_traffic_secret_t * >(
+			SSL_get_ex_data( ssl, secret_ex_data_index() ) );
+	SSL_set_ex_data( ssl, secret_ex_data_index(), nullptr );
+
+	if( 0u == info_size )
+		return false;
+
+	// There is no way to detach ULP from the socket. But without TLS_TX
+	// it works as the usual TCP socket, so connection can go on
+	// in the usual way if the second call fails.
+	const bool enabled =
+		0 == ::setsockopt( fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls") ) &&
+		0 == ::setsockopt( fd, SOL_TLS, TLS_TX, &info, static_cast< socklen_t >( info_size ) );
+
+	if( enabled )
+		disable_openssl_writes( ssl );
+
+	return enabled;
+}
+
+#else
+
+inline void
+prepare_context( asio_ns::ssl::context & )
+{}
+
+inline bool
+try_enable_tx( SSL *, asio_ns::ip::tcp::socket & ) noexcept
+{
+	return false;
+}
+
+#endif
+
+} /* namespace ktls */
+
+} /* namespace impl */
+
+} /* namespace restinio */
@@ -15,6 +15,13 @@ restinio_url_cb( http_parser * parser, const char * at, size_t length )
 			reinterpret_cast< restinio::impl::http_parser_ctx_t * >(
 				parser->data );
 
+		if( ctx->m_header.request_target().size() + length >
+			ctx->m_limits.max_url_size() )
+		{
+			ctx->m_limit_violation = limit_violation_t::url_too_long;
+			return 1;
+		}
+
 		ctx->m_header.append_request_target( at, length );
 	}
 	catch( const std::exception & )
@@ -36,12 +43,28 @@ restinio_header_field_cb( http_parser * parser, const char *at, size_t length )
 
 		if( ctx->m_last_was_value )
 		{
-			ctx->m_current_field_name.assign( at, length );
+			if( ++ctx->m_field_count > ctx->m_limits.max_field_count() ||
+				length > ctx->m_limits.max_field_name_size() )
+			{
+				ctx->m_limit_violation =
+						limit_violation_t::header_fields_too_large;
+				return 1;
+			}
+
+			ctx->start_field_name( string_view_t{ at, length } );
 			ctx->m_last_was_value = false;
 		}
 		else
 		{
-			ctx->m_current_field_name.append( at, length );
+			if( ctx->current_field_name_size() + length >
+				ctx->m_limits.max_field_name_size() )
+			{
+				ctx->m_limit_violation =
+						limit_violation_t::header_fields_too_large;
+				return 1;
+			}
+
+			ctx->append_field_name( string_view_t{ at, length } );
 		}
 	}
 	catch( const std::exception & )
@@ -67,6 +90,29 @@ restinio_header_value_cb( http_parser * parser, const char *at, size_t length )
 			reinterpret_cast< restinio::impl::http_parser_ctx_t * >( parser->data );
 
 		if( !ctx->m_last_was_value )
+			ctx->m_current_field_value_size = length;
+		else
+			ctx->m_current_field_value_size += length;
+
+		if( ctx->m_current_field_value_size >
+			ctx->m_limits.max_field_value_size() )
+		{
+			ctx->m_limit_violation = limit_violation_t::header_fields_too_large;
+			return 1;
+		}
+
+		if( ctx->m_header_fields_arena )
+		{
+			// No allocations for individual fields.
+			if( !ctx->m_last_was_value )
+			{
+				ctx->m_header_fields_arena->start_value( string_view_t{ at, length } );
+				ctx->m_last_was_value = true;
+			}
+			else
+				ctx->m_header_fields_arena->append_value( string_view_t{ at, length } );
+		}
+		else if( !ctx->m_last_was_value )
 		{
 			ctx->m_header.set_field(
 				std::move( ctx->m_current_field_name ),
@@ -76,7 +122,7 @@ restinio_header_value_cb( http_parser * parser, const char *at, size_t length )
 		}
 		else
 		{
-			append_last_field_accessor( ctx->m_header, std::string{ at, length } );
+			append_last_field_accessor( ctx->m_header, string_view_t{ at, length } );
 		}
 	}
 	catch( const std::exception & )
@@ -87,26 +133,48 @@ restinio_header_value_cb( http_parser * parser, const char *at, size_t length )
 	return 0;
 }
 
-inline int
+template< typename Http_Methods >
+int
 restinio_headers_complete_cb( http_parser * parser )
 {
-	if( ULLONG_MAX != parser->content_length &&
-		0 < parser->content_length )
+	try
 	{
-		try
+		auto * ctx =
+			reinterpret_cast< restinio::impl::http_parser_ctx_t * >(
+				parser->data );
+
+		// Fields from trailers of a chunked body (if any) will be
+		// added to the header in the usual way.
+		ctx->m_header_fields_to_arena = false;
+		ctx->m_header_fields_arena.reset();
+
+		if( ULLONG_MAX != parser->content_length &&
+			parser->content_length > ctx->m_limits.max_body_size() )
 		{
-			auto * ctx =
-				reinterpret_cast< restinio::impl::http_parser_ctx_t * >(
-					parser->data );
+			// There is no need to read the body that is too large.
+			ctx->m_limit_violation = limit_violation_t::body_too_large;
+			return -1;
+		}
 
+		if( ctx->m_pause_on_headers_complete )
+		{
+			// Headers should be inspected before the reading of the body.
+			// Method is not set yet, so it has to be set here.
+			ctx->m_header.method( Http_Methods::from_nodejs( parser->method ) );
+			ctx->m_headers_complete = true;
+			http_parser_pause( parser, 1 );
+		}
+		else if( ULLONG_MAX != parser->content_length &&
+			0 < parser->content_length )
+		{
 			ctx->m_body.reserve(
 					::restinio::utils::impl::uint64_to_size_t(
 							parser->content_length) );
 		}
-		catch( const std::exception & )
-		{
-			return 1;
-		}
+	}
+	catch( const std::exception & )
+	{
+		return 1;
 	}
 
 	return 0;
@@ -122,7 +190,24 @@ restinio_body_cb( http_parser * parser, const char *at, size_t length )
 			reinterpret_cast< restinio::impl::http_parser_ctx_t * >(
 				parser->data );
 
-		ctx->m_body.append( at, length );
+		ctx->m_body_size += length;
+		if( ctx->m_body_size > ctx->m_limits.max_body_size() )
+		{
+			ctx->m_limit_violation = limit_violation_t::body_too_large;
+			return 1;
+		}
+
+		if( ctx->m_body_sink )
+		{
+			if( restinio::incoming_body::pause_reading() ==
+				ctx->m_body_sink->on_chunk( string_view_t{ at, length } ) )
+			{
+				ctx->m_body_reading_paused = true;
+				http_parser_pause( parser, 1 );
+			}
+		}
+		else if( !ctx->m_discard_body )
+			ctx->m_body.append( at, length );
 	}
 	catch( const std::exception & )
 	{
@@ -20,6 +20,7 @@
 #include <restinio/request_handler.hpp>
 #include <restinio/buffers.hpp>
 #include <restinio/optional.hpp>
+#include <restinio/utils/small_vector.hpp>
 
 namespace restinio
 {
@@ -27,7 +28,12 @@ namespace restinio
 namespace impl
 {
 
-using write_groups_container_t = std::vector< write_group_t >;
+//! Container for write groups of a response.
+/*!
+	Since v.0.6.9 it has inline storage for two write groups, so
+	typical responses don't allocate memory for the container.
+*/
+using write_groups_container_t = utils::small_vector_t< write_group_t, 2u >;
 
 //
 // response_context_t
@@ -79,6 +85,17 @@ class response_context_t
 		//! Is context empty.
 		bool empty() const noexcept { return m_write_groups.empty(); }
 
+		//! Get the write group that will be dequeued next.
+		/*!
+			@since v.0.6.9
+		*/
+		const write_group_t &
+		front_group() const noexcept
+		{
+			assert( !m_write_groups.empty() );
+			return m_write_groups.front();
+		}
+
 		//! Extract write group from data queue.
 		write_group_t
 		dequeue_group() noexcept
@@ -161,6 +178,41 @@ class response_context_table_t
 			m_contexts.resize( max_elements_count );
 		}
 
+		//! Initialize table with already allocated storage.
+		/*!
+		 * @since v.0.6.9
+		 */
+		response_context_table_t(
+			std::size_t max_elements_count,
+			std::vector< response_context_t > storage )
+			:	m_contexts{ std::move( storage ) }
+		{
+			m_contexts.resize( max_elements_count );
+		}
+
+		//! Take the storage away from the table.
+		/*!
+		 * Only the storage of an empty table is returned (all contexts
+		 * in it have no write groups). An empty container is returned
+		 * otherwise.
+		 *
+		 * The table must not be used after that.
+		 *
+		 * @since v.0.6.9
+		 */
+		std::vector< response_context_t >
+		release_storage() noexcept
+		{
+			std::vector< response_context_t > result;
+			if( empty() )
+			{
+				result = std::move( m_contexts );
+				m_first_element_index = 0u;
+			}
+
+			return result;
+		}
+
 		//! If table is empty.
 		bool
 		empty() const noexcept
@@ -182,6 +234,16 @@ class response_context_table_t
 			return m_contexts[ m_first_element_index ];
 		}
 
+		//! Get first context.
+		/*!
+		 * @since v.0.6.9
+		 */
+		const response_context_t &
+		front() const noexcept
+		{
+			return m_contexts[ m_first_element_index ];
+		}
+
 		//! Get last context.
 		response_context_t &
 		back() noexcept
@@ -294,6 +356,31 @@ class response_coordinator_t
 			:	m_context_table{ max_req_count }
 		{}
 
+		//! Initialize coordinator with already allocated storage for
+		//! response contexts.
+		/*!
+		 * @since v.0.6.9
+		 */
+		response_coordinator_t(
+			//! Maximum count of requests to keep track of.
+			std::size_t max_req_count,
+			//! Storage for response contexts.
+			std::vector< response_context_t > storage )
+			:	m_context_table{ max_req_count, std::move( storage ) }
+		{}
+
+		//! Take the storage for response contexts away.
+		/*!
+		 * Coordinator must be reset before that.
+		 *
+		 * @since v.0.6.9
+		 */
+		std::vector< response_context_t >
+		release_storage() noexcept
+		{
+			return m_context_table.release_storage();
+		}
+
 		/** @name Response coordinator state.
 		 * @brief Various state flags.
 		*/
@@ -405,6 +492,25 @@ class response_coordinator_t
 			return result;
 		}
 
+		//! Look at the write group that will be returned by the next
+		//! pop_ready_buffers() call.
+		/*!
+			Returns nullptr if there is no data available for write
+			or if the coordinator is closed.
+
+			@since v.0.6.9
+		*/
+		const write_group_t *
+		front_ready_group() const noexcept
+		{
+			if( closed() || m_context_table.empty() )
+				return nullptr;
+
+			const auto & current_ctx = m_context_table.front();
+
+			return current_ctx.empty() ? nullptr : &current_ctx.front_group();
+		}
+
 		//! Remove all contexts.
 		/*!
 			Invoke write groups after-write callbacks with error status.
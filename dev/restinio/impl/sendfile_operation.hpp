@@ -64,6 +64,7 @@ class sendfile_operation_runner_base_t
 			,	m_executor{ std::move( executor )}
 			,	m_socket{ socket }
 			,	m_after_sendfile_cb{ std::move( after_sendfile_cb ) }
+			,	m_file_reader{ sf.file_reader() }
 		{}
 
 		auto expires_after() const noexcept { return m_expires_after; }
@@ -81,6 +82,14 @@ class sendfile_operation_runner_base_t
 		asio_ns::executor m_executor;
 		Socket & m_socket;
 		after_sendfile_cb_t m_after_sendfile_cb;
+
+		//! Reader for performing file reads out of the io thread.
+		/*!
+			Can be empty, in that case file is read by blocking calls.
+
+			@since v.0.6.9
+		*/
+		async_file_reader_handle_t m_file_reader;
 };
 
 template<typename Error_Type>
@@ -110,3 +119,38 @@ make_error_code( const Error_Type & e ) noexcept
 	#endif
 #endif
 
+namespace restinio
+{
+
+namespace impl
+{
+
+//
+// make_sendfile_operation_runner
+//
+
+//! Create a runner for sendfile operation for a given socket.
+/*!
+	There can be overloads for specific socket types
+	(see restinio/tls.hpp).
+
+	@since v.0.6.9
+*/
+template < typename Socket >
+sendfile_operation_shared_ptr_t
+make_sendfile_operation_runner(
+	const sendfile_t & sf,
+	asio_ns::executor executor,
+	Socket & socket,
+	after_sendfile_cb_t after_sendfile_cb )
+{
+	return std::make_shared< sendfile_operation_runner_t< Socket > >(
+			sf,
+			std::move( executor ),
+			socket,
+			std::move( after_sendfile_cb ) );
+}
+
+} /* namespace impl */
+
+} /* namespace restinio */
@@ -41,6 +41,12 @@ class sendfile_operation_runner_t final
 		virtual void
 		start() override
 		{
+			if( this->m_file_reader )
+			{
+				start_async_reading();
+				return;
+			}
+
 #if defined( RESTINIO_FREEBSD_TARGET ) || defined( RESTINIO_MACOS_TARGET )
 			auto const n = ::lseek( this->m_file_descriptor, this->m_next_write_offset, SEEK_SET );
 #else
@@ -129,6 +135,208 @@ class sendfile_operation_runner_t final
 	private:
 		std::unique_ptr< char[] > m_buffer{ new char [ this->m_chunk_size ] };
 
+		/** @name State of reading via async file reader.
+		 * @brief File is read by the async file reader into two buffers:
+		 * the next chunk is read while the previous one is being written.
+		 *
+		 * All members are accessed only on m_executor.
+		 *
+		 * @since v.0.6.9
+		 */
+		///@{
+		//! The second buffer (is created only for async reading).
+		std::unique_ptr< char[] > m_second_buffer;
+		//! The buffer for the next read operation.
+		char * m_read_buffer{ nullptr };
+		//! The buffer with data that is ready to be written.
+		char * m_ready_buffer{ nullptr };
+		std::size_t m_ready_size{ 0u };
+
+		file_offset_t m_next_read_offset{ 0 };
+		file_size_t m_remained_to_read{ 0 };
+
+		bool m_read_in_progress{ false };
+		bool m_write_in_progress{ false };
+
+		//! Is the operation finished?
+		/*!
+			The result is reported only when there are no pending operations:
+			file and buffers are in use by them.
+		*/
+		bool m_finished{ false };
+		bool m_result_reported{ false };
+		asio_ns::error_code m_result;
+		///@}
+
+		void
+		start_async_reading() noexcept
+		{
+			try
+			{
+				m_second_buffer.reset( new char [ this->m_chunk_size ] );
+			}
+			catch( ... )
+			{
+				this->m_after_sendfile_cb(
+						make_asio_compaible_error(
+								asio_convertible_error_t::async_read_some_at_call_failed ),
+						this->m_transfered_size );
+				return;
+			}
+
+			m_read_buffer = m_buffer.get();
+			m_next_read_offset = this->m_next_write_offset;
+			m_remained_to_read = this->m_remained_size;
+
+			initiate_next_read();
+		}
+
+		void
+		finish( const asio_ns::error_code & ec ) noexcept
+		{
+			if( !m_finished )
+			{
+				m_finished = true;
+				m_result = ec;
+			}
+
+			if( !m_read_in_progress && !m_write_in_progress && !m_result_reported )
+			{
+				m_result_reported = true;
+				this->m_after_sendfile_cb( m_result, this->m_transfered_size );
+			}
+		}
+
+		void
+		initiate_next_read() noexcept
+		{
+			if( m_finished || m_read_in_progress || 0 == m_remained_to_read ||
+					nullptr != m_ready_buffer )
+				return;
+
+			const auto size = static_cast< std::size_t >(
+					std::min< file_size_t >( m_remained_to_read, this->m_chunk_size ) );
+
+			m_read_in_progress = true;
+			try
+			{
+				this->m_file_reader->async_read(
+						this->m_file_descriptor,
+						m_next_read_offset,
+						m_read_buffer,
+						size,
+						// The handler can be called on a thread of the reader,
+						// so the result is passed to m_executor.
+						[this,
+							ctx = this->shared_from_this(),
+							executor = this->m_executor]
+						( const asio_ns::error_code & ec, std::size_t n ) mutable
+						{
+							asio_ns::post(
+								executor,
+								[this, ctx = std::move( ctx ), ec, n]() noexcept {
+									on_read_completed( ec, n );
+								} );
+						} );
+			}
+			catch( ... )
+			{
+				m_read_in_progress = false;
+				finish(
+						make_asio_compaible_error(
+								asio_convertible_error_t::async_read_some_at_call_failed ) );
+			}
+		}
+
+		void
+		on_read_completed( const asio_ns::error_code & ec, std::size_t n ) noexcept
+		{
+			m_read_in_progress = false;
+
+			if( ec )
+				finish( ec );
+			else if( 0u == n )
+				finish(
+						asio_ns::error_code{
+								asio_ec::eof,
+								asio_ns::error::get_system_category() } );
+			else
+			{
+				m_next_read_offset += static_cast< file_offset_t >( n );
+				m_remained_to_read -= static_cast< file_size_t >( n );
+
+				m_ready_buffer = m_read_buffer;
+				m_ready_size = n;
+				m_read_buffer = m_read_buffer == m_buffer.get() ?
+						m_second_buffer.get() : m_buffer.get();
+
+				initiate_next_write_of_ready_data();
+			}
+
+			// Result can be postponed until the completion of read.
+			if( m_finished )
+				finish( m_result );
+		}
+
+		void
+		initiate_next_write_of_ready_data() noexcept
+		{
+			if( m_finished || m_write_in_progress || nullptr == m_ready_buffer )
+				return;
+
+			m_write_in_progress = true;
+			try
+			{
+				asio_ns::async_write(
+					this->m_socket,
+					asio_ns::const_buffer{ m_ready_buffer, m_ready_size },
+					asio_ns::bind_executor(
+						this->m_executor,
+						[this, ctx = this->shared_from_this()]
+						( const asio_ns::error_code & ec, std::size_t written ) noexcept
+						{
+							on_write_completed( ec, written );
+						} ) );
+			}
+			catch( ... )
+			{
+				m_write_in_progress = false;
+				finish(
+						make_asio_compaible_error(
+								asio_convertible_error_t::async_write_call_failed ) );
+				return;
+			}
+
+			// The ready buffer is in use by write now,
+			// so the other one can be filled.
+			m_ready_buffer = nullptr;
+			initiate_next_read();
+		}
+
+		void
+		on_write_completed( const asio_ns::error_code & ec, std::size_t written ) noexcept
+		{
+			m_write_in_progress = false;
+
+			if( !ec )
+			{
+				this->m_remained_size -= written;
+				this->m_transfered_size += written;
+				if( 0 == this->m_remained_size )
+					finish( ec );
+				else
+				{
+					initiate_next_write_of_ready_data();
+					initiate_next_read();
+				}
+			}
+			else
+				finish( ec );
+
+			if( m_finished )
+				finish( m_result );
+		}
+
 		//! Helper method for making a lambda for async_write completion handler.
 		auto
 		make_async_write_handler() noexcept
@@ -16,6 +16,8 @@
   #include <boost/asio/ssl.hpp>
 #endif
 
+#include <restinio/impl/ktls.hpp>
+
 namespace restinio
 {
 
@@ -47,9 +49,13 @@ class tls_socket_t
 
 		tls_socket_t(
 			asio_ns::io_context & io_context,
-			context_handle_t tls_context )
+			context_handle_t tls_context,
+			//! Should kTLS be used for outgoing data?
+			//! @since v.0.6.9
+			bool use_ktls = false )
 			:	m_context{ std::move( tls_context ) }
 			,	m_socket{ std::make_unique< socket_t >( io_context, *m_context ) }
+			,	m_use_ktls{ use_ktls }
 		{}
 
 		tls_socket_t( tls_socket_t && ) = default;
@@ -60,6 +66,8 @@ class tls_socket_t
 		{
 			std::swap( m_context, sock.m_context );
 			std::swap( m_socket, sock.m_socket );
+			std::swap( m_use_ktls, sock.m_use_ktls );
+			std::swap( m_ktls_tx_enabled, sock.m_ktls_tx_enabled );
 		}
 
 		auto &
@@ -140,6 +148,11 @@ class tls_socket_t
 		auto
 		async_write_some( Args &&... args )
 		{
+			// Encryption is performed by the kernel.
+			if( m_ktls_tx_enabled )
+				return m_socket->next_layer().async_write_some(
+						std::forward< Args >( args )... );
+
 			return m_socket->async_write_some( std::forward< Args >( args )... );
 		}
 
@@ -164,9 +177,54 @@ class tls_socket_t
 			return m_socket->async_handshake( std::forward< Args >( args )... );
 		}
 
+		/*!
+		 * \brief Try to pass encryption of outgoing data to the kernel.
+		 *
+		 * Does nothing if kTLS wasn't requested for that socket.
+		 * Must be called right after the completion of the handshake.
+		 *
+		 * \return true if kTLS is used for outgoing data.
+		 *
+		 * \since
+		 * v.0.6.9
+		 */
+		bool
+		try_enable_ktls_tx() noexcept
+		{
+			if( m_use_ktls && !m_ktls_tx_enabled )
+				m_ktls_tx_enabled = ktls::try_enable_tx(
+						m_socket->native_handle(),
+						m_socket->next_layer() );
+
+			return m_ktls_tx_enabled;
+		}
+
+		/*!
+		 * \brief Is outgoing data encrypted by the kernel?
+		 *
+		 * If it is then data can be written directly to the underlying
+		 * TCP-socket (it makes native sendfile() usable for TLS-connection).
+		 *
+		 * \since
+		 * v.0.6.9
+		 */
+		bool
+		is_ktls_tx_enabled() const noexcept
+		{
+			return m_ktls_tx_enabled;
+		}
+
 	private:
 		context_handle_t m_context;
 		std::unique_ptr< socket_t > m_socket;
+
+		//! Should kTLS be used for outgoing data?
+		//! @since v.0.6.9
+		bool m_use_ktls{ false };
+
+		//! Is kTLS enabled for outgoing data?
+		//! @since v.0.6.9
+		bool m_ktls_tx_enabled{ false };
 };
 
 } /* namespace impl */
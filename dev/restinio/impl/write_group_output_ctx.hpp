@@ -16,6 +16,7 @@
 #include <restinio/optional.hpp>
 #include <restinio/variant.hpp>
 #include <restinio/impl/sendfile_operation.hpp>
+#include <restinio/utils/small_vector.hpp>
 
 #include <restinio/compiler_features.hpp>
 
@@ -75,19 +76,35 @@ using asio_bufs_container_t = std::vector< asio_ns::const_buffer >;
 	Of course, the real usage is complicated by spreading in time and
 	running plenty of other logic cooperatively.
 
+	Since v.0.6.9 several write groups can be written by the same gather
+	write operation. Groups that consist of trivial buffers only can be
+	added to the current group with coalesce_write_group() before the
+	first write operation is extracted. Such groups are written after
+	the current one, and their after-write notificators are invoked
+	in order of addition by finish_write_group()/fail_write_group().
 */
 class write_group_output_ctx_t
 {
-	//! Get the maximum number of buffers that can be written with
-	//! gather write operation.
-	static constexpr auto
-	max_iov_len() noexcept
-	{
-		using len_t = decltype( asio_ns::detail::max_iov_len );
-		return std::min< len_t >( asio_ns::detail::max_iov_len, 64 );
-	}
-
 	public:
+		//! Get the maximum number of buffers that can be written with
+		//! gather write operation.
+		static constexpr auto
+		max_iov_len() noexcept
+		{
+			using len_t = decltype( asio_ns::detail::max_iov_len );
+			return std::min< len_t >( asio_ns::detail::max_iov_len, 64 );
+		}
+
+		//! Get the maximum total size of data of coalesced write groups.
+		/*!
+			@since v.0.6.9
+		*/
+		static constexpr std::size_t
+		max_coalesced_bytes() noexcept
+		{
+			return 64u * 1024u;
+		}
+
 		//! Contruct an object.
 		/*
 			Space for m_asio_bufs is reserved to be ready to store max_iov_len() asio bufs.
@@ -97,6 +114,30 @@ class write_group_output_ctx_t
 			m_asio_bufs.reserve( max_iov_len() );
 		}
 
+		//! Contruct an object with already allocated storage for asio bufs.
+		/*!
+			@since v.0.6.9
+		*/
+		explicit write_group_output_ctx_t( asio_bufs_container_t storage )
+			:	m_asio_bufs{ std::move( storage ) }
+		{
+			m_asio_bufs.clear();
+			m_asio_bufs.reserve( max_iov_len() );
+		}
+
+		//! Take the storage for asio bufs away.
+		/*!
+			The object must not be used after that.
+
+			@since v.0.6.9
+		*/
+		asio_bufs_container_t
+		release_asio_bufs_storage() noexcept
+		{
+			m_asio_bufs.clear();
+			return std::move( m_asio_bufs );
+		}
+
 		//! Trivial write operaton.
 		/*!
 			Presented with a vector of ordinary buffers (data-size objects).
@@ -176,14 +217,11 @@ class write_group_output_ctx_t
 						throw exception_t{ "invalid file descriptor in sendfile operation." };
 					}
 
-					auto sendfile_operation =
-						std::make_shared< sendfile_operation_runner_t< Socket > >(
+					*m_sendfile_operation = make_sendfile_operation_runner(
 							*m_sendfile,
 							std::move( executor ),
 							socket,
 							std::move( after_sendfile_cb ) );
-
-					*m_sendfile_operation = std::move( sendfile_operation );
 					(*m_sendfile_operation)->start();
 				}
 
@@ -240,6 +278,78 @@ class write_group_output_ctx_t
 			m_current_wg = std::move( next_wg );
 		}
 
+		//! Can a write group be written together with the current one?
+		/*!
+			It is possible only if no data of the current group
+			is extracted yet, both groups contain only trivial buffers
+			and the resulting gather write stays within max_iov_len()
+			buffers and max_coalesced_bytes() bytes.
+
+			@since v.0.6.9
+		*/
+		bool
+		can_be_coalesced( const write_group_t & wg ) const noexcept
+		{
+			if( !m_current_wg ||
+				0u != m_next_writable_item_index ||
+				0u == m_current_wg->items_count() )
+				return false;
+
+			std::size_t items_count = wg.items_count();
+			std::size_t total_size{ 0 };
+			if( !calculate_trivial_size( wg, total_size ) )
+				return false;
+
+			if( m_coalesced_wgs.empty() )
+			{
+				items_count += m_current_wg->items_count();
+				if( !calculate_trivial_size( *m_current_wg, total_size ) )
+					return false;
+			}
+			else
+			{
+				items_count += m_coalesced_items_count;
+				total_size += m_coalesced_total_size;
+			}
+
+			return items_count <= max_iov_len() &&
+				total_size <= max_coalesced_bytes();
+		}
+
+		//! Add a write group to be written together with the current one.
+		/*!
+			@pre can_be_coalesced( wg ) is true.
+
+			@since v.0.6.9
+		*/
+		void
+		coalesce_write_group( write_group_t wg )
+		{
+			assert( can_be_coalesced( wg ) );
+
+			if( m_coalesced_wgs.empty() )
+			{
+				m_coalesced_items_count = m_current_wg->items_count();
+				m_coalesced_total_size = 0u;
+				calculate_trivial_size( *m_current_wg, m_coalesced_total_size );
+			}
+
+			m_coalesced_items_count += wg.items_count();
+			calculate_trivial_size( wg, m_coalesced_total_size );
+
+			m_coalesced_wgs.emplace_back( std::move( wg ) );
+		}
+
+		//! Get the count of write groups coalesced with the current one.
+		/*!
+			@since v.0.6.9
+		*/
+		std::size_t
+		coalesced_groups_count() const noexcept
+		{
+			return m_coalesced_wgs.size();
+		}
+
 		//! An alias for variant holding write operation specifics.
 		using solid_write_operation_variant_t =
 			variant_t<
@@ -285,6 +395,7 @@ class write_group_output_ctx_t
 
 			invoke_after_write_notificator_if_necessary( ec );
 			m_current_wg.reset();
+			m_coalesced_wgs.clear();
 			m_sendfile_operation.reset();
 		}
 
@@ -304,16 +415,47 @@ class write_group_output_ctx_t
 		reset_write_group()
 		{
 			m_current_wg.reset();
+			m_coalesced_wgs.clear();
 			m_next_writable_item_index = 0;
 		}
 
+		//! Add the size of data of a write group to @a total_size.
+		/*!
+			@return false if the group contains not only trivial buffers.
+
+			@since v.0.6.9
+		*/
+		static bool
+		calculate_trivial_size(
+			const write_group_t & wg,
+			std::size_t & total_size ) noexcept
+		{
+			for( const auto & item : wg.items() )
+			{
+				if( writable_item_type_t::trivial_write_operation !=
+					item.write_type() )
+					return false;
+
+				total_size += item.size();
+			}
+
+			return true;
+		}
+
 		//! Execute notification callback if necessary.
+		/*!
+			Since v.0.6.9 notificators of coalesced groups are
+			invoked too.
+		*/
 		void
 		invoke_after_write_notificator_if_necessary( const asio_ns::error_code & ec )
 		{
 			try
 			{
 				m_current_wg->invoke_after_write_notificator_if_exists( ec );
+
+				for( auto & wg : m_coalesced_wgs )
+					wg.invoke_after_write_notificator_if_exists( ec );
 			}
 			catch( const std::exception & ex )
 			{
@@ -348,6 +490,18 @@ class write_group_output_ctx_t
 				total_size += item.size();
 			}
 
+			if( items.size() == m_next_writable_item_index )
+			{
+				// Coalesced groups are guaranteed to fit into the same
+				// gather write by can_be_coalesced().
+				for( const auto & wg : m_coalesced_wgs )
+					for( const auto & item : wg.items() )
+					{
+						m_asio_bufs.emplace_back( item.buf() );
+						total_size += item.size();
+					}
+			}
+
 			assert( !m_asio_bufs.empty() );
 			return trivial_write_operation_t{ m_asio_bufs, total_size };
 		}
@@ -372,6 +526,28 @@ class write_group_output_ctx_t
 		*/
 		std::size_t m_next_writable_item_index{ 0 };
 
+		//! Write groups that are written together with m_current_wg.
+		/*!
+			@since v.0.6.9
+		*/
+		utils::small_vector_t< write_group_t, 4u > m_coalesced_wgs;
+
+		//! The count of items in m_current_wg and m_coalesced_wgs.
+		/*!
+			Makes sense only if m_coalesced_wgs isn't empty.
+
+			@since v.0.6.9
+		*/
+		std::size_t m_coalesced_items_count{ 0 };
+
+		//! The size of data in m_current_wg and m_coalesced_wgs.
+		/*!
+			Makes sense only if m_coalesced_wgs isn't empty.
+
+			@since v.0.6.9
+		*/
+		std::size_t m_coalesced_total_size{ 0 };
+
 		//! Asio buffers storage.
 		asio_bufs_container_t m_asio_bufs;
 
@@ -0,0 +1,186 @@
+/*
+ * RESTinio
+ */
+
+/*!
+ * @file
+ * @brief Stuff related to incremental consumption of incoming request body.
+ *
+ * @since v.0.6.9
+ */
+
+#pragma once
+
+#include <restinio/compiler_features.hpp>
+#include <restinio/string_view.hpp>
+
+#include <restinio/impl/connection_base.hpp>
+
+#include <memory>
+
+namespace restinio
+{
+
+namespace incoming_body
+{
+
+//
+// chunk_handling_result_t
+//
+/*!
+ * @brief Enumeration of results of handling a chunk of incoming body.
+ *
+ * @since v.0.6.9
+ */
+enum class chunk_handling_result_t
+{
+	//! Sink is ready to receive the next chunk of the body.
+	continue_reading,
+	//! Sink can't receive the next chunk right now.
+	/*!
+	 * Reading of the body will be suspended until resumer_t::resume()
+	 * is called.
+	 */
+	pause_reading
+};
+
+/*!
+ * @brief Shorthand for chunk_handling_result_t::continue_reading.
+ *
+ * @since v.0.6.9
+ */
+inline constexpr chunk_handling_result_t
+continue_reading() noexcept { return chunk_handling_result_t::continue_reading; }
+
+/*!
+ * @brief Shorthand for chunk_handling_result_t::pause_reading.
+ *
+ * @since v.0.6.9
+ */
+inline constexpr chunk_handling_result_t
+pause_reading() noexcept { return chunk_handling_result_t::pause_reading; }
+
+//
+// sink_t
+//
+/*!
+ * @brief An interface of a receiver of incoming body chunks.
+ *
+ * A sink receives parts of request body as soon as they are
+ * extracted from the data read from the socket. Those parts are not
+ * accumulated by RESTinio, so a large body can be written to a file
+ * or passed to another service without holding it in memory.
+ *
+ * All methods of a sink are called on the context of the connection
+ * that reads the request.
+ *
+ * @attention
+ * A chunk passed to on_chunk() references the internal connection's
+ * buffer and is valid only until on_chunk() returns.
+ *
+ * @since v.0.6.9
+ */
+class sink_t
+{
+public:
+	virtual ~sink_t() = default;
+
+	//! Handle the next chunk of the body.
+	/*!
+	 * If pause_reading() is returned then reading of the rest of the body
+	 * is suspended until resumer_t::resume() is called.
+	 *
+	 * An exception thrown from that method leads to the closing of
+	 * the connection.
+	 */
+	virtual chunk_handling_result_t
+	on_chunk( string_view_t chunk ) = 0;
+
+	//! The whole body has been received.
+	/*!
+	 * Is called just before invocation of the request handler.
+	 */
+	virtual void
+	on_complete() = 0;
+
+	//! Reading of the body is interrupted.
+	/*!
+	 * Is called if the connection is closed before the whole body
+	 * has been received (because of an I/O error, a timeout,
+	 * a parsing error and so on).
+	 */
+	virtual void
+	on_interrupted() noexcept = 0;
+};
+
+//! An alias for shared pointer to a sink.
+using sink_handle_t = std::shared_ptr< sink_t >;
+
+//
+// resumer_t
+//
+/*!
+ * @brief A handle for resuming of reading a body paused by a sink.
+ *
+ * An instance of resumer_t is passed to body sink factory for every
+ * new sink. If the sink returns pause_reading() from sink_t::on_chunk()
+ * then it should call resume() when it is ready to receive more data.
+ *
+ * It is safe to call resume() from any thread. The actual resumption
+ * of reading will be performed on the context of the connection.
+ *
+ * While the reading is paused the connection is kept alive and
+ * the timeout for reading of a request isn't checked. Instead of it
+ * the connection is closed if the reading isn't resumed in
+ * server_settings_t::paused_body_reading_timelimit().
+ *
+ * @note
+ * resumer_t doesn't prolong the lifetime of the connection.
+ * If the connection is already destroyed then resume() does nothing.
+ *
+ * @since v.0.6.9
+ */
+class resumer_t
+{
+	std::weak_ptr< impl::connection_base_t > m_connection;
+
+public:
+	resumer_t() = default;
+
+	explicit resumer_t(
+		std::weak_ptr< impl::connection_base_t > connection ) noexcept
+		:	m_connection{ std::move( connection ) }
+	{}
+
+	//! Resume reading of the body.
+	void
+	resume() const
+	{
+		if( auto conn = m_connection.lock() )
+			conn->resume_incoming_body_reading();
+	}
+};
+
+//
+// noop_sink_factory_t
+//
+/*!
+ * @brief The default no-op body sink factory.
+ *
+ * This type is used for body_sink_factory_t trait by default.
+ * It means that incoming bodies are accumulated in memory
+ * and are accessible via request_t::body().
+ *
+ * NOTE. When this type is used no calls to the factory will be generated,
+ * and there won't be any performance penalties related to it.
+ *
+ * @since v.0.6.9
+ */
+struct noop_sink_factory_t
+{
+	// empty type by design.
+};
+
+} /* namespace incoming_body */
+
+} /* namespace restinio */
@@ -0,0 +1,242 @@
+/*
+ * RESTinio
+ */
+
+/*!
+ * @file
+ * @brief Stuff related to limits of an incoming HTTP message.
+ *
+ * @since v.0.6.9
+ */
+
+#pragma once
+
+#include <restinio/compiler_features.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace restinio
+{
+
+//
+// incoming_http_msg_limits_t
+//
+/*!
+ * @brief A type of holder of limits related to an incoming HTTP message.
+ *
+ * Since v.0.6.9 RESTinio allows to set limits for sizes of various parts
+ * of an incoming HTTP message. If some part of a message exceeds
+ * the limit then the reading of the message is stopped, an appropriate
+ * negative response (414, 431 or 413) is sent to the client and
+ * the connection is closed.
+ *
+ * By default all limits are set to the max values, so there are
+ * no limits.
+ *
+ * Usage example:
+ * @code
+ * restinio::run(
+ * 	restinio::on_thread_pool(16)
+ * 		.incoming_http_msg_limits(
+ * 			restinio::incoming_http_msg_limits_t{}
+ * 				.max_url_size( 8000u )
+ * 				.max_field_name_size( 2048u )
+ * 				.max_field_value_size( 4096u )
+ * 				.max_field_count( 100u )
+ * 				.max_body_size( 10u * 1024u * 1024u )
+ * 		)
+ * 		...
+ * );
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+class incoming_http_msg_limits_t
+{
+	std::size_t m_max_url_size{ std::numeric_limits<std::size_t>::max() };
+	std::size_t m_max_field_name_size{ std::numeric_limits<std::size_t>::max() };
+	std::size_t m_max_field_value_size{ std::numeric_limits<std::size_t>::max() };
+	std::size_t m_max_field_count{ std::numeric_limits<std::size_t>::max() };
+	std::uint64_t m_max_body_size{ std::numeric_limits<std::uint64_t>::max() };
+
+public:
+	//! Max size of the request-target in the request line.
+	/*!
+	 * The violation of that limit is answered by 414 (URI Too Long).
+	 */
+	//! \{
+	std::size_t
+	max_url_size() const noexcept { return m_max_url_size; }
+
+	incoming_http_msg_limits_t &
+	max_url_size( std::size_t value ) & noexcept
+	{
+		m_max_url_size = value;
+		return *this;
+	}
+
+	incoming_http_msg_limits_t &&
+	max_url_size( std::size_t value ) && noexcept
+	{
+		return std::move(this->max_url_size( value ));
+	}
+	//! \}
+
+	//! Max size of a header field name.
+	/*!
+	 * The violation of that limit is answered by 431
+	 * (Request Header Fields Too Large).
+	 */
+	//! \{
+	std::size_t
+	max_field_name_size() const noexcept { return m_max_field_name_size; }
+
+	incoming_http_msg_limits_t &
+	max_field_name_size( std::size_t value ) & noexcept
+	{
+		m_max_field_name_size = value;
+		return *this;
+	}
+
+	incoming_http_msg_limits_t &&
+	max_field_name_size( std::size_t value ) && noexcept
+	{
+		return std::move(this->max_field_name_size( value ));
+	}
+	//! \}
+
+	//! Max size of a header field value.
+	/*!
+	 * The violation of that limit is answered by 431
+	 * (Request Header Fields Too Large).
+	 */
+	//! \{
+	std::size_t
+	max_field_value_size() const noexcept { return m_max_field_value_size; }
+
+	incoming_http_msg_limits_t &
+	max_field_value_size( std::size_t value ) & noexcept
+	{
+		m_max_field_value_size = value;
+		return *this;
+	}
+
+	incoming_http_msg_limits_t &&
+	max_field_value_size( std::size_t value ) && noexcept
+	{
+		return std::move(this->max_field_value_size( value ));
+	}
+	//! \}
+
+	//! Max count of header fields.
+	/*!
+	 * The violation of that limit is answered by 431
+	 * (Request Header Fields Too Large).
+	 */
+	//! \{
+	std::size_t
+	max_field_count() const noexcept { return m_max_field_count; }
+
+	incoming_http_msg_limits_t &
+	max_field_count( std::size_t value ) & noexcept
+	{
+		m_max_field_count = value;
+		return *this;
+	}
+
+	incoming_http_msg_limits_t &&
+	max_field_count( std::size_t value ) && noexcept
+	{
+		return std::move(this->max_field_count( value ));
+	}
+	//! \}
+
+	//! Max size of a body.
+	/*!
+	 * The limit is applied to the body passed to a body sink too.
+	 * If Content-Length of a request exceeds that limit then the
+	 * request is rejected before the reading of the body.
+	 *
+	 * The violation of that limit is answered by 413 (Payload Too Large).
+	 */
+	//! \{
+	std::uint64_t
+	max_body_size() const noexcept { return m_max_body_size; }
+
+	incoming_http_msg_limits_t &
+	max_body_size( std::uint64_t value ) & noexcept
+	{
+		m_max_body_size = value;
+		return *this;
+	}
+
+	incoming_http_msg_limits_t &&
+	max_body_size( std::uint64_t value ) && noexcept
+	{
+		return std::move(this->max_body_size( value ));
+	}
+	//! \}
+};
+
+//
+// incoming_http_msg_limits_stats_t
+//
+/*!
+ * @brief Counters of violations of limits for incoming HTTP messages.
+ *
+ * An instance of that type can be passed to server settings and
+ * it will be updated by all connections of the server.
+ *
+ * Usage example:
+ * @code
+ * auto stats = std::make_shared< restinio::incoming_http_msg_limits_stats_t >();
+ * restinio::run(
+ * 	restinio::on_thread_pool(16)
+ * 		.incoming_http_msg_limits( ... )
+ * 		.incoming_http_msg_limits_stats( stats )
+ * 		...
+ * );
+ * ...
+ * std::cout << "rejected big bodies: " << stats->body_too_large() << std::endl;
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+class incoming_http_msg_limits_stats_t
+{
+	std::atomic< std::uint64_t > m_url_too_long{ 0u };
+	std::atomic< std::uint64_t > m_header_fields_too_large{ 0u };
+	std::atomic< std::uint64_t > m_body_too_large{ 0u };
+
+public:
+	//! Count of requests rejected because of max_url_size limit.
+	std::uint64_t
+	url_too_long() const noexcept { return m_url_too_long.load(); }
+
+	//! Count of requests rejected because of limits for header fields.
+	std::uint64_t
+	header_fields_too_large() const noexcept
+	{
+		return m_header_fields_too_large.load();
+	}
+
+	//! Count of requests rejected because of max_body_size limit.
+	std::uint64_t
+	body_too_large() const noexcept { return m_body_too_large.load(); }
+
+	//! Increment the count of requests with too long url.
+	void
+	inc_url_too_long() noexcept { ++m_url_too_long; }
+
+	//! Increment the count of requests with too large header fields.
+	void
+	inc_header_fields_too_large() noexcept { ++m_header_fields_too_large; }
+
+	//! Increment the count of requests with too large body.
+	void
+	inc_body_too_large() noexcept { ++m_body_too_large; }
+};
+
+} /* namespace restinio */
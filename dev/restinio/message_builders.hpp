@@ -8,9 +8,6 @@
 
 #pragma once
 
-#include <ctime>
-#include <chrono>
-
 #include <restinio/impl/include_fmtlib.hpp>
 
 #include <restinio/common_types.hpp>
@@ -24,33 +21,6 @@
 namespace restinio
 {
 
-//
-// make_date_field_value()
-//
-
-//! Format a timepoint to a string of a propper format.
-inline std::string
-make_date_field_value( std::time_t t )
-{
-	const auto tpoint = make_gmtime( t );
-
-	std::array< char, 64 > buf;
-	// TODO: is there a faster way to get time string?
-	strftime(
-		buf.data(),
-		buf.size(),
-		"%a, %d %b %Y %H:%M:%S GMT",
-		&tpoint );
-
-	return std::string{ buf.data() };
-}
-
-inline std::string
-make_date_field_value( std::chrono::system_clock::time_point tp )
-{
-	return make_date_field_value( std::chrono::system_clock::to_time_t( tp ) );
-}
-
 //
 // base_response_builder_t
 //
@@ -75,6 +45,10 @@ class base_response_builder_t
 			:	m_header{ std::move( status_line ) }
 			,	m_connection{ std::move( connection ) }
 			,	m_request_id{ request_id }
+			,	m_date_field_presence{
+					m_connection && m_connection->always_add_date_field() ?
+						impl::date_field_presence_t::add_if_absent :
+						impl::date_field_presence_t::as_is }
 		{
 			m_header.should_keep_alive( should_keep_alive );
 		}
@@ -163,7 +137,10 @@ class base_response_builder_t
 			std::chrono::system_clock::time_point tp =
 				std::chrono::system_clock::now() ) &
 		{
-			m_header.set_field( http_field_t::date, make_date_field_value( tp ) );
+			m_header.set_field(
+					http_field_t::date,
+					impl::cached_date_field_value(
+							std::chrono::system_clock::to_time_t( tp ) ) );
 			return upcast_reference();
 		}
 
@@ -214,11 +191,32 @@ class base_response_builder_t
 			return 8 + 1 + 3 + 1 + m_header.status_line().reason_phrase().size();
 		}
 
+		//! Serialize the header of the response.
+		/*!
+			@since v.0.6.9
+		*/
+		impl::header_buffer_t
+		create_header_buffer(
+			impl::content_length_field_presence_t content_length_field_presence =
+				impl::content_length_field_presence_t::add_content_length ) const
+		{
+			return impl::create_header_buffer(
+					m_header,
+					content_length_field_presence,
+					m_date_field_presence );
+		}
+
 		http_response_header_t m_header;
 
 		impl::connection_handle_t m_connection;
 		const request_id_t m_request_id;
 
+		//! Should `Date` field be added automatically?
+		/*!
+			@since v.0.6.9
+		*/
+		const impl::date_field_presence_t m_date_field_presence;
+
 		void
 		throw_done_must_be_called_once() const
 		{
@@ -315,7 +313,7 @@ class response_builder_t< restinio_controlled_output_t > final
 				if_neccessary_reserve_first_element_for_header();
 
 				m_response_parts[ 0 ] =
-					writable_item_t{ impl::create_header_string( m_header ) };
+					writable_item_t{ this->create_header_buffer() };
 
 				write_group_t wg{ std::move( m_response_parts ) };
 				wg.status_line_size( calculate_status_line_size() );
@@ -527,7 +525,7 @@ class response_builder_t< user_controlled_output_t > final
 				if_neccessary_reserve_first_element_for_header();
 
 				m_response_parts[ 0 ] =
-					writable_item_t{ impl::create_header_string( m_header ) };
+					writable_item_t{ this->create_header_buffer() };
 
 				m_header_was_sent = true;
 				status_line_size = calculate_status_line_size();
@@ -809,8 +807,7 @@ class response_builder_t< chunked_output_t > final
 			if( !m_header_was_sent )
 			{
 				bufs.emplace_back(
-					impl::create_header_string(
-						m_header,
+					this->create_header_buffer(
 						impl::content_length_field_presence_t::skip_content_length ) );
 			}
 
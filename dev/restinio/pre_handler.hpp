@@ -0,0 +1,201 @@
+/*
+ * RESTinio
+ */
+
+/*!
+ * @file
+ * @brief Stuff related to pre-handlers of incoming requests.
+ *
+ * @since v.0.6.9
+ */
+
+#pragma once
+
+#include <restinio/common_types.hpp>
+#include <restinio/http_headers.hpp>
+
+namespace restinio
+{
+
+namespace pre_handler
+{
+
+//
+// body_policy_t
+//
+/*!
+ * @brief Enumeration of policies of handling the body of accepted request.
+ *
+ * @since v.0.6.9
+ */
+enum class body_policy_t
+{
+	//! The body is read as usual.
+	/*!
+	 * It is accumulated in request_t::body() or is passed to a sink
+	 * created by body sink factory (if such a factory is used).
+	 */
+	accumulate,
+	//! The body is read from the connection but then thrown out.
+	/*!
+	 * Request handler will receive a request with an empty body.
+	 */
+	discard
+};
+
+//
+// verdict_t
+//
+/*!
+ * @brief Result of inspection of request's headers by a pre-handler.
+ *
+ * Instances of that type should be created by accept() and reject()
+ * helper functions.
+ *
+ * @since v.0.6.9
+ */
+class verdict_t
+{
+	bool m_accepted;
+	body_policy_t m_body_policy;
+	http_status_line_t m_status_line;
+
+	verdict_t(
+		bool accepted,
+		body_policy_t body_policy,
+		http_status_line_t status_line )
+		:	m_accepted{ accepted }
+		,	m_body_policy{ body_policy }
+		,	m_status_line{ std::move(status_line) }
+	{}
+
+public :
+	friend verdict_t
+	accept( body_policy_t body_policy );
+
+	friend verdict_t
+	reject( http_status_line_t status_line );
+
+	//! Is request accepted?
+	bool
+	accepted() const noexcept { return m_accepted; }
+
+	//! Policy for the body of accepted request.
+	body_policy_t
+	body_policy() const noexcept { return m_body_policy; }
+
+	//! Status line for the response to rejected request.
+	const http_status_line_t &
+	status_line() const noexcept { return m_status_line; }
+};
+
+/*!
+ * @brief Accept the request and read its body in the specified way.
+ *
+ * If the request contains `Expect: 100-continue` header then
+ * `100 Continue` response will be sent before reading the body.
+ *
+ * @note
+ * If there are responses to previous (pipelined) requests on the same
+ * connection that are not written yet then `100 Continue` is postponed
+ * until all of them are written. If the whole body is received before
+ * that (the client doesn't wait for the interim response) then
+ * `100 Continue` isn't sent at all.
+ *
+ * @since v.0.6.9
+ */
+inline verdict_t
+accept( body_policy_t body_policy = body_policy_t::accumulate )
+{
+	return verdict_t{ true, body_policy, status_ok() };
+}
+
+/*!
+ * @brief Reject the request without reading its body.
+ *
+ * A response with the specified status line, an empty body and
+ * `Connection: close` header will be sent to the client and then
+ * the connection will be closed.
+ *
+ * Usage example:
+ * @code
+ * restinio::pre_handler::verdict_t
+ * my_pre_handler::on_headers_complete(
+ * 	const restinio::pre_handler::incoming_info_t & info )
+ * {
+ * 	if( !info.header().has_field( restinio::http_field::authorization ) )
+ * 		return restinio::pre_handler::reject(
+ * 				restinio::status_unauthorized() );
+ * 	return restinio::pre_handler::accept();
+ * }
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+inline verdict_t
+reject( http_status_line_t status_line )
+{
+	return verdict_t{
+			false, body_policy_t::discard, std::move(status_line) };
+}
+
+//
+// incoming_info_t
+//
+/*!
+ * @brief An information about a request whose headers are parsed.
+ *
+ * @since v.0.6.9
+ */
+class incoming_info_t
+{
+	connection_id_t m_connection_id;
+	const endpoint_t & m_remote_endpoint;
+	const http_request_header_t & m_header;
+
+public :
+	//! Initializing constructor.
+	incoming_info_t(
+		connection_id_t connection_id,
+		const endpoint_t & remote_endpoint,
+		const http_request_header_t & header )
+		:	m_connection_id{ connection_id }
+		,	m_remote_endpoint{ remote_endpoint }
+		,	m_header{ header }
+	{}
+
+	//! ID of the connection the request came from.
+	connection_id_t
+	connection_id() const noexcept { return m_connection_id; }
+
+	//! Remote endpoint of the connection.
+	const endpoint_t &
+	remote_endpoint() const noexcept { return m_remote_endpoint; }
+
+	//! Headers of the request.
+	const http_request_header_t &
+	header() const noexcept { return m_header; }
+};
+
+//
+// noop_pre_handler_t
+//
+/*!
+ * @brief The default no-op pre-handler.
+ *
+ * This type is used for pre_handler_t trait by default.
+ *
+ * NOTE. When this type if used no calls to pre-handler will be generated.
+ * It means that there won't be any performance penalties related to
+ * invoking of pre-handler's on_headers_complete() method.
+ *
+ * @since v.0.6.9
+ */
+struct noop_pre_handler_t
+{
+	// empty type by design.
+};
+
+} /* namespace pre_handler */
+
+} /* namespace restinio */
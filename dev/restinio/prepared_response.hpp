@@ -0,0 +1,252 @@
+/*
+	restinio
+*/
+
+/*!
+	Pre-serialized responses.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <restinio/message_builders.hpp>
+#include <restinio/request_handler.hpp>
+
+#include <memory>
+#include <ctime>
+
+namespace restinio
+{
+
+//
+// prepared_response_t
+//
+
+//! A response that is serialized once and then sent many times.
+/*!
+	Status line, header fields and body are serialized to a buffer
+	in the constructor. Sending the prepared response is just
+	a write of that buffer without any formatting or copying.
+
+	There are two variants of the buffer: with `Connection: keep-alive`
+	and with `Connection: close`. The variant is selected by the
+	request the response is sent for. Content-Length field is added
+	automatically.
+
+	If the header has `Date` field (or the server is configured by
+	server_settings_t::always_add_date_field()) then `Date` field
+	with the current date is added to every response. The field is
+	sent as a separate buffer placed after the status line and
+	automatic fields. That buffer is taken from a thread-local cache
+	and is formatted not more often than once a second.
+
+	Buffers are immutable and shared between all responses which
+	are being sent, so a prepared response can be used from
+	different threads at the same time without any locking.
+
+	Usage example:
+	\code
+	restinio::http_response_header_t header{ restinio::status_ok() };
+	header.set_field( restinio::http_field::content_type, "text/plain" );
+	header.set_field( restinio::http_field::date, "" );
+
+	auto health = std::make_shared< restinio::prepared_response_t >(
+			std::move( header ), "OK" );
+
+	server_settings.request_handler(
+		[health]( auto req ) {
+			return health->send( req );
+		} );
+	\endcode
+
+	@since v.0.6.9
+*/
+class prepared_response_t
+{
+	public:
+		//! Type of pointer to a serialized response.
+		using buffer_handle_t = std::shared_ptr< const std::string >;
+
+		prepared_response_t( const prepared_response_t & ) = delete;
+		prepared_response_t & operator=( const prepared_response_t & ) = delete;
+
+		prepared_response_t(
+			//! Status line and fields of the response.
+			/*!
+				The values of `Connection` and `Content-Length` fields
+				are set automatically. The value of `Date` field is ignored.
+			*/
+			http_response_header_t header,
+			//! The body of the response.
+			std::string body )
+			:	m_has_date_field{ header.has_field( http_field_t::date ) }
+			// "HTTP/1.1 *** <reason-phrase>"
+			,	m_status_line_size{
+					8u + 1u + 3u + 1u + header.status_line().reason_phrase().size() }
+		{
+			header.remove_field( http_field_t::date );
+			header.content_length( body.size() );
+
+			header.should_keep_alive( true );
+			m_keep_alive = make_buffers( header, body );
+
+			header.should_keep_alive( false );
+			m_close = make_buffers( header, body );
+		}
+
+		//! Get the serialized response for a connection.
+		/*!
+			The buffer contains status line, all header fields and body.
+
+			If the response has `Date` field then a new buffer with
+			the current date is made on every call. Otherwise the
+			shared buffer is returned.
+		*/
+		buffer_handle_t
+		buffer( bool should_keep_alive ) const
+		{
+			const auto & buffers = select_buffers( should_keep_alive );
+			if( !m_has_date_field )
+				return buffers.m_whole;
+
+			const auto & date = date_field_line();
+
+			std::string data;
+			data.reserve( buffers.m_whole->size() + date->size() );
+			data.append( *buffers.m_before_date );
+			data.append( *date );
+			data.append( *buffers.m_after_date );
+
+			return std::make_shared< const std::string >( std::move( data ) );
+		}
+
+		//! Send the response for a request.
+		/*!
+			Like response_builder_t::done() it takes the connection from
+			the request, so only one response can be sent for a request.
+
+			@throw exception_t if a response was already created for
+			the request.
+		*/
+		request_handling_status_t
+		send(
+			const request_handle_t & req,
+			write_status_cb_t wscb = write_status_cb_t{} ) const
+		{
+			auto conn = std::move( impl::access_req_connection( *req ) );
+			if( !conn )
+				throw exception_t{ "connection already moved" };
+
+			const bool keep_alive = req->header().should_keep_alive();
+			const auto & buffers = select_buffers( keep_alive );
+
+			writable_items_container_t items;
+			if( m_has_date_field || conn->always_add_date_field() )
+			{
+				items.reserve( 3u );
+				items.emplace_back( buffers.m_before_date );
+				items.emplace_back( date_field_line() );
+				items.emplace_back( buffers.m_after_date );
+			}
+			else
+				items.emplace_back( buffers.m_whole );
+
+			write_group_t wg{ std::move( items ) };
+			wg.status_line_size( m_status_line_size );
+
+			if( wscb )
+				wg.after_write_notificator( std::move( wscb ) );
+
+			conn->write_response_parts(
+				req->request_id(),
+				response_output_flags_t{
+					response_parts_attr_t::final_parts,
+					response_connection_attr( keep_alive ) },
+				std::move( wg ) );
+
+			return request_accepted();
+		}
+
+	private:
+		//! Serialized variant of the response.
+		struct buffers_t
+		{
+			//! The whole response without `Date` field.
+			buffer_handle_t m_whole;
+			//! Status line and automatic fields.
+			buffer_handle_t m_before_date;
+			//! The rest of the response.
+			buffer_handle_t m_after_date;
+		};
+
+		static buffers_t
+		make_buffers( const http_response_header_t & header, const std::string & body )
+		{
+			auto data = impl::create_header_string( header );
+			data.append( body );
+
+			// Automatic fields are written just after the status line,
+			// Content-Length is the last of them.
+			static constexpr char content_length[] = "\r\nContent-Length: ";
+			const auto split_pos = data.find( "\r\n",
+					data.find( content_length ) + 2u ) + 2u;
+
+			buffers_t result;
+			result.m_before_date = std::make_shared< const std::string >(
+					data.substr( 0u, split_pos ) );
+			result.m_after_date = std::make_shared< const std::string >(
+					data.substr( split_pos ) );
+			result.m_whole = std::make_shared< const std::string >(
+					std::move( data ) );
+
+			return result;
+		}
+
+		//! `Date` field with the current date for the current thread.
+		static const buffer_handle_t &
+		date_field_line()
+		{
+			struct cache_t
+			{
+				std::time_t m_time{ static_cast< std::time_t >( -1 ) };
+				buffer_handle_t m_line;
+			};
+
+			thread_local cache_t cache;
+
+			const auto now = std::time( nullptr );
+			if( cache.m_time != now )
+			{
+				std::string line{ "Date: " };
+				line.append( impl::cached_date_field_value( now ) );
+				line.append( "\r\n" );
+
+				cache.m_line = std::make_shared< const std::string >(
+						std::move( line ) );
+				cache.m_time = now;
+			}
+
+			return cache.m_line;
+		}
+
+		const buffers_t &
+		select_buffers( bool should_keep_alive ) const noexcept
+		{
+			return should_keep_alive ? m_keep_alive : m_close;
+		}
+
+		const bool m_has_date_field;
+		const std::size_t m_status_line_size;
+
+		buffers_t m_keep_alive;
+		buffers_t m_close;
+};
+
+//! Alias for a shared pointer to prepared response.
+/*!
+	@since v.0.6.9
+*/
+using prepared_response_handle_t = std::shared_ptr< prepared_response_t >;
+
+} /* namespace restinio */
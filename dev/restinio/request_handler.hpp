@@ -14,6 +14,7 @@
 #include <restinio/exception.hpp>
 #include <restinio/http_headers.hpp>
 #include <restinio/message_builders.hpp>
+#include <restinio/incoming_body.hpp>
 #include <restinio/impl/connection_base.hpp>
 
 namespace restinio
@@ -59,6 +60,27 @@ class request_t final
 			,	m_remote_endpoint{ std::move( remote_endpoint ) }
 		{}
 
+		//! Constructor for the case when the body was passed to a sink.
+		/*!
+		 * @since v.0.6.9
+		 */
+		request_t(
+			request_id_t request_id,
+			http_request_header_t header,
+			std::string body,
+			incoming_body::sink_handle_t body_sink,
+			impl::connection_handle_t connection,
+			endpoint_t remote_endpoint )
+			:	request_t{
+					request_id,
+					std::move( header ),
+					std::move( body ),
+					std::move( connection ),
+					std::move( remote_endpoint ) }
+		{
+			m_body_sink = std::move( body_sink );
+		}
+
 		//! Get request header.
 		const http_request_header_t &
 		header() const noexcept
@@ -73,6 +95,19 @@ class request_t final
 			return m_body;
 		}
 
+		//! Get the sink the request body was passed to.
+		/*!
+		 * Returns nullptr if the body wasn't passed to a sink
+		 * and is accessible via body() method.
+		 *
+		 * @since v.0.6.9
+		 */
+		const incoming_body::sink_handle_t &
+		body_sink() const noexcept
+		{
+			return m_body_sink;
+		}
+
 		template < typename Output = restinio_controlled_output_t >
 		auto
 		create_response( http_status_line_t status_line = status_ok() )
@@ -109,6 +144,12 @@ class request_t final
 		const http_request_header_t m_header;
 		const std::string m_body;
 
+		//! Sink the body was passed to (if any).
+		/*!
+		 * @since v.0.6.9
+		 */
+		incoming_body::sink_handle_t m_body_sink;
+
 		impl::connection_handle_t m_connection;
 		const connection_id_t m_connection_id;
 
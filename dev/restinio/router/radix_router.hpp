@@ -0,0 +1,963 @@
+/*
+ * RESTinio
+ */
+
+/*!
+ * @file
+ * @brief A router based on a radix tree of route segments.
+ *
+ * @since v.0.6.9
+ */
+
+#pragma once
+
+#include <restinio/router/express.hpp>
+
+#include <restinio/impl/to_lower_lut.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace restinio
+{
+
+namespace router
+{
+
+namespace radix_router
+{
+
+namespace impl
+{
+
+using target_path_holder_t = restinio::router::impl::target_path_holder_t;
+
+//! A value for absence of route index.
+constexpr std::size_t no_route = std::numeric_limits< std::size_t >::max();
+
+//
+// segment_t
+//
+/*!
+ * @brief A description of one segment of a route path.
+ *
+ * @since v.0.6.9
+ */
+struct segment_t
+{
+	//! Is it a parameter?
+	bool m_is_param;
+	//! Text of a static segment (in lower case) or the name of a parameter.
+	std::string m_text;
+	//! Regex for a value of a parameter (empty if there is no constraint).
+	std::string m_pattern;
+};
+
+using segments_container_t = std::vector< segment_t >;
+
+/*!
+ * @brief Can all routes with those options be handled by a radix tree?
+ *
+ * Only the default options (case insensitive, optional trailing slash,
+ * matching of the whole path, '/' as the delimiter) are supported.
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline bool
+are_options_supported( const path2regex::options_t & options )
+{
+	return !options.sensitive() &&
+			!options.strict() &&
+			options.ending() &&
+			"/" == options.delimiter() &&
+			std::string::npos != options.delimiters().find( '/' ) &&
+			options.ends_with().empty();
+}
+
+/*!
+ * @brief Is a char from the set of `\w` in a regex?
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline bool
+is_word_char( char ch ) noexcept
+{
+	return ( 'a' <= ch && ch <= 'z' ) || ( 'A' <= ch && ch <= 'Z' ) ||
+			( '0' <= ch && ch <= '9' ) || '_' == ch;
+}
+
+/*!
+ * @brief Can a pattern of a parameter be matched against a single segment?
+ *
+ * It is true if the pattern can't match the delimiter ('/') and
+ * can't look outside of the value of the parameter. The check is
+ * conservative: a pattern like `[^0-9]+` is treated as unsafe.
+ * A range in a character class (like `[!-0]`) is unsafe if it
+ * contains '/'.
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline bool
+is_segment_local_pattern( string_view_t pattern ) noexcept
+{
+	// Only \d, \w, \s, \b and \B can't match '/'.
+	const auto is_safe_class_escape = []( char ch ) {
+		return std::string::npos != string_view_t{ "dwsbB" }.find( ch );
+	};
+
+	bool inside_class = false;
+	for( std::size_t i = 0u; i != pattern.size(); ++i )
+	{
+		char ch = pattern[ i ];
+		bool escaped = false;
+		if( '\\' == ch )
+		{
+			// The pattern is already checked for a trailing backslash.
+			ch = pattern[ ++i ];
+			if( is_word_char( ch ) )
+			{
+				if( !is_safe_class_escape( ch ) )
+					return false;
+
+				// A class escape isn't a bound of a range.
+				continue;
+			}
+			escaped = true;
+		}
+		else if( '.' == ch || '^' == ch )
+			return false;
+
+		if( '/' == ch )
+			return false;
+
+		if( !inside_class )
+			inside_class = !escaped && '[' == ch;
+		else if( !escaped && ']' == ch )
+			inside_class = false;
+		else if( i + 2u < pattern.size() && '-' == pattern[ i + 1u ] &&
+			']' != pattern[ i + 2u ] )
+		{
+			// A range like `a-z`.
+			i += 2u;
+			char last = pattern[ i ];
+			if( '\\' == last )
+			{
+				if( i + 1u == pattern.size() )
+					return false;
+
+				last = pattern[ ++i ];
+				if( is_word_char( last ) )
+					// Ranges with escapes like `\x2F` aren't analyzed.
+					return false;
+			}
+
+			if( static_cast< unsigned char >( ch ) <= '/' &&
+				'/' <= static_cast< unsigned char >( last ) )
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/*!
+ * @brief Split an express-style route path into segments.
+ *
+ * Only routes in which every segment is a plain text or a whole
+ * `:name` / `:name(pattern)` parameter are split. Empty optional is
+ * returned for all other routes (with optional or repeated parameters,
+ * unnamed groups, escaped chars, several parameters in one segment
+ * and so on), such routes are handled by regexes.
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline optional_t< segments_container_t >
+try_split_route( string_view_t route_path )
+{
+	const unsigned char * const table =
+			restinio::impl::to_lower_lut< unsigned char >();
+
+	if( route_path.empty() || '/' != route_path[ 0u ] )
+		return nullopt;
+
+	segments_container_t result;
+
+	std::size_t pos = 1u;
+	const std::size_t size = route_path.size();
+	while( pos != size )
+	{
+		// An empty segment or a trailing slash.
+		if( '/' == route_path[ pos ] )
+			return nullopt;
+
+		if( ':' == route_path[ pos ] )
+		{
+			const auto name_start = ++pos;
+			while( pos != size && is_word_char( route_path[ pos ] ) )
+				++pos;
+			if( name_start == pos )
+				return nullopt;
+
+			segment_t segment{
+					true,
+					std::string{ route_path.data() + name_start, pos - name_start },
+					std::string{} };
+
+			if( pos != size && '(' == route_path[ pos ] )
+			{
+				const auto pattern_start = ++pos;
+				while( pos != size && ')' != route_path[ pos ] )
+				{
+					if( '(' == route_path[ pos ] )
+						return nullopt;
+					if( '\\' == route_path[ pos ] && ++pos == size )
+						return nullopt;
+					++pos;
+				}
+				if( pos == size || pattern_start == pos )
+					return nullopt;
+
+				const string_view_t pattern{
+						route_path.data() + pattern_start, pos - pattern_start };
+				if( !is_segment_local_pattern( pattern ) )
+					return nullopt;
+
+				segment.m_pattern.assign( pattern.data(), pattern.size() );
+				++pos; // Skip ')'.
+			}
+
+			result.push_back( std::move( segment ) );
+		}
+		else
+		{
+			segment_t segment{ false, std::string{}, std::string{} };
+			for(; pos != size && '/' != route_path[ pos ]; ++pos )
+			{
+				const char ch = route_path[ pos ];
+				if( '\\' == ch || ':' == ch || '(' == ch || ')' == ch ||
+					'*' == ch || '+' == ch || '?' == ch )
+					return nullopt;
+
+				segment.m_text += static_cast< char >(
+						table[ static_cast< unsigned char >( ch ) ] );
+			}
+
+			result.push_back( std::move( segment ) );
+		}
+
+		if( pos != size )
+		{
+			// Something like `:name.ext` or `:name?`.
+			if( '/' != route_path[ pos ] )
+				return nullopt;
+			++pos;
+			// A trailing slash.
+			if( pos == size )
+				return nullopt;
+		}
+	}
+
+	return result;
+}
+
+/*!
+ * @brief Caseless comparison of a key of a static node with a segment.
+ *
+ * @note
+ * The key is expected to be in lower case already.
+ *
+ * @since v.0.6.9
+ */
+RESTINIO_NODISCARD
+inline int
+compare_with_segment( string_view_t key, string_view_t segment ) noexcept
+{
+	const unsigned char * const table =
+			restinio::impl::to_lower_lut< unsigned char >();
+
+	const auto n = std::min( key.size(), segment.size() );
+	for( std::size_t i = 0u; i != n; ++i )
+	{
+		const auto a = static_cast< unsigned char >( key[ i ] );
+		const auto b = table[ static_cast< unsigned char >( segment[ i ] ) ];
+		if( a != b )
+			return a < b ? -1 : 1;
+	}
+
+	if( key.size() == segment.size() )
+		return 0;
+
+	return key.size() < segment.size() ? -1 : 1;
+}
+
+//
+// node_t
+//
+/*!
+ * @brief A node of the radix tree.
+ *
+ * @since v.0.6.9
+ */
+template< typename Regex_Engine >
+struct node_t
+{
+	using regex_t = typename Regex_Engine::compiled_regex_t;
+
+	//! Child node for a parameter.
+	struct param_child_t
+	{
+		//! Pattern for the value (empty if there is no constraint).
+		std::string m_pattern;
+		//! Compiled pattern (if m_pattern isn't empty).
+		regex_t m_regex;
+		std::unique_ptr< node_t > m_node;
+	};
+
+	//! Child nodes for static segments.
+	/*!
+	 * Sorted by the key for binary search.
+	 */
+	std::vector< std::pair< std::string, std::unique_ptr< node_t > > >
+			m_static_children;
+
+	//! Child nodes for parameters.
+	std::vector< param_child_t > m_param_children;
+
+	//! Indexes of routes that end in this node (in ascending order).
+	std::vector< std::size_t > m_routes;
+
+	//! The minimal index of a route in this node and all its children.
+	/*!
+	 * It allows to skip the whole subtree if a better route is
+	 * already found.
+	 */
+	std::size_t m_min_route_index{ no_route };
+
+	RESTINIO_NODISCARD
+	const node_t *
+	find_static_child( string_view_t segment ) const noexcept
+	{
+		const auto it = std::lower_bound(
+				m_static_children.begin(), m_static_children.end(),
+				segment,
+				[]( const auto & child, string_view_t s ) {
+					return compare_with_segment( child.first, s ) < 0;
+				} );
+
+		if( it != m_static_children.end() &&
+				0 == compare_with_segment( it->first, segment ) )
+			return it->second.get();
+
+		return nullptr;
+	}
+
+	RESTINIO_NODISCARD
+	node_t &
+	make_static_child( const std::string & key )
+	{
+		auto it = std::lower_bound(
+				m_static_children.begin(), m_static_children.end(),
+				key,
+				[]( const auto & child, const std::string & k ) {
+					return child.first < k;
+				} );
+
+		if( it == m_static_children.end() || it->first != key )
+			it = m_static_children.emplace(
+					it, key, std::make_unique< node_t >() );
+
+		return *(it->second);
+	}
+
+	RESTINIO_NODISCARD
+	node_t &
+	make_param_child( const std::string & pattern )
+	{
+		for( auto & child : m_param_children )
+			if( child.m_pattern == pattern )
+				return *(child.m_node);
+
+		param_child_t child;
+		child.m_pattern = pattern;
+		if( !pattern.empty() )
+			// The same transformation of the pattern as in path2regex.
+			child.m_regex = Regex_Engine::compile_regex(
+					"^(?:" + path2regex::impl::escape_group( pattern ) + ")$",
+					false );
+		child.m_node = std::make_unique< node_t >();
+
+		m_param_children.push_back( std::move( child ) );
+
+		return *(m_param_children.back().m_node);
+	}
+};
+
+//
+// route_t
+//
+/*!
+ * @brief A route stored in the radix tree.
+ *
+ * @since v.0.6.9
+ */
+struct route_t
+{
+	//! Index of the route in the order of addition.
+	std::size_t m_index;
+
+	//! Matcher for HTTP method.
+	restinio::router::impl::buffered_matcher_holder_t m_method_matcher;
+
+	//! Buffer for names of parameters.
+	std::shared_ptr< std::string > m_names_buffer;
+
+	//! Names of parameters in the order of appearance.
+	/*!
+	 * Views refer to m_names_buffer.
+	 */
+	std::vector< string_view_t > m_param_names;
+
+	express_request_handler_t m_handler;
+};
+
+//
+// capture_t
+//
+/*!
+ * @brief Position of a value of a parameter in the target path.
+ *
+ * @since v.0.6.9
+ */
+struct capture_t
+{
+	std::size_t m_pos;
+	std::size_t m_size;
+};
+
+using captures_container_t = std::vector< capture_t >;
+
+//
+// search_state_t
+//
+/*!
+ * @brief The state of the search of a route in the radix tree.
+ *
+ * @since v.0.6.9
+ */
+struct search_state_t
+{
+	search_state_t( http_method_id_t method, string_view_t path )
+		:	m_method{ method }
+		,	m_path{ path }
+	{}
+
+	//! HTTP method of the request.
+	http_method_id_t m_method;
+
+	//! Target path with the leading slash.
+	string_view_t m_path;
+
+	//! The end of the path without an optional trailing slash.
+	std::size_t m_end{ 0u };
+
+	//! Values of parameters for the current branch.
+	captures_container_t m_captures;
+
+	//! The index of the best route found.
+	std::size_t m_best_index{ no_route };
+
+	//! Position of the best route in the list of routes.
+	std::size_t m_best_route{ no_route };
+
+	//! Values of parameters for the best route.
+	captures_container_t m_best_captures;
+};
+
+} /* namespace impl */
+
+} /* namespace radix_router */
+
+//
+// radix_router_t
+//
+/*!
+ * @brief A router that stores routes in a radix tree.
+ *
+ * This router accepts the same express-style routes and handlers as
+ * express_router_t and can be used as a drop-in replacement for it.
+ * But the most of routes are not converted to regexes. Routes are split
+ * into segments and stored in a tree, so the matching of a request is
+ * performed segment by segment:
+ *
+ * - static segments are found by binary search in the children of a node;
+ * - `:name` parameters match any non-empty segment;
+ * - `:name(pattern)` parameters run a regex only for their segment.
+ *
+ * Routes that can't be represented in the tree (with optional or repeated
+ * parameters, unnamed groups, several parameters in one segment,
+ * non-default path2regex::options_t and so on) are handled by regexes
+ * in the same way as in express_router_t.
+ *
+ * The order of routes is respected as in express_router_t: if a request
+ * matches several routes then the first added route is selected.
+ *
+ * Usage example:
+ * @code
+ * auto make_router() {
+ * 	auto router = std::make_unique< restinio::router::radix_router_t<> >();
+ *
+ * 	router->http_get( "/api/v1/users/:id(\\d+)",
+ * 		[]( auto req, auto params ) {...} );
+ * 	router->http_get( "/api/v1/users/:id(\\d+)/posts/:post",
+ * 		[]( auto req, auto params ) {...} );
+ * 	router->http_get( "/static/:file(.*)",  // Handled by regex.
+ * 		[]( auto req, auto params ) {...} );
+ *
+ * 	return router;
+ * }
+ * ...
+ * struct traits_t : public restinio::default_traits_t {
+ * 	using request_handler_t = restinio::router::radix_router_t<>;
+ * }
+ * @endcode
+ *
+ * @since v.0.6.9
+ */
+template< typename Regex_Engine = std_regex_engine_t >
+class radix_router_t
+{
+	using node_t = radix_router::impl::node_t< Regex_Engine >;
+	using route_t = radix_router::impl::route_t;
+	using search_state_t = radix_router::impl::search_state_t;
+	using regex_route_t = express_route_entry_t< Regex_Engine >;
+
+public:
+	radix_router_t() = default;
+	radix_router_t( radix_router_t && ) = default;
+
+	RESTINIO_NODISCARD
+	request_handling_status_t
+	operator()( request_handle_t req ) const
+	{
+		using namespace radix_router::impl;
+
+		target_path_holder_t target_path{ req->header().path() };
+
+		search_state_t state{ req->header().method(), target_path.view() };
+		search_in_tree( state );
+
+		// Routes with regexes are checked only if they are added
+		// before the route found in the tree.
+		route_params_t params;
+		for( const auto & r : m_regex_routes )
+		{
+			if( r.first >= state.m_best_index )
+				break;
+
+			if( r.second.match( req->header(), target_path, params ) )
+				return r.second.handle( std::move( req ), std::move( params ) );
+		}
+
+		if( no_route != state.m_best_route )
+		{
+			const auto & route = m_routes[ state.m_best_route ];
+			make_params( route, state, target_path, params );
+
+			return route.m_handler( std::move( req ), std::move( params ) );
+		}
+
+		// Here: none of the routes matches this handler.
+		if( m_non_matched_request_handler )
+		{
+			// If non matched request handler is set
+			// then call it.
+			return m_non_matched_request_handler( std::move( req ) );
+		}
+
+		return request_rejected();
+	}
+
+	//! Add handlers.
+	//! \{
+	template< typename Method_Matcher >
+	void
+	add_handler(
+		Method_Matcher && method_matcher,
+		string_view_t route_path,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			std::forward<Method_Matcher>(method_matcher),
+			route_path,
+			path2regex::options_t{},
+			std::move( handler ) );
+	}
+
+	template< typename Method_Matcher >
+	void
+	add_handler(
+		Method_Matcher && method_matcher,
+		string_view_t route_path,
+		const path2regex::options_t & options,
+		express_request_handler_t handler )
+	{
+		using namespace radix_router::impl;
+
+		const auto index = m_routes_count;
+
+		optional_t< segments_container_t > segments;
+		if( are_options_supported( options ) )
+			segments = try_split_route( route_path );
+
+		if( segments )
+			add_to_tree(
+				index,
+				std::forward<Method_Matcher>(method_matcher),
+				route_path,
+				*segments,
+				std::move( handler ) );
+		else
+			m_regex_routes.emplace_back(
+				index,
+				regex_route_t{
+					std::forward<Method_Matcher>(method_matcher),
+					route_path,
+					options,
+					std::move( handler ) } );
+
+		++m_routes_count;
+	}
+
+	void
+	http_delete(
+		string_view_t route_path,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_delete(),
+			route_path,
+			std::move( handler ) );
+	}
+
+	void
+	http_delete(
+		string_view_t route_path,
+		const path2regex::options_t & options,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_delete(),
+			route_path,
+			options,
+			std::move( handler ) );
+	}
+
+	void
+	http_get(
+		string_view_t route_path,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_get(),
+			route_path,
+			std::move( handler ) );
+	}
+
+	void
+	http_get(
+		string_view_t route_path,
+		const path2regex::options_t & options,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_get(),
+			route_path,
+			options,
+			std::move( handler ) );
+	}
+
+	void
+	http_head(
+		string_view_t route_path,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_head(),
+			route_path,
+			std::move( handler ) );
+	}
+
+	void
+	http_head(
+		string_view_t route_path,
+		const path2regex::options_t & options,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_head(),
+			route_path,
+			options,
+			std::move( handler ) );
+	}
+
+	void
+	http_post(
+		string_view_t route_path,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_post(),
+			route_path,
+			std::move( handler ) );
+	}
+
+	void
+	http_post(
+		string_view_t route_path,
+		const path2regex::options_t & options,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_post(),
+			route_path,
+			options,
+			std::move( handler ) );
+	}
+
+	void
+	http_put(
+		string_view_t route_path,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_put(),
+			route_path,
+			std::move( handler ) );
+	}
+
+	void
+	http_put(
+		string_view_t route_path,
+		const path2regex::options_t & options,
+		express_request_handler_t handler )
+	{
+		add_handler(
+			http_method_put(),
+			route_path,
+			options,
+			std::move( handler ) );
+	}
+	//! \}
+
+	//! Set handler for requests that don't match any route.
+	void
+	non_matched_request_handler( non_matched_request_handler_t nmrh )
+	{
+		m_non_matched_request_handler= std::move( nmrh );
+	}
+
+	//! Count of routes that are handled by regexes.
+	/*!
+	 * It can be used to check that all performance critical routes
+	 * are stored in the radix tree.
+	 */
+	RESTINIO_NODISCARD
+	std::size_t
+	regex_routes_count() const noexcept
+	{
+		return m_regex_routes.size();
+	}
+
+private:
+	template< typename Method_Matcher >
+	void
+	add_to_tree(
+		std::size_t index,
+		Method_Matcher && method_matcher,
+		string_view_t route_path,
+		const radix_router::impl::segments_container_t & segments,
+		express_request_handler_t handler )
+	{
+		route_t route;
+		route.m_index = index;
+		assign(
+				route.m_method_matcher,
+				std::forward<Method_Matcher>(method_matcher) );
+		route.m_names_buffer = std::make_shared< std::string >();
+		route.m_handler = std::move( handler );
+
+		path2regex::impl::names_buffer_appender_t names_appender{
+				route_path.size(), *route.m_names_buffer };
+
+		node_t * node = &m_root;
+		node->m_min_route_index = std::min( node->m_min_route_index, index );
+		try
+		{
+			for( const auto & s : segments )
+			{
+				if( s.m_is_param )
+				{
+					node = &( node->make_param_child( s.m_pattern ) );
+					route.m_param_names.push_back(
+							names_appender.append_name( s.m_text ) );
+				}
+				else
+					node = &( node->make_static_child( s.m_text ) );
+
+				node->m_min_route_index =
+						std::min( node->m_min_route_index, index );
+			}
+		}
+		catch( const std::exception & ex )
+		{
+			throw exception_t{
+				fmt::format( "unable to process route \"{}\": {}",
+						route_path, ex.what() ) };
+		}
+
+		node->m_routes.push_back( m_routes.size() );
+		m_routes.push_back( std::move( route ) );
+	}
+
+	void
+	search_in_tree( search_state_t & state ) const
+	{
+		const auto & path = state.m_path;
+		if( path.empty() || '/' != path[ 0u ] )
+			return;
+
+		// Take care of an optional trailing slash.
+		state.m_end = path.size();
+		if( state.m_end > 1u && '/' == path[ state.m_end - 1u ] )
+			--state.m_end;
+
+		search_in_node(
+				m_root,
+				1u == state.m_end ? radix_router::impl::no_route : 1u,
+				state );
+	}
+
+	//! Search for a route in a subtree.
+	/*!
+	 * @a pos is the position of the next segment in the path or
+	 * radix_router::impl::no_route if the whole path is consumed.
+	 */
+	void
+	search_in_node(
+		const node_t & node,
+		std::size_t pos,
+		search_state_t & state ) const
+	{
+		using namespace radix_router::impl;
+
+		// There is no need to check the subtree if all its routes
+		// were added after the best route found.
+		if( node.m_min_route_index >= state.m_best_index )
+			return;
+
+		if( no_route == pos )
+		{
+			for( const auto r : node.m_routes )
+			{
+				const auto & route = m_routes[ r ];
+				if( route.m_index >= state.m_best_index )
+					break;
+
+				if( route.m_method_matcher->match( state.m_method ) )
+				{
+					state.m_best_index = route.m_index;
+					state.m_best_route = r;
+					state.m_best_captures = state.m_captures;
+					break;
+				}
+			}
+
+			return;
+		}
+
+		auto segment_end = state.m_path.find( '/', pos );
+		if( string_view_t::npos == segment_end || segment_end > state.m_end )
+			segment_end = state.m_end;
+
+		const string_view_t segment{
+				state.m_path.data() + pos, segment_end - pos };
+		const auto next_pos = segment_end == state.m_end ?
+				no_route : segment_end + 1u;
+
+		if( const auto * child = node.find_static_child( segment ) )
+			search_in_node( *child, next_pos, state );
+
+		if( segment.empty() )
+			return;
+
+		for( const auto & child : node.m_param_children )
+		{
+			if( !child.m_pattern.empty() )
+			{
+				typename Regex_Engine::match_results_t matches;
+				if( !Regex_Engine::try_match( segment, child.m_regex, matches ) )
+					continue;
+			}
+
+			state.m_captures.push_back( capture_t{ pos, segment.size() } );
+			search_in_node( *child.m_node, next_pos, state );
+			state.m_captures.pop_back();
+		}
+	}
+
+	void
+	make_params(
+		const route_t & route,
+		const search_state_t & state,
+		radix_router::impl::target_path_holder_t & target_path,
+		route_params_t & params ) const
+	{
+		auto data = target_path.giveout_data();
+
+		route_params_t::named_parameters_container_t named_parameters;
+		named_parameters.reserve( state.m_best_captures.size() );
+		for( std::size_t i = 0u; i != state.m_best_captures.size(); ++i )
+		{
+			const auto & c = state.m_best_captures[ i ];
+			named_parameters.emplace_back(
+					route.m_param_names[ i ],
+					string_view_t{ data.get() + c.m_pos, c.m_size } );
+		}
+
+		const string_view_t match{ data.get(), state.m_path.size() };
+
+		restinio::router::impl::route_params_accessor_t::match(
+				params,
+				std::move( data ),
+				route.m_names_buffer,
+				match,
+				std::move( named_parameters ),
+				route_params_t::indexed_parameters_container_t{} );
+	}
+
+	//! The root of the tree.
+	node_t m_root;
+
+	//! Routes stored in the tree.
+	std::vector< route_t > m_routes;
+
+	//! Routes handled by regexes with their indexes.
+	std::vector< std::pair< std::size_t, regex_route_t > > m_regex_routes;
+
+	//! Total count of routes.
+	std::size_t m_routes_count{ 0u };
+
+	//! Handler that is called for requests that don't match any route.
+	non_matched_request_handler_t m_non_matched_request_handler;
+};
+
+} /* namespace router */
+
+} /* namespace restinio */
@@ -13,6 +13,8 @@
 #include <string>
 #include <chrono>
 #include <array>
+#include <memory>
+#include <functional>
 
 #include <restinio/impl/include_fmtlib.hpp>
 
@@ -211,6 +213,63 @@ class file_meta_t
 		std::chrono::system_clock::time_point  m_last_modified_at{};
 };
 
+//
+// async_file_reader_t
+//
+
+//! An interface of a reader that reads files without blocking the caller.
+/*!
+	An instance of async_file_reader_t can be passed to sendfile_t
+	(see sendfile_t::file_reader()). In that case file data is read
+	asynchronously by the reader instead of blocking reads on
+	the thread that serves the connection (it is applicable to
+	implementations of sendfile operation that can't use native
+	sendfile(), for example, for TLS-connections on POSIX platforms).
+
+	Ready to use implementations can be found in
+	restinio/async_file_reader.hpp.
+
+	@since v.0.6.9
+*/
+class async_file_reader_t
+{
+	public:
+		//! Type of completion handler for read operation.
+		/*!
+			The handler receives an error code and the count of bytes read.
+			Zero count without an error means the end of file.
+
+			The handler is called exactly once and can be called on
+			a thread owned by the reader. The reader doesn't use the handler
+			after its invocation, so the handler is allowed to move
+			its captured state away.
+		*/
+		using completion_handler_t =
+			std::function< void ( const asio_ns::error_code &, std::size_t ) >;
+
+		virtual ~async_file_reader_t() = default;
+
+		//! Initiate reading of up to @a size bytes from @a offset.
+		/*!
+			The @a buffer must remain valid until @a handler is called.
+
+			Throws if the operation can't be initiated.
+		*/
+		virtual void
+		async_read(
+			file_descriptor_t fd,
+			file_offset_t offset,
+			char * buffer,
+			std::size_t size,
+			completion_handler_t handler ) = 0;
+};
+
+//! An alias for shared pointer to async file reader.
+/*!
+	@since v.0.6.9
+*/
+using async_file_reader_handle_t = std::shared_ptr< async_file_reader_t >;
+
 //
 // sendfile_t
 //
@@ -255,6 +314,7 @@ class sendfile_t
 			swap( left.m_size, right.m_size );
 			swap( left.m_chunk_size, right.m_chunk_size );
 			swap( left.m_timelimit, right.m_timelimit );
+			swap( left.m_file_reader, right.m_file_reader );
 		}
 
 		/** @name Copy semantics.
@@ -276,6 +336,7 @@ class sendfile_t
 			,	m_size{ sf.m_size }
 			,	m_chunk_size{ sf.m_chunk_size }
 			,	m_timelimit{ sf.m_timelimit }
+			,	m_file_reader{ std::move( sf.m_file_reader ) }
 		{}
 
 		sendfile_t & operator = ( sendfile_t && sf ) noexcept
@@ -396,6 +457,46 @@ class sendfile_t
 		}
 		///@}
 
+		//! Get async file reader for this operation.
+		/*!
+			@since v.0.6.9
+		*/
+		const async_file_reader_handle_t &
+		file_reader() const noexcept { return m_file_reader; }
+
+		/** @name Set async file reader.
+		 * @brief Set the reader to be used instead of blocking reads
+		 * of file data.
+		 *
+		 * Usage example:
+		 * @code
+		 * // Should be created once and shared between requests.
+		 * auto reader = restinio::make_async_file_reader();
+		 * ...
+		 * req->create_response()
+		 * 	.set_body( restinio::sendfile( path ).file_reader( reader ) )
+		 * 	.done();
+		 * @endcode
+		 *
+		 * @since v.0.6.9
+		*/
+		///@{
+		sendfile_t &
+		file_reader( async_file_reader_handle_t reader ) &
+		{
+			check_file_is_valid();
+
+			m_file_reader = std::move( reader );
+			return *this;
+		}
+
+		sendfile_t &&
+		file_reader( async_file_reader_handle_t reader ) &&
+		{
+			return std::move( this->file_reader( std::move( reader ) ) );
+		}
+		///@}
+
 		//! Get the file descriptor of a given sendfile operation.
 		file_descriptor_t
 		file_descriptor() const noexcept
@@ -452,6 +553,14 @@ class sendfile_t
 			Zero value stands for default write operation timeout.
 		*/
 		std::chrono::steady_clock::duration m_timelimit{ std::chrono::steady_clock::duration::zero() };
+
+		//! Reader for async reading of file data.
+		/*!
+			Empty value means that file data is read in the usual way.
+
+			@since v.0.6.9
+		*/
+		async_file_reader_handle_t m_file_reader;
 };
 
 //
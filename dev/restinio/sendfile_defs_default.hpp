@@ -90,6 +90,19 @@ close_file( file_descriptor_t fd )
 {
 	std::fclose( fd );
 }
+
+//! Write the whole data to a file.
+/*!
+	@since v.0.6.9
+*/
+inline void
+write_file( file_descriptor_t fd, const char * data, std::size_t size )
+{
+	if( size != std::fwrite( data, 1u, size, fd ) )
+	{
+		throw exception_t{ "unable to write file" };
+	}
+}
 ///@}
 
 } /* namespace restinio */
@@ -13,6 +13,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
 
 #include <iostream>
 
@@ -107,6 +108,30 @@ close_file( file_descriptor_t fd )
 {
 	::close( fd );
 }
+
+//! Write the whole data to a file.
+/*!
+	@since v.0.6.9
+*/
+inline void
+write_file( file_descriptor_t fd, const char * data, std::size_t size )
+{
+	while( 0u != size )
+	{
+		const auto n = ::write( fd, data, size );
+		if( n < 0 )
+		{
+			if( EINTR == errno )
+				continue;
+
+			throw exception_t{
+				fmt::format( "unable to write file: {}", strerror( errno ) ) };
+		}
+
+		data += n;
+		size -= static_cast< std::size_t >( n );
+	}
+}
 ///@}
 
 } /* namespace restinio */
@@ -121,6 +121,32 @@ close_file( file_descriptor_t fd )
 {
 	CloseHandle( fd );
 }
+
+//! Write the whole data to a file.
+/*!
+	@since v.0.6.9
+*/
+inline void
+write_file( file_descriptor_t fd, const char * data, std::size_t size )
+{
+	while( 0u != size )
+	{
+		const DWORD portion = static_cast< DWORD >(
+				(std::min)( size, std::size_t{ 0x40000000u } ) );
+		DWORD written = 0;
+
+		if( !WriteFile( fd, data, portion, &written, nullptr ) )
+		{
+			throw exception_t{
+				fmt::format(
+					"unable to write file: error code:{}",
+					GetLastError() ) };
+		}
+
+		data += written;
+		size -= written;
+	}
+}
 ///@}
 
 } /* namespace restinio */
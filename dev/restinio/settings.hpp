@@ -15,6 +15,7 @@
 #include <restinio/asio_include.hpp>
 
 #include <restinio/exception.hpp>
+#include <restinio/incoming_http_msg_limits.hpp>
 #include <restinio/request_handler.hpp>
 #include <restinio/traits.hpp>
 
@@ -418,6 +419,125 @@ struct ip_blocker_holder_t< ip_blocker::noop_ip_blocker_t >
 	}
 };
 
+//
+// body_sink_factory_holder_t
+//
+/*!
+ * @brief A special class for holding actual body sink factory object.
+ *
+ * This class holds shared pointer to actual body sink factory
+ * and provides an actual implementation of
+ * check_valid_body_sink_factory_pointer() method.
+ *
+ * @since v.0.6.9
+ */
+template< typename Body_Sink_Factory >
+struct body_sink_factory_holder_t
+{
+	static_assert(
+			std::is_same<
+					incoming_body::sink_handle_t,
+					decltype(std::declval<Body_Sink_Factory>().make_sink(
+							std::declval<const http_request_header_t &>(),
+							std::declval<incoming_body::resumer_t>())) >::value,
+			"Body_Sink_Factory::make_sink() should return "
+			"restinio::incoming_body::sink_handle_t" );
+
+	std::shared_ptr< Body_Sink_Factory > m_body_sink_factory;
+
+	static constexpr bool has_actual_body_sink_factory = true;
+
+	//! Checks that pointer to body sink factory is not null.
+	/*!
+	 * Throws an exception if m_body_sink_factory is nullptr.
+	 */
+	void
+	check_valid_body_sink_factory_pointer() const
+	{
+		if( !m_body_sink_factory )
+			throw exception_t{ "body sink factory is not specified" };
+	}
+};
+
+/*!
+ * @brief A special class for case when no-op body sink factory is used.
+ *
+ * Doesn't hold anything and contains empty
+ * check_valid_body_sink_factory_pointer() method.
+ *
+ * @since v.0.6.9
+ */
+template<>
+struct body_sink_factory_holder_t< incoming_body::noop_sink_factory_t >
+{
+	static constexpr bool has_actual_body_sink_factory = false;
+
+	void
+	check_valid_body_sink_factory_pointer() const
+	{
+		// Nothing to do.
+	}
+};
+
+//
+// pre_handler_holder_t
+//
+/*!
+ * @brief A special class for holding actual pre-handler object.
+ *
+ * This class holds shared pointer to actual pre-handler
+ * and provides an actual implementation of
+ * check_valid_pre_handler_pointer() method.
+ *
+ * @since v.0.6.9
+ */
+template< typename Pre_Handler >
+struct pre_handler_holder_t
+{
+	static_assert(
+			std::is_same<
+					restinio::pre_handler::verdict_t,
+					decltype(std::declval<Pre_Handler>().on_headers_complete(
+							std::declval<const pre_handler::incoming_info_t &>())) >::value,
+			"Pre_Handler::on_headers_complete() should return "
+			"restinio::pre_handler::verdict_t" );
+
+	std::shared_ptr< Pre_Handler > m_pre_handler;
+
+	static constexpr bool has_actual_pre_handler = true;
+
+	//! Checks that pointer to pre-handler is not null.
+	/*!
+	 * Throws an exception if m_pre_handler is nullptr.
+	 */
+	void
+	check_valid_pre_handler_pointer() const
+	{
+		if( !m_pre_handler )
+			throw exception_t{ "pre-handler is not specified" };
+	}
+};
+
+/*!
+ * @brief A special class for case when no-op pre-handler is used.
+ *
+ * Doesn't hold anything and contains empty
+ * check_valid_pre_handler_pointer() method.
+ *
+ * @since v.0.6.9
+ */
+template<>
+struct pre_handler_holder_t< pre_handler::noop_pre_handler_t >
+{
+	static constexpr bool has_actual_pre_handler = false;
+
+	void
+	check_valid_pre_handler_pointer() const
+	{
+		// Nothing to do.
+	}
+};
+
 //
 // basic_server_settings_t
 //
@@ -439,6 +559,9 @@ class basic_server_settings_t
 	,	protected connection_state_listener_holder_t<
 			typename Traits::connection_state_listener_t >
 	,	protected ip_blocker_holder_t< typename Traits::ip_blocker_t >
+	,	protected body_sink_factory_holder_t<
+			typename Traits::body_sink_factory_t >
+	,	protected pre_handler_holder_t< typename Traits::pre_handler_t >
 {
 		using base_type_t = socket_type_dependent_settings_t<
 				Derived, typename Traits::stream_socket_t>;
@@ -451,6 +574,14 @@ class basic_server_settings_t
 						typename Traits::ip_blocker_t
 					>::has_actual_ip_blocker;
 
+		using body_sink_factory_holder_t<
+						typename Traits::body_sink_factory_t
+					>::has_actual_body_sink_factory;
+
+		using pre_handler_holder_t<
+						typename Traits::pre_handler_t
+					>::has_actual_pre_handler;
+
 	public:
 		basic_server_settings_t(
 			std::uint16_t port = 8080,
@@ -617,6 +748,36 @@ class basic_server_settings_t
 		}
 		//! \}
 
+		//! A period of time for which a body sink can pause reading
+		//! of a request body.
+		/*!
+			If a body sink doesn't resume the reading in that time
+			the connection is closed (and the sink is informed by
+			incoming_body::sink_t::on_interrupted()).
+
+			@since v.0.6.9
+		*/
+		//! \{
+		Derived &
+		paused_body_reading_timelimit( std::chrono::steady_clock::duration d ) &
+		{
+			m_paused_body_reading_timelimit = std::move( d );
+			return reference_to_derived();
+		}
+
+		Derived &&
+		paused_body_reading_timelimit( std::chrono::steady_clock::duration d ) &&
+		{
+			return std::move( this->paused_body_reading_timelimit( std::move( d ) ) );
+		}
+
+		std::chrono::steady_clock::duration
+		paused_body_reading_timelimit() const
+		{
+			return m_paused_body_reading_timelimit;
+		}
+		//! \}
+
 		//! Max pipelined requests able to receive on single connection.
 		//! \{
 		Derived &
@@ -639,6 +800,62 @@ class basic_server_settings_t
 		}
 		//! \}
 
+		//! Limits for incoming HTTP messages.
+		/*!
+		 * @since v.0.6.9
+		 */
+		//! \{
+		Derived &
+		incoming_http_msg_limits( const incoming_http_msg_limits_t & limits ) & noexcept
+		{
+			m_incoming_http_msg_limits = limits;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		incoming_http_msg_limits( const incoming_http_msg_limits_t & limits ) && noexcept
+		{
+			return std::move( this->incoming_http_msg_limits( limits ) );
+		}
+
+		const incoming_http_msg_limits_t &
+		incoming_http_msg_limits() const noexcept
+		{
+			return m_incoming_http_msg_limits;
+		}
+		//! \}
+
+		//! Counters of violations of limits for incoming HTTP messages.
+		/*!
+		 * It is an optional parameter. If it isn't set then
+		 * violations of limits aren't counted.
+		 *
+		 * @since v.0.6.9
+		 */
+		//! \{
+		Derived &
+		incoming_http_msg_limits_stats(
+			std::shared_ptr< incoming_http_msg_limits_stats_t > stats ) & noexcept
+		{
+			m_incoming_http_msg_limits_stats = std::move( stats );
+			return reference_to_derived();
+		}
+
+		Derived &&
+		incoming_http_msg_limits_stats(
+			std::shared_ptr< incoming_http_msg_limits_stats_t > stats ) && noexcept
+		{
+			return std::move(
+					this->incoming_http_msg_limits_stats( std::move( stats ) ) );
+		}
+
+		const std::shared_ptr< incoming_http_msg_limits_stats_t > &
+		incoming_http_msg_limits_stats() const noexcept
+		{
+			return m_incoming_http_msg_limits_stats;
+		}
+		//! \}
+
 
 		//! Request handler.
 		//! \{
@@ -855,6 +1072,151 @@ class basic_server_settings_t
 		}
 		//! \}
 
+		//! Max number of parallel connections.
+		/*!
+			When the number of alive connections reaches the limit
+			the server stops accepting new connections. Accepting is resumed
+			when some of connections are closed. Websocket connections are
+			counted too.
+
+			Zero value means that there is no limit (it is the default).
+
+			@note
+			The limit is applied to one server. Servers created by
+			sharded_servers_runner_t (or on_thread_pool_sharded()) have
+			separate limits, so the total count of connections can be up to
+			`max_connections * shards`. A common limit isn't used there
+			because every shard has its own queue of incoming connections:
+			a connection queued to a paused shard would wait while idle
+			accepts of other shards hold the free places.
+
+			@since v.0.6.9
+		*/
+		//! \{
+		Derived &
+		max_connections( std::size_t n ) & noexcept
+		{
+			m_max_connections = n;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		max_connections( std::size_t n ) && noexcept
+		{
+			return std::move( this->max_connections( n ) );
+		}
+
+		std::size_t
+		max_connections() const noexcept
+		{
+			return m_max_connections;
+		}
+		//! \}
+
+		//! Max count of free connection objects kept for reuse.
+		/*!
+			When a connection is closed its memory block and buffers
+			(input buffer, storages for outgoing data) are kept in the pool
+			and are reused for next connections. It eliminates
+			allocations on accepting of new connections.
+
+			Free items are kept separately for every thread the server
+			works on, so the limit is applied to every thread.
+
+			Zero value means that pooling is turned off (it is the default).
+
+			@since v.0.6.9
+		*/
+		//! \{
+		Derived &
+		connection_pool_capacity( std::size_t n ) & noexcept
+		{
+			m_connection_pool_capacity = n;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		connection_pool_capacity( std::size_t n ) && noexcept
+		{
+			return std::move( this->connection_pool_capacity( n ) );
+		}
+
+		std::size_t
+		connection_pool_capacity() const noexcept
+		{
+			return m_connection_pool_capacity;
+		}
+		//! \}
+
+		//! Should connections release input buffers while waiting
+		//! for a new request?
+		/*!
+			By default every connection holds an input buffer of
+			buffer_size() bytes for the whole lifetime. When this option is
+			turned on a connection that waits for a new request
+			waits for readability of the socket without a buffer.
+			A buffer is borrowed from a per-thread cache only when
+			data arrives. The size of the buffer is adjusted to the
+			observed sizes of incoming data (buffer_size() is the max size).
+
+			It saves a lot of memory if there are many idle keep-alive
+			connections.
+
+			\note It works only for plain TCP connections.
+			TLS-connections always hold their input buffers.
+
+			@since v.0.6.9
+		*/
+		//! \{
+		Derived &
+		release_idle_input_buffers( bool v ) & noexcept
+		{
+			m_release_idle_input_buffers = v;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		release_idle_input_buffers( bool v ) && noexcept
+		{
+			return std::move( this->release_idle_input_buffers( v ) );
+		}
+
+		bool
+		release_idle_input_buffers() const noexcept
+		{
+			return m_release_idle_input_buffers;
+		}
+		//! \}
+
+		//! Should `Date` field be added to every response?
+		/*!
+			If this option is turned on then the current date is added
+			to the header of every response that has no `Date` field.
+			The value of the field is formatted only once a second.
+
+			@since v.0.6.9
+		*/
+		//! \{
+		Derived &
+		always_add_date_field( bool v ) & noexcept
+		{
+			m_always_add_date_field = v;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		always_add_date_field( bool v ) && noexcept
+		{
+			return std::move( this->always_add_date_field( v ) );
+		}
+
+		bool
+		always_add_date_field() const noexcept
+		{
+			return m_always_add_date_field;
+		}
+		//! \}
+
 		//! Cleanup function.
 		//! \{
 		template< typename Func >
@@ -1111,6 +1473,212 @@ class basic_server_settings_t
 			this->check_valid_ip_blocker_pointer();
 		}
 
+		/*!
+		 * @brief Setter for body sink factory.
+		 *
+		 * @note body_sink_factory() method should be called if
+		 * user specify its type for body_sink_factory_t traits.
+		 * For example:
+		 * @code
+		 * class my_sink_factory_t {
+		 * 	...
+		 * public:
+		 * 	...
+		 * 	restinio::incoming_body::sink_handle_t
+		 * 	make_sink(
+		 * 		const restinio::http_request_header_t & header,
+		 * 		restinio::incoming_body::resumer_t resumer ) {
+		 * 		...
+		 * 	}
+		 * };
+		 *
+		 * struct my_traits_t : public restinio::default_traits_t {
+		 * 	using body_sink_factory_t = my_sink_factory_t;
+		 * };
+		 *
+		 * restinio::server_setting_t<my_traits_t> settings;
+		 * setting.body_sink_factory( std::make_shared<my_sink_factory_t>(...) );
+		 * ...
+		 * @endcode
+		 *
+		 * @attention This method can't be called if the default no-op
+		 * body sink factory is used in server traits.
+		 *
+		 * @since v.0.6.9
+		 */
+		Derived &
+		body_sink_factory(
+			std::shared_ptr< typename Traits::body_sink_factory_t > factory ) &
+		{
+			static_assert(
+					basic_server_settings_t::has_actual_body_sink_factory,
+					"body_sink_factory(factory) can't be used "
+					"for the default incoming_body::noop_sink_factory_t" );
+
+			this->m_body_sink_factory = std::move(factory);
+			return reference_to_derived();
+		}
+
+		/*!
+		 * @brief Setter for body sink factory.
+		 *
+		 * @note body_sink_factory() method should be called if
+		 * user specify its type for body_sink_factory_t traits.
+		 * For example:
+		 * @code
+		 * restinio::run( restinio::on_this_thread<my_traits_t>()
+		 * 		.body_sink_factory( std::make_shared<my_sink_factory_t>(...) )
+		 * 		.port(...)
+		 * 		...);
+		 * @endcode
+		 *
+		 * @attention This method can't be called if the default no-op
+		 * body sink factory is used in server traits.
+		 *
+		 * @since v.0.6.9
+		 */
+		Derived &&
+		body_sink_factory(
+			std::shared_ptr< typename Traits::body_sink_factory_t > factory ) &&
+		{
+			return std::move(this->body_sink_factory(std::move(factory)));
+		}
+
+		/*!
+		 * @brief Get reference to body sink factory.
+		 *
+		 * @attention This method can't be called if the default no-op
+		 * body sink factory is used in server traits.
+		 *
+		 * @since v.0.6.9
+		 */
+		const std::shared_ptr< typename Traits::body_sink_factory_t > &
+		body_sink_factory() const noexcept
+		{
+			static_assert(
+					basic_server_settings_t::has_actual_body_sink_factory,
+					"body_sink_factory() can't be used "
+					"for the default incoming_body::noop_sink_factory_t" );
+
+			return this->m_body_sink_factory;
+		}
+
+		/*!
+		 * @brief Internal method for checking presence of body sink factory.
+		 *
+		 * If a user specifies custom body sink factory type but doesn't
+		 * set a pointer to factory object that method throws an exception.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		ensure_valid_body_sink_factory()
+		{
+			this->check_valid_body_sink_factory_pointer();
+		}
+
+		/*!
+		 * @brief Setter for pre-handler.
+		 *
+		 * @note pre_handler() method should be called if
+		 * user specify its type for pre_handler_t traits.
+		 * For example:
+		 * @code
+		 * class my_pre_handler_t {
+		 * 	...
+		 * public:
+		 * 	...
+		 * 	restinio::pre_handler::verdict_t
+		 * 	on_headers_complete(const restinio::pre_handler::incoming_info_t & info) {
+		 * 		...
+		 * 	}
+		 * };
+		 *
+		 * struct my_traits_t : public restinio::default_traits_t {
+		 * 	using pre_handler_t = my_pre_handler_t;
+		 * };
+		 *
+		 * restinio::server_setting_t<my_traits_t> settings;
+		 * setting.pre_handler( std::make_shared<my_pre_handler_t>(...) );
+		 * ...
+		 * @endcode
+		 *
+		 * @attention This method can't be called if the default no-op
+		 * pre-handler is used in server traits.
+		 *
+		 * @since v.0.6.9
+		 */
+		Derived &
+		pre_handler(
+			std::shared_ptr< typename Traits::pre_handler_t > handler ) &
+		{
+			static_assert(
+					basic_server_settings_t::has_actual_pre_handler,
+					"pre_handler(handler) can't be used "
+					"for the default pre_handler::noop_pre_handler_t" );
+
+			this->m_pre_handler = std::move(handler);
+			return reference_to_derived();
+		}
+
+		/*!
+		 * @brief Setter for pre-handler.
+		 *
+		 * @note pre_handler() method should be called if
+		 * user specify its type for pre_handler_t traits.
+		 * For example:
+		 * @code
+		 * restinio::run( restinio::on_this_thread<my_traits_t>()
+		 * 		.pre_handler( std::make_shared<my_pre_handler_t>(...) )
+		 * 		.port(...)
+		 * 		...);
+		 * @endcode
+		 *
+		 * @attention This method can't be called if the default no-op
+		 * pre-handler is used in server traits.
+		 *
+		 * @since v.0.6.9
+		 */
+		Derived &&
+		pre_handler(
+			std::shared_ptr< typename Traits::pre_handler_t > handler ) &&
+		{
+			return std::move(this->pre_handler(std::move(handler)));
+		}
+
+		/*!
+		 * @brief Get reference to pre-handler.
+		 *
+		 * @attention This method can't be called if the default no-op
+		 * pre-handler is used in server traits.
+		 *
+		 * @since v.0.6.9
+		 */
+		const std::shared_ptr< typename Traits::pre_handler_t > &
+		pre_handler() const noexcept
+		{
+			static_assert(
+					basic_server_settings_t::has_actual_pre_handler,
+					"pre_handler() can't be used "
+					"for the default pre_handler::noop_pre_handler_t" );
+
+			return this->m_pre_handler;
+		}
+
+		/*!
+		 * @brief Internal method for checking presence of pre-handler.
+		 *
+		 * If a user specifies custom pre-handler type but doesn't
+		 * set a pointer to pre-handler object that method throws an exception.
+		 *
+		 * @since v.0.6.9
+		 */
+		void
+		ensure_valid_pre_handler()
+		{
+			this->check_valid_pre_handler_pointer();
+		}
+
 	private:
 		Derived &
 		reference_to_derived()
@@ -1160,11 +1728,28 @@ class basic_server_settings_t
 
 		std::chrono::steady_clock::duration
 			m_handle_request_timeout{ std::chrono::seconds( 10 ) };
+
+		//! @since v.0.6.9
+		std::chrono::steady_clock::duration
+			m_paused_body_reading_timelimit{ std::chrono::seconds( 60 ) };
 		//! \}
 
 		//! Max pipelined requests to receive on single connection.
 		std::size_t m_max_pipelined_requests{ 1 };
 
+		//! Limits for incoming HTTP messages.
+		/*!
+		 * @since v.0.6.9
+		 */
+		incoming_http_msg_limits_t m_incoming_http_msg_limits;
+
+		//! Optional counters of violations of limits.
+		/*!
+		 * @since v.0.6.9
+		 */
+		std::shared_ptr< incoming_http_msg_limits_stats_t >
+				m_incoming_http_msg_limits_stats;
+
 		//! Request handler.
 		std::unique_ptr< request_handler_t > m_request_handler;
 
@@ -1185,6 +1770,23 @@ class basic_server_settings_t
 		//! Do separate an accept operation and connection instantiation.
 		bool m_separate_accept_and_create_connect{ false };
 
+		//! Max number of parallel connections.
+		//! @since v.0.6.9
+		std::size_t m_max_connections{ 0u };
+
+		//! Max count of free connection objects kept for reuse.
+		//! @since v.0.6.9
+		std::size_t m_connection_pool_capacity{ 0u };
+
+		//! Should connections release input buffers while waiting
+		//! for a new request?
+		//! @since v.0.6.9
+		bool m_release_idle_input_buffers{ false };
+
+		//! Should `Date` field be added to every response?
+		//! @since v.0.6.9
+		bool m_always_add_date_field{ false };
+
 		//! Optional cleanup functor.
 		cleanup_functor_t m_cleanup_functor;
 };
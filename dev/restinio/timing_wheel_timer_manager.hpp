@@ -0,0 +1,542 @@
+/*
+	restinio
+*/
+
+/*!
+	Timer factory implementation based on a timing wheel.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <memory>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <limits>
+
+#include <restinio/asio_include.hpp>
+
+#include <restinio/utils/suppress_exceptions.hpp>
+
+#include <restinio/timer_common.hpp>
+#include <restinio/ostream_logger.hpp>
+#include <restinio/exception.hpp>
+#include <restinio/compiler_features.hpp>
+
+namespace restinio
+{
+
+namespace timing_wheel_impl
+{
+
+//
+// wheel_t
+//
+
+/*!
+ * @brief The actual timing wheel shared between a timer manager
+ * and all timer guards created by it.
+ *
+ * The wheel is a ring of buckets. Every bucket is an intrusive
+ * doubly-linked list of nodes. Nodes live in a single vector and
+ * are linked by indexes, so a connection's guard allocates its node
+ * only once and then schedule/cancel operations are O(1) and
+ * do not allocate memory.
+ *
+ * The wheel is driven by a single asio::steady_timer that ticks
+ * with the period of `check_period / ticks_per_check_period`.
+ * On every tick the next bucket is taken and all connections
+ * from it get check_timeout() call.
+ *
+ * Because all timeout checks are scheduled with the same delay
+ * (check_period) there is no need in several levels of wheels:
+ * a single level with `ticks_per_check_period + 2` buckets is enough.
+ * A node is placed into a bucket that will be processed not earlier
+ * than check_period after the scheduling.
+ *
+ * @tparam Lock type of lock object for protection of the wheel.
+ * It should be std::mutex if several threads serve the io_context
+ * and can be restinio::null_lock_t for the single-threaded case.
+ *
+ * @since v.0.6.9
+ */
+template< typename Lock >
+class wheel_t final
+	:	public std::enable_shared_from_this< wheel_t< Lock > >
+{
+	public:
+		//! Type of index of a node.
+		using node_index_t = std::size_t;
+
+		//! A special value for a missing node (or bucket).
+		static constexpr node_index_t npos =
+				std::numeric_limits< node_index_t >::max();
+
+		wheel_t(
+			asio_ns::io_context & io_context,
+			std::chrono::steady_clock::duration check_period,
+			std::size_t ticks_per_check_period )
+			:	m_timer{ io_context }
+			,	m_ticks_per_check_period{ ticks_per_check_period }
+			,	m_tick_period{ make_tick_period(
+					check_period, ticks_per_check_period ) }
+			,	m_buckets( ticks_per_check_period + 2u, npos )
+		{}
+
+		wheel_t( const wheel_t & ) = delete;
+		wheel_t & operator=( const wheel_t & ) = delete;
+
+		//! Allocate a node for a new timer guard.
+		node_index_t
+		allocate_node()
+		{
+			std::lock_guard< Lock > lock{ m_lock };
+
+			if( !m_free_nodes.empty() )
+			{
+				const auto index = m_free_nodes.back();
+				m_free_nodes.pop_back();
+				return index;
+			}
+
+			m_nodes.emplace_back();
+			return m_nodes.size() - 1u;
+		}
+
+		//! Return a node of a destroyed timer guard to the wheel.
+		void
+		release_node( node_index_t index ) noexcept
+		{
+			restinio::utils::suppress_exceptions_quietly( [&] {
+					std::lock_guard< Lock > lock{ m_lock };
+
+					unlink( index );
+					m_nodes[ index ].m_handle.reset();
+					m_free_nodes.push_back( index );
+				} );
+		}
+
+		//! Schedule timeout check for a connection.
+		void
+		schedule(
+			node_index_t index,
+			tcp_connection_ctx_weak_handle_t weak_handle )
+		{
+			std::lock_guard< Lock > lock{ m_lock };
+
+			unlink( index );
+
+			auto & node = m_nodes[ index ];
+			node.m_handle = std::move( weak_handle );
+			link(
+				index,
+				( m_cursor + m_ticks_per_check_period + 1u ) % m_buckets.size() );
+		}
+
+		//! Cancel timeout check for a connection.
+		void
+		cancel( node_index_t index ) noexcept
+		{
+			restinio::utils::suppress_exceptions_quietly( [&] {
+					std::lock_guard< Lock > lock{ m_lock };
+
+					unlink( index );
+				} );
+		}
+
+		//! Start ticking.
+		void
+		start()
+		{
+			std::lock_guard< Lock > lock{ m_lock };
+
+			if( !m_running )
+			{
+				m_running = true;
+				// If a tick is being handled the timer will be
+				// re-armed at the end of that tick.
+				if( !m_tick_in_progress )
+				{
+					m_timer.expires_after( m_tick_period );
+					schedule_tick();
+				}
+			}
+		}
+
+		//! Stop ticking.
+		void
+		stop() noexcept
+		{
+			restinio::utils::suppress_exceptions_quietly( [&] {
+					std::lock_guard< Lock > lock{ m_lock };
+
+					if( m_running )
+					{
+						m_running = false;
+						m_timer.cancel();
+					}
+				} );
+		}
+
+	private:
+		//! A node of a bucket's list.
+		struct node_t
+		{
+			//! Connection to be checked.
+			tcp_connection_ctx_weak_handle_t m_handle;
+			//! Index of the previous node in the bucket.
+			node_index_t m_prev{ npos };
+			//! Index of the next node in the bucket.
+			node_index_t m_next{ npos };
+			//! Index of the bucket (npos if the node isn't scheduled).
+			std::size_t m_bucket{ npos };
+		};
+
+		static std::chrono::steady_clock::duration
+		make_tick_period(
+			std::chrono::steady_clock::duration check_period,
+			std::size_t ticks_per_check_period )
+		{
+			if( 0u == ticks_per_check_period )
+				throw exception_t{ "ticks_per_check_period can't be zero" };
+
+			const auto tick = check_period /
+					static_cast< std::chrono::steady_clock::duration::rep >(
+							ticks_per_check_period );
+			if( tick <= std::chrono::steady_clock::duration::zero() )
+				throw exception_t{ "check_period is too small for the wheel" };
+
+			return tick;
+		}
+
+		//! Add a node to the head of the bucket.
+		/*!
+		 * @attention
+		 * Must be called under the lock.
+		 */
+		void
+		link( node_index_t index, std::size_t bucket ) noexcept
+		{
+			auto & node = m_nodes[ index ];
+			node.m_bucket = bucket;
+			node.m_prev = npos;
+			node.m_next = m_buckets[ bucket ];
+			if( npos != node.m_next )
+				m_nodes[ node.m_next ].m_prev = index;
+			m_buckets[ bucket ] = index;
+		}
+
+		//! Remove a node from its bucket (if it is scheduled).
+		/*!
+		 * @attention
+		 * Must be called under the lock.
+		 */
+		void
+		unlink( node_index_t index ) noexcept
+		{
+			auto & node = m_nodes[ index ];
+			if( npos == node.m_bucket )
+				return;
+
+			if( npos != node.m_prev )
+				m_nodes[ node.m_prev ].m_next = node.m_next;
+			else
+				m_buckets[ node.m_bucket ] = node.m_next;
+
+			if( npos != node.m_next )
+				m_nodes[ node.m_next ].m_prev = node.m_prev;
+
+			node.m_prev = node.m_next = npos;
+			node.m_bucket = npos;
+		}
+
+		//! Initiate waiting for the next tick.
+		/*!
+		 * @attention
+		 * Must be called under the lock.
+		 */
+		void
+		schedule_tick()
+		{
+			std::weak_ptr< wheel_t > weak_wheel{ this->shared_from_this() };
+			m_timer.async_wait(
+				[ weak_wheel = std::move( weak_wheel ) ]( const auto & ec ){
+					if( !ec )
+					{
+						if( auto wheel = weak_wheel.lock() )
+							wheel->on_tick();
+					}
+				} );
+		}
+
+		//! Handle the next tick of the wheel.
+		void
+		on_tick()
+		{
+			// Connections to be checked are collected under the lock
+			// but check_timeout() is called without it because
+			// a connection can schedule the next check right in
+			// check_timeout().
+			{
+				std::lock_guard< Lock > lock{ m_lock };
+
+				if( !m_running )
+					return;
+
+				m_tick_in_progress = true;
+
+				m_cursor = ( m_cursor + 1u ) % m_buckets.size();
+
+				auto index = m_buckets[ m_cursor ];
+				m_buckets[ m_cursor ] = npos;
+				while( npos != index )
+				{
+					auto & node = m_nodes[ index ];
+					m_expired.push_back( std::move( node.m_handle ) );
+					index = node.m_next;
+					node.m_prev = node.m_next = npos;
+					node.m_bucket = npos;
+				}
+			}
+
+			try
+			{
+				for( auto & weak_handle : m_expired )
+				{
+					if( auto h = weak_handle.lock() )
+					{
+						h->check_timeout( h );
+					}
+				}
+			}
+			catch( ... )
+			{
+				finish_tick();
+				throw;
+			}
+
+			finish_tick();
+		}
+
+		//! Schedule the next tick after the current one is handled.
+		/*!
+		 * The next tick is scheduled only after m_expired is processed,
+		 * otherwise the next tick could be handled by another thread
+		 * at the same time.
+		 */
+		void
+		finish_tick()
+		{
+			m_expired.clear();
+
+			std::lock_guard< Lock > lock{ m_lock };
+			m_tick_in_progress = false;
+			if( m_running )
+			{
+				// Use the previous expiry time to avoid a drift of ticks.
+				m_timer.expires_at( m_timer.expiry() + m_tick_period );
+				schedule_tick();
+			}
+		}
+
+		//! Lock object for the protection of the wheel.
+		Lock m_lock;
+
+		//! The only timer for the whole wheel.
+		asio_ns::steady_timer m_timer;
+
+		//! Count of ticks in one check period.
+		const std::size_t m_ticks_per_check_period;
+		//! Duration of one tick.
+		const std::chrono::steady_clock::duration m_tick_period;
+
+		//! Is the wheel started?
+		bool m_running{ false };
+
+		//! Is a tick being handled now?
+		bool m_tick_in_progress{ false };
+
+		//! Index of the bucket processed on the last tick.
+		std::size_t m_cursor{ 0u };
+
+		//! Heads of buckets.
+		std::vector< node_index_t > m_buckets;
+
+		//! All nodes.
+		std::vector< node_t > m_nodes;
+		//! Indexes of nodes that aren't used by any guard.
+		std::vector< node_index_t > m_free_nodes;
+
+		//! Connections taken from the current bucket.
+		/*!
+		 * It is a member to avoid allocations on every tick.
+		 * Ticks are handled sequentially because the timer is re-armed
+		 * only after connections from the current tick are checked.
+		 */
+		std::vector< tcp_connection_ctx_weak_handle_t > m_expired;
+};
+
+template< typename Lock >
+constexpr typename wheel_t< Lock >::node_index_t wheel_t< Lock >::npos;
+
+} /* namespace timing_wheel_impl */
+
+//
+// basic_timing_wheel_timer_manager_t
+//
+
+/*!
+ * @brief Timer factory implementation that uses one asio timer
+ * for all connections.
+ *
+ * Unlike asio_timer_manager_t that creates an asio::steady_timer
+ * for every connection and reschedules it on every operation,
+ * this manager uses a single timer that drives a timing wheel.
+ * Scheduling and cancellation of timeout checks are O(1) operations
+ * that just relink a node in the wheel, so there is no churn in
+ * asio's timer queue even with hundreds of thousands of connections.
+ *
+ * The price is a precision of timeout checks: a check is performed
+ * in [check_period, check_period + check_period/ticks_per_check_period]
+ * after the scheduling.
+ *
+ * Usage example:
+ * @code
+ * using traits_t = restinio::traits_t<
+ * 		restinio::timing_wheel_timer_manager_t,
+ * 		restinio::null_logger_t >;
+ *
+ * restinio::run(
+ * 	restinio::on_thread_pool< traits_t >( 4 )
+ * 		.timer_manager( std::chrono::milliseconds{ 500 } )
+ * 		...
+ * );
+ * @endcode
+ *
+ * @tparam Lock type of lock for the protection of the wheel.
+ *
+ * @since v.0.6.9
+ */
+template< typename Lock >
+class basic_timing_wheel_timer_manager_t final
+{
+		using wheel_t = timing_wheel_impl::wheel_t< Lock >;
+		using wheel_handle_t = std::shared_ptr< wheel_t >;
+
+	public:
+		basic_timing_wheel_timer_manager_t(
+			asio_ns::io_context & io_context,
+			std::chrono::steady_clock::duration check_period,
+			std::size_t ticks_per_check_period )
+			:	m_wheel{ std::make_shared< wheel_t >(
+					io_context, check_period, ticks_per_check_period ) }
+		{}
+
+		~basic_timing_wheel_timer_manager_t()
+		{
+			m_wheel->stop();
+		}
+
+		//! Timer guard for async operations.
+		class timer_guard_t final
+		{
+			public:
+				timer_guard_t( wheel_handle_t wheel )
+					:	m_wheel{ std::move( wheel ) }
+					,	m_node{ m_wheel->allocate_node() }
+				{}
+
+				timer_guard_t( timer_guard_t && other ) noexcept
+					:	m_wheel{ std::move( other.m_wheel ) }
+					,	m_node{ other.m_node }
+				{}
+
+				timer_guard_t( const timer_guard_t & ) = delete;
+				timer_guard_t & operator=( const timer_guard_t & ) = delete;
+				timer_guard_t & operator=( timer_guard_t && ) = delete;
+
+				~timer_guard_t()
+				{
+					if( m_wheel )
+						m_wheel->release_node( m_node );
+				}
+
+				//! Schedule timeouts check invocation.
+				void
+				schedule( tcp_connection_ctx_weak_handle_t weak_handle )
+				{
+					m_wheel->schedule( m_node, std::move( weak_handle ) );
+				}
+
+				//! Cancel timeout guard if any.
+				void
+				cancel() noexcept
+				{
+					m_wheel->cancel( m_node );
+				}
+
+			private:
+				wheel_handle_t m_wheel;
+				typename wheel_t::node_index_t m_node;
+		};
+
+		//! Create guard for connection.
+		timer_guard_t
+		create_timer_guard() const
+		{
+			return timer_guard_t{ m_wheel };
+		}
+
+		//! @name Start/stop timer manager.
+		///@{
+		void start() { m_wheel->start(); }
+		void stop() noexcept { m_wheel->stop(); }
+		///@}
+
+		struct factory_t final
+		{
+			//! Check period for timer events.
+			const std::chrono::steady_clock::duration
+				m_check_period{ std::chrono::seconds{ 1 } };
+
+			//! Count of wheel's ticks in one check period.
+			const std::size_t m_ticks_per_check_period{ 4u };
+
+			factory_t() noexcept {}
+			factory_t( std::chrono::steady_clock::duration check_period ) noexcept
+				:	m_check_period{ check_period }
+			{}
+			factory_t(
+				std::chrono::steady_clock::duration check_period,
+				std::size_t ticks_per_check_period ) noexcept
+				:	m_check_period{ check_period }
+				,	m_ticks_per_check_period{ ticks_per_check_period }
+			{}
+
+			//! Create an instance of timer manager.
+			auto
+			create( asio_ns::io_context & io_context ) const
+			{
+				return std::make_shared< basic_timing_wheel_timer_manager_t >(
+						io_context,
+						m_check_period,
+						m_ticks_per_check_period );
+			}
+		};
+
+	private:
+		//! The wheel shared with all timer guards.
+		const wheel_handle_t m_wheel;
+};
+
+//! Timing wheel timer manager for io_context served by several threads.
+using timing_wheel_timer_manager_t =
+		basic_timing_wheel_timer_manager_t< std::mutex >;
+
+//! Timing wheel timer manager for io_context served by one thread.
+using single_threaded_timing_wheel_timer_manager_t =
+		basic_timing_wheel_timer_manager_t< null_lock_t >;
+
+} /* namespace restinio */
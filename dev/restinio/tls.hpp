@@ -10,6 +10,7 @@
 
 #include <restinio/traits.hpp>
 #include <restinio/impl/tls_socket.hpp>
+#include <restinio/impl/sendfile_operation.hpp>
 
 namespace restinio
 {
@@ -167,11 +168,16 @@ prepare_connection_and_start_read(
 {
 	socket.async_handshake(
 		asio_ns::ssl::stream_base::server,
-		[ start_read_cb = std::move( start_read_cb ),
+		[ &socket,
+			start_read_cb = std::move( start_read_cb ),
 			failed_cb = std::move( failed_cb ),
 			con = con.shared_from_this() ]( const asio_ns::error_code & ec ){
 			if( !ec )
+			{
+				// If kTLS can't be used the connection works as usual.
+				socket.try_enable_ktls_tx();
 				start_read_cb();
+			}
 			else
 				failed_cb( ec );
 		} );
@@ -184,6 +190,8 @@ prepare_connection_and_start_read(
 //! Customizes extra settings needed for working with socket.
 /*!
 	Adds tls context setting.
+
+	Since v.0.6.9 there is also an opt-in setting for kTLS.
 */
 template < typename Settings >
 class socket_type_dependent_settings_t< Settings, tls_socket_t >
@@ -217,6 +225,78 @@ public:
 			return asio_ns::ssl::context{ std::move( m_tls_context ) };
 		}
 
+		/** @name Use of kernel TLS (kTLS).
+		 * @brief Pass encryption of outgoing data to the kernel.
+		 *
+		 * If kTLS is enabled and the kernel supports it for the negotiated
+		 * cipher (AES-GCM with TLS 1.2 or TLS 1.3 on Linux) then data is
+		 * encrypted by the kernel. It makes possible to use native
+		 * sendfile() for sendfile operations over TLS-connections.
+		 * If kTLS can't be used for a connection that connection works
+		 * in the usual way.
+		 *
+		 * @note
+		 * kTLS requires `tls` kernel module (`modprobe tls`).
+		 *
+		 * @attention
+		 * If kTLS is enabled the TLS context passed to tls_context() is
+		 * modified by the server, and the changes affect all connections
+		 * made with that context (including connections for which kTLS
+		 * can't be used). So the context should be dedicated to the
+		 * server and shouldn't be shared (for example via
+		 * `SSL_CTX_up_ref()`) with other users. The changes are:
+		 * - a keylog callback is installed to get TLS 1.3 traffic
+		 *   secrets. A keylog callback set by a user before the start of
+		 *   the server is still called from the installed one. A callback
+		 *   set after the start replaces the installed one and kTLS
+		 *   won't be used for TLS 1.3 connections;
+		 * - renegotiation is disabled (`SSL_OP_NO_RENEGOTIATION`);
+		 * - TLS 1.3 session tickets are not issued
+		 *   (`SSL_CTX_set_num_tickets(ctx, 0)`), so TLS 1.3 session
+		 *   resumption doesn't work for the server.
+		 *
+		 * After the offload OpenSSL can't write anything to
+		 * a connection. It means that:
+		 * - no alerts (including close_notify) are sent by the server
+		 *   for that connection. Note that RESTinio doesn't send
+		 *   close_notify for usual TLS-connections too: they are closed
+		 *   by the shutdown of TCP-connection;
+		 * - a TLS 1.3 KeyUpdate from a client that requests an update
+		 *   from the server closes the connection (a KeyUpdate without
+		 *   such request is handled in the usual way).
+		 *
+		 * Usage example:
+		 * @code
+		 * restinio::run(
+		 * 	restinio::on_this_thread< restinio::default_tls_traits_t >()
+		 * 		.tls_context( std::move( tls_context ) )
+		 * 		.use_ktls( true )
+		 * 		...
+		 * @endcode
+		 *
+		 * @since v.0.6.9
+		 */
+		///@{
+		Settings &
+		use_ktls( bool value ) & noexcept
+		{
+			m_use_ktls = value;
+			return upcast_reference();
+		}
+
+		Settings &&
+		use_ktls( bool value ) && noexcept
+		{
+			return std::move( this->use_ktls( value ) );
+		}
+
+		bool
+		use_ktls() const noexcept
+		{
+			return m_use_ktls;
+		}
+		///@}
+
 	private:
 		Settings &
 		upcast_reference()
@@ -225,6 +305,10 @@ public:
 		}
 
 		asio_ns::ssl::context m_tls_context{ asio_ns::ssl::context::sslv23 };
+
+		//! Should kTLS be used for outgoing data?
+		//! @since v.0.6.9
+		bool m_use_ktls{ false };
 };
 
 namespace impl
@@ -238,6 +322,35 @@ make_tls_socket_pointer_for_state_listener(
 	return &socket;
 }
 
+//! An overload for TLS-connection.
+/*!
+	If outgoing data is encrypted by the kernel then sendfile operation
+	is performed directly with the underlying TCP-socket.
+
+	@since v.0.6.9
+*/
+inline sendfile_operation_shared_ptr_t
+make_sendfile_operation_runner(
+	const sendfile_t & sf,
+	asio_ns::executor executor,
+	tls_socket_t & socket,
+	after_sendfile_cb_t after_sendfile_cb )
+{
+	if( socket.is_ktls_tx_enabled() )
+		return std::make_shared<
+				sendfile_operation_runner_t< asio_ns::ip::tcp::socket > >(
+			sf,
+			std::move( executor ),
+			socket.asio_ssl_stream().next_layer(),
+			std::move( after_sendfile_cb ) );
+
+	return std::make_shared< sendfile_operation_runner_t< tls_socket_t > >(
+			sf,
+			std::move( executor ),
+			socket,
+			std::move( after_sendfile_cb ) );
+}
+
 //
 // socket_supplier_t
 //
@@ -253,12 +366,16 @@ class socket_supplier_t< tls_socket_t >
 			asio_ns::io_context & io_context )
 			:	m_tls_context{ std::make_shared< asio_ns::ssl::context >( settings.tls_context() ) }
 			,	m_io_context{ io_context }
+			,	m_use_ktls{ settings.use_ktls() }
 		{
+			if( m_use_ktls )
+				ktls::prepare_context( *m_tls_context );
+
 			m_sockets.reserve( settings.concurrent_accepts_count() );
 
 			while( m_sockets.size() < settings.concurrent_accepts_count() )
 			{
-				m_sockets.emplace_back( m_io_context, m_tls_context );
+				m_sockets.emplace_back( m_io_context, m_tls_context, m_use_ktls );
 			}
 		}
 
@@ -277,7 +394,7 @@ class socket_supplier_t< tls_socket_t >
 			//! Index of a socket in the pool.
 			std::size_t idx )
 		{
-			tls_socket_t res{ m_io_context, m_tls_context };
+			tls_socket_t res{ m_io_context, m_tls_context, m_use_ktls };
 			std::swap( res, m_sockets.at( idx ) );
 			return res;
 		}
@@ -293,6 +410,8 @@ class socket_supplier_t< tls_socket_t >
 	private:
 		std::shared_ptr< asio_ns::ssl::context > m_tls_context;
 		asio_ns::io_context & m_io_context;
+		//! @since v.0.6.9
+		bool m_use_ktls;
 		std::vector< tls_socket_t > m_sockets;
 };
 
@@ -13,6 +13,8 @@
 #include <restinio/null_logger.hpp>
 #include <restinio/connection_state_listener.hpp>
 #include <restinio/ip_blocker.hpp>
+#include <restinio/incoming_body.hpp>
+#include <restinio/pre_handler.hpp>
 
 namespace restinio
 {
@@ -130,6 +132,103 @@ struct traits_t
 	 */
 	using ip_blocker_t = ip_blocker::noop_ip_blocker_t;
 
+	/*!
+	 * @brief A type for factory of incoming body sinks.
+	 *
+	 * By default RESTinio accumulates the whole body of a request in
+	 * memory before calling the request handler. But since v.0.6.9
+	 * a user can specify a factory that will be called for every
+	 * request as soon as its headers are parsed. The factory can
+	 * return a sink for the body and the body will be passed to
+	 * that sink chunk by chunk. If the factory returns nullptr then
+	 * the body is accumulated as usual.
+	 *
+	 * An example:
+	 * @code
+	 * // Definition of user's body sink factory.
+	 * class my_sink_factory {
+	 * 	...
+	 * public:
+	 * 	...
+	 * 	restinio::incoming_body::sink_handle_t
+	 * 	make_sink(
+	 * 		const restinio::http_request_header_t & header,
+	 * 		restinio::incoming_body::resumer_t resumer ) {
+	 * 		... // creation of a sink for a request.
+	 * 	}
+	 * };
+	 *
+	 * // Definition of custom traits for HTTP server.
+	 * struct my_server_traits : public restinio::default_traits_t {
+	 * 	using body_sink_factory_t = my_sink_factory;
+	 * };
+	 * @endcode
+	 *
+	 * @since v.0.6.9
+	 */
+	using body_sink_factory_t = incoming_body::noop_sink_factory_t;
+
+	/*!
+	 * @brief A type for pre-handler of incoming requests.
+	 *
+	 * By default RESTinio calls the request handler only when the
+	 * whole request (including the body) is read. But since v.0.6.9
+	 * a user can specify a pre-handler that will be called as soon as
+	 * the headers of a request are parsed. The pre-handler can
+	 * reject the request without reading its body (with 401, 413, 417
+	 * and so on) or choose how the body should be handled.
+	 *
+	 * An example:
+	 * @code
+	 * // Definition of user's pre-handler.
+	 * class my_pre_handler {
+	 * 	...
+	 * public:
+	 * 	...
+	 * 	restinio::pre_handler::verdict_t
+	 * 	on_headers_complete(const restinio::pre_handler::incoming_info_t & info) {
+	 * 		... // some checking for the request.
+	 * 	}
+	 * };
+	 *
+	 * // Definition of custom traits for HTTP server.
+	 * struct my_server_traits : public restinio::default_traits_t {
+	 * 	using pre_handler_t = my_pre_handler;
+	 * };
+	 * @endcode
+	 *
+	 * @since v.0.6.9
+	 */
+	using pre_handler_t = pre_handler::noop_pre_handler_t;
+
+	/*!
+	 * @brief A type of storage for header fields of incoming requests.
+	 *
+	 * By default every header field of an incoming request is stored
+	 * as a pair of std::string objects. It can require a couple of memory
+	 * allocations for every field. Since v.0.6.9 a user can specify
+	 * incoming_header_storage::arena_views_t as the storage. In that case
+	 * all fields of a request are copied into one buffer allocated once
+	 * per request and are accessible as string_views without additional
+	 * allocations (via value_of(), opt_value_of(), has_field() and
+	 * for_each_field_view() methods of http_header_fields_t).
+	 * Other methods (like try_get_field() or begin()/end()) convert all
+	 * fields into http_header_field_t objects on the first call. Those
+	 * methods are `noexcept`, so a lack of memory during the conversion
+	 * leads to std::terminate().
+	 *
+	 * An example:
+	 * @code
+	 * struct my_server_traits : public restinio::default_traits_t {
+	 * 	using incoming_header_storage_t =
+	 * 		restinio::incoming_header_storage::arena_views_t;
+	 * };
+	 * @endcode
+	 *
+	 * @since v.0.6.9
+	 */
+	using incoming_header_storage_t = incoming_header_storage::owning_strings_t;
+
 	using timer_manager_t = Timer_Manager;
 	using logger_t = Logger;
 	using request_handler_t = Request_Handler;
@@ -526,4 +526,271 @@ parse_query(
 	return std::move(*r);
 }
 
+namespace impl
+{
+
+//
+// append_unescaped_query_part
+//
+/*!
+ * @brief Append an unescaped part of a query string to @a to.
+ *
+ * @since v.0.6.9
+ */
+template< typename Parse_Traits >
+RESTINIO_NODISCARD
+expected_t<
+	utils::unescape_percent_encoding_success_t,
+	utils::unescape_percent_encoding_failure_t >
+append_unescaped_query_part( string_view_t part, std::string & to )
+{
+	return utils::impl::do_unescape_percent_encoding< Parse_Traits >(
+			part,
+			[&to]( char ch ) { to += ch; } );
+}
+
+//
+// is_plain_query_part
+//
+/*!
+ * @brief Does a part of a query string remain the same after unescaping?
+ *
+ * @since v.0.6.9
+ */
+template< typename Parse_Traits >
+RESTINIO_NODISCARD
+bool
+is_plain_query_part( string_view_t part ) noexcept
+{
+	for( const char ch : part )
+		if( '%' == ch || '+' == ch || !Parse_Traits::ordinary_char( ch ) )
+			return false;
+
+	return true;
+}
+
+//
+// handle_query_param
+//
+/*!
+ * @brief Pass a parameter to a handler.
+ *
+ * Parts that don't require unescaping are passed as is. Otherwise
+ * both parts are unescaped into @a scratch_buffer.
+ *
+ * @since v.0.6.9
+ */
+template< typename Parse_Traits, typename Handler >
+RESTINIO_NODISCARD
+optional_t< parse_query_failure_t >
+handle_query_param(
+	string_view_t name,
+	string_view_t value,
+	std::string & scratch_buffer,
+	Handler & handler )
+{
+	if( is_plain_query_part< Parse_Traits >( name ) &&
+		is_plain_query_part< Parse_Traits >( value ) )
+	{
+		handler( name, value );
+		return nullopt;
+	}
+
+	scratch_buffer.clear();
+	scratch_buffer.reserve( name.size() + value.size() );
+
+	auto name_result = append_unescaped_query_part< Parse_Traits >(
+			name, scratch_buffer );
+	if( !name_result )
+		return parse_query_failure_t{ std::move(name_result.error()) };
+
+	const auto name_size = scratch_buffer.size();
+
+	auto value_result = append_unescaped_query_part< Parse_Traits >(
+			value, scratch_buffer );
+	if( !value_result )
+		return parse_query_failure_t{ std::move(value_result.error()) };
+
+	handler(
+			string_view_t{ scratch_buffer.data(), name_size },
+			string_view_t{
+					scratch_buffer.data() + name_size,
+					scratch_buffer.size() - name_size } );
+
+	return nullopt;
+}
+
+} /* namespace impl */
+
+/*!
+ * @brief Helper function for handling parameters of query string
+ * without building query_string_params_t.
+ *
+ * Every `name=value` pair is passed to @a handler as a pair of
+ * string_view_t objects in the order of appearance in the query string.
+ * Nothing is copied if a name and a value don't contain percent-encoded
+ * characters and `+`: @a handler gets views into @a original_query_string.
+ * Otherwise the name and the value are unescaped into @a scratch_buffer.
+ * The same @a scratch_buffer can be reused for many query strings,
+ * so memory is allocated only if the buffer has to grow.
+ *
+ * Views passed to @a handler are valid only until @a handler returns.
+ *
+ * The query string is checked the same way as by try_parse_query().
+ * If the query string contains only a tag (web beacon) then the tag
+ * is passed to @a handler as the name with an empty value.
+ *
+ * Usage example:
+ * @code
+ * std::string scratch;
+ * const auto result = restinio::try_for_each_query_param<
+ * 		restinio::parse_query_traits::javascript_compatible >(
+ * 	req->header().query(),
+ * 	scratch,
+ * 	[&]( restinio::string_view_t name, restinio::string_view_t value ) {
+ * 		if( "limit" == name ) ...
+ * 	} );
+ * if( !result ) {
+ * 	std::cerr << "Unable to parse query-string: " << result.error().description() << std::endl;
+ * }
+ * @endcode
+ *
+ * @note
+ * If @a handler throws then the exception is passed to the caller.
+ *
+ * @return the count of parameters passed to the handler or a description
+ * of the first failure. Parameters before the failure are already
+ * passed to the handler in that case.
+ *
+ * @since v.0.6.9
+ */
+template< typename Parse_Traits, typename Handler >
+RESTINIO_NODISCARD
+expected_t< std::size_t, parse_query_failure_t >
+try_for_each_query_param(
+	//! Query part of the request target.
+	string_view_t original_query_string,
+	//! A buffer for unescaped names and values.
+	std::string & scratch_buffer,
+	//! A handler with `void(string_view_t, string_view_t)` signature.
+	Handler && handler )
+{
+	std::size_t params_count{ 0u };
+
+	string_view_t::size_type pos{ 0 };
+	const string_view_t::size_type end_pos = original_query_string.size();
+
+	while( pos < end_pos )
+	{
+		const auto eq_pos = original_query_string.find_first_of( '=', pos );
+
+		if( string_view_t::npos == eq_pos )
+		{
+			// The same logic as in try_parse_query().
+			if( pos != 0u )
+				return make_unexpected( parse_query_failure_t{
+						fmt::format(
+							"invalid format of key-value pairs in query_string, "
+							"no '=' symbol starting from position {}",
+							pos )
+					} );
+
+			// Query string contains only tag (web beacon).
+			auto failure = impl::handle_query_param< Parse_Traits >(
+					original_query_string,
+					string_view_t{},
+					scratch_buffer,
+					handler );
+			if( failure )
+				return make_unexpected( std::move(*failure) );
+
+			return std::size_t{ 1u };
+		}
+
+		const auto eq_pos_next = eq_pos + 1u;
+		auto separator_pos = Parse_Traits::find_next_separator(
+				original_query_string, eq_pos_next );
+		if( string_view_t::npos == separator_pos )
+			separator_pos = end_pos;
+
+		auto failure = impl::handle_query_param< Parse_Traits >(
+				original_query_string.substr( pos, eq_pos - pos ),
+				original_query_string.substr(
+						eq_pos_next, separator_pos - eq_pos_next ),
+				scratch_buffer,
+				handler );
+		if( failure )
+			return make_unexpected( std::move(*failure) );
+
+		++params_count;
+		pos = separator_pos + 1u;
+	}
+
+	return params_count;
+}
+
+//! Handle parameters of query string without building query_string_params_t.
+/*!
+	The same as try_for_each_query_param() but throws exception_t in the
+	case of a failure.
+
+	@return the count of parameters passed to the handler.
+
+	@since v.0.6.9
+*/
+template<
+	typename Parse_Traits = parse_query_traits::restinio_defaults,
+	typename Handler >
+std::size_t
+for_each_query_param(
+	//! Query part of the request target.
+	string_view_t original_query_string,
+	//! A buffer for unescaped names and values.
+	std::string & scratch_buffer,
+	//! A handler with `void(string_view_t, string_view_t)` signature.
+	Handler && handler )
+{
+	auto r = try_for_each_query_param< Parse_Traits >(
+			original_query_string,
+			scratch_buffer,
+			std::forward< Handler >( handler ) );
+	if( !r )
+		throw exception_t{ std::move(r.error().giveout_description()) };
+
+	return *r;
+}
+
+//! Handle parameters of query string without building query_string_params_t.
+/*!
+	The same as for_each_query_param() with a scratch buffer, but a
+	temporary buffer is used. Memory is allocated only if there are
+	percent-encoded characters or `+` in the query string.
+
+	Usage example:
+	@code
+	restinio::for_each_query_param( req->header().query(),
+		[&]( restinio::string_view_t name, restinio::string_view_t value ) {
+			...
+		} );
+	@endcode
+
+	@since v.0.6.9
+*/
+template<
+	typename Parse_Traits = parse_query_traits::restinio_defaults,
+	typename Handler >
+std::size_t
+for_each_query_param(
+	//! Query part of the request target.
+	string_view_t original_query_string,
+	//! A handler with `void(string_view_t, string_view_t)` signature.
+	Handler && handler )
+{
+	std::string scratch_buffer;
+	return for_each_query_param< Parse_Traits >(
+			original_query_string,
+			scratch_buffer,
+			std::forward< Handler >( handler ) );
+}
+
 } /* namespace restinio */
@@ -0,0 +1,205 @@
+/*
+ * RESTinio
+ */
+
+/*!
+ * @file
+ * @brief A finder of a substring that is searched many times.
+ *
+ * @since v.0.6.9
+ */
+
+#pragma once
+
+#include <restinio/string_view.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if !defined(RESTINIO_SUBSTRING_FINDER_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || \
+			(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define RESTINIO_SUBSTRING_FINDER_SSE2
+		#include <emmintrin.h>
+		#if defined(_MSC_VER)
+			#include <intrin.h>
+		#endif
+	#endif
+#endif
+
+namespace restinio
+{
+
+namespace utils
+{
+
+namespace impl
+{
+
+//
+// substring_finder_t
+//
+/*!
+ * @brief A finder of a pattern with a precomputed state.
+ *
+ * The state is prepared once in the constructor and then is
+ * reused for every search. It's intended for cases where the same
+ * pattern (like a boundary of a multipart body) is searched many
+ * times.
+ *
+ * If SSE2 is available then 16 positions are checked at once by
+ * comparing the first and the last bytes of the pattern. Only positions
+ * that pass that filter are compared with the whole pattern.
+ * Boyer-Moore-Horspool algorithm is used otherwise.
+ *
+ * SSE2 version can be disabled by RESTINIO_SUBSTRING_FINDER_NO_SIMD.
+ *
+ * @since v.0.6.9
+ */
+class substring_finder_t
+{
+public:
+	explicit substring_finder_t( string_view_t pattern )
+		:	m_pattern{ pattern.data(), pattern.size() }
+	{
+#if !defined(RESTINIO_SUBSTRING_FINDER_SSE2)
+		m_skip.fill( m_pattern.size() );
+		if( !m_pattern.empty() )
+			for( std::size_t i = 0u; i != m_pattern.size() - 1u; ++i )
+				m_skip[ static_cast< unsigned char >( m_pattern[ i ] ) ] =
+						m_pattern.size() - 1u - i;
+#endif
+	}
+
+	//! Get the pattern.
+	string_view_t
+	pattern() const noexcept { return m_pattern; }
+
+	//! Find the first occurrence of the pattern in @a text starting
+	//! from @a from.
+	/*!
+	 * @return position of the pattern or string_view_t::npos.
+	 */
+	std::size_t
+	find( string_view_t text, std::size_t from = 0u ) const noexcept
+	{
+		const std::size_t m = m_pattern.size();
+		if( from > text.size() || text.size() - from < m )
+			return string_view_t::npos;
+
+		if( 0u == m )
+			return from;
+
+		const char * const begin = text.data();
+		const char * const found = 1u == m ?
+				static_cast< const char * >( std::memchr(
+						begin + from, m_pattern[ 0 ], text.size() - from ) ) :
+				find_long( begin + from, begin + text.size() );
+
+		return found ? static_cast< std::size_t >( found - begin ) :
+				string_view_t::npos;
+	}
+
+private:
+	//! Does the pattern start at @a p?
+	/*!
+	 * The first and the last bytes are already checked.
+	 */
+	bool
+	matches_middle( const char * p ) const noexcept
+	{
+		return 0 == std::memcmp(
+				p + 1, m_pattern.data() + 1, m_pattern.size() - 2u );
+	}
+
+#if defined(RESTINIO_SUBSTRING_FINDER_SSE2)
+	const char *
+	find_long( const char * p, const char * end ) const noexcept
+	{
+		const std::size_t last = m_pattern.size() - 1u;
+		const char first_ch = m_pattern.front();
+		const char last_ch = m_pattern.back();
+
+		const __m128i first_v = _mm_set1_epi8( first_ch );
+		const __m128i last_v = _mm_set1_epi8( last_ch );
+
+		// A block of 16 positions can be checked if the last bytes
+		// for all of them are inside the text.
+		while( end - p >= static_cast< std::ptrdiff_t >( last + 16u ) )
+		{
+			const __m128i f = _mm_loadu_si128(
+					reinterpret_cast< const __m128i * >( p ) );
+			const __m128i l = _mm_loadu_si128(
+					reinterpret_cast< const __m128i * >( p + last ) );
+
+			unsigned mask = static_cast< unsigned >( _mm_movemask_epi8(
+					_mm_and_si128(
+							_mm_cmpeq_epi8( f, first_v ),
+							_mm_cmpeq_epi8( l, last_v ) ) ) );
+
+			while( 0u != mask )
+			{
+				const auto bit = count_trailing_zeros( mask );
+				if( matches_middle( p + bit ) )
+					return p + bit;
+				mask &= mask - 1u;
+			}
+
+			p += 16;
+		}
+
+		for( ; end - p > static_cast< std::ptrdiff_t >( last ); ++p )
+		{
+			if( first_ch == p[ 0 ] && last_ch == p[ last ] &&
+				matches_middle( p ) )
+				return p;
+		}
+
+		return nullptr;
+	}
+
+	static unsigned
+	count_trailing_zeros( unsigned v ) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward( &index, v );
+		return static_cast< unsigned >( index );
+#else
+		return static_cast< unsigned >( __builtin_ctz( v ) );
+#endif
+	}
+#else
+	const char *
+	find_long( const char * p, const char * end ) const noexcept
+	{
+		const std::size_t last = m_pattern.size() - 1u;
+		const char last_ch = m_pattern.back();
+
+		while( end - p > static_cast< std::ptrdiff_t >( last ) )
+		{
+			const char ch = p[ last ];
+			if( last_ch == ch && m_pattern.front() == p[ 0 ] &&
+				matches_middle( p ) )
+				return p;
+
+			p += m_skip[ static_cast< unsigned char >( ch ) ];
+		}
+
+		return nullptr;
+	}
+
+	//! Shifts for Boyer-Moore-Horspool algorithm.
+	std::array< std::size_t, 256u > m_skip;
+#endif
+
+	std::string m_pattern;
+};
+
+} /* namespace impl */
+
+} /* namespace utils */
+
+} /* namespace restinio */
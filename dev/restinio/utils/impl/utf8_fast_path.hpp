@@ -0,0 +1,236 @@
+/*
+ * RESTinio
+ */
+
+/*!
+ * @file
+ * @brief Helpers for fast validation of long UTF-8 sequences.
+ *
+ * @since v.0.6.9
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if !defined(RESTINIO_UTF8_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || \
+			(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define RESTINIO_UTF8_SSE2_FAST_PATH
+		#include <emmintrin.h>
+	#endif
+#endif
+
+namespace restinio
+{
+
+namespace utils
+{
+
+namespace impl
+{
+
+namespace utf8_fast_path
+{
+
+//
+// skip_ascii
+//
+/*!
+ * @brief Find the first non-ASCII byte in [begin, end).
+ *
+ * Uses SSE2 (if available) or 8-byte words to check several bytes at once.
+ *
+ * @return pointer to the first non-ASCII byte or @a end.
+ */
+inline const std::uint8_t *
+skip_ascii( const std::uint8_t * begin, const std::uint8_t * end ) noexcept
+{
+#if defined(RESTINIO_UTF8_SSE2_FAST_PATH)
+	while( end - begin >= 16 )
+	{
+		const __m128i v = _mm_loadu_si128(
+				reinterpret_cast< const __m128i * >( begin ) );
+		if( 0 != _mm_movemask_epi8( v ) )
+			break;
+		begin += 16;
+	}
+#endif
+
+	while( end - begin >= 8 )
+	{
+		std::uint64_t v;
+		std::memcpy( &v, begin, sizeof(v) );
+		if( 0u != ( v & 0x8080808080808080ull ) )
+			break;
+		begin += 8;
+	}
+
+	while( begin != end && *begin < 0x80u )
+		++begin;
+
+	return begin;
+}
+
+//! The state of DFA for the end of a valid symbol.
+constexpr std::uint8_t accept_state = 0u;
+//! The state of DFA for an invalid sequence.
+constexpr std::uint8_t reject_state = 12u;
+
+//
+// dfa_table
+//
+/*!
+ * @brief Tables for DFA that validates UTF-8 sequences.
+ *
+ * This is the DFA by Bjoern Hoehrmann
+ * (http://bjoern.hoehrmann.de/utf-8/decoder/dfa/).
+ *
+ * The first 256 items map bytes to character classes. The rest is
+ * the transition table: the next state is
+ * `table[256 + state + class]`.
+ *
+ * The DFA accepts only well-formed UTF-8 (RFC 3629): overlong forms,
+ * surrogates and code points above U+10FFFF are rejected.
+ */
+inline const std::uint8_t *
+dfa_table() noexcept
+{
+	static constexpr std::uint8_t table[] = {
+		// 0x00..0x7F
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		// 0x80..0xBF
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7, 7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		// 0xC0..0xFF
+		8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		10,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3, 11,6,6,6,5,8,8,8,8,8,8,8,8,8,8,8,
+
+		// Transitions.
+		0,12,24,36,60,96,84,12,12,12,48,72, 12,12,12,12,12,12,12,12,12,12,12,12,
+		12, 0,12,12,12,12,12, 0,12, 0,12,12, 12,24,12,12,12,12,12,24,12,24,12,12,
+		12,12,12,12,12,12,12,24,12,12,12,12, 12,24,12,12,12,12,12,12,12,24,12,12,
+		12,12,12,12,12,12,12,36,12,36,12,12, 12,36,12,12,12,12,12,36,12,36,12,12,
+		12,36,12,12,12,12,12,12,12,12,12,12,
+	};
+
+	return table;
+}
+
+//
+// is_continuation
+//
+//! Is it a continuation byte (10xxxxxx)?
+inline bool
+is_continuation( std::uint8_t byte ) noexcept
+{
+	return 0x80u == ( byte & 0xC0u );
+}
+
+//
+// find_incomplete_tail
+//
+/*!
+ * @brief Find the beginning of a symbol that is cut by the end of the buffer.
+ *
+ * Leading bytes of 5- and 6-byte forms are taken into account too,
+ * so the bytes before the returned pointer contain only complete
+ * (or definitely invalid) sequences.
+ *
+ * @return pointer to the leading byte of an incomplete symbol or @a end.
+ */
+inline const std::uint8_t *
+find_incomplete_tail(
+	const std::uint8_t * begin, const std::uint8_t * end ) noexcept
+{
+	for( std::ptrdiff_t k = 1; k <= 5 && k <= end - begin; ++k )
+	{
+		const std::uint8_t byte = *(end - k);
+		if( is_continuation( byte ) )
+			// Go further to the leading byte.
+			continue;
+
+		std::ptrdiff_t expected = 1;
+		if( 0xC0u == ( byte & 0xE0u ) ) expected = 2;
+		else if( 0xE0u == ( byte & 0xF0u ) ) expected = 3;
+		else if( 0xF0u == ( byte & 0xF8u ) ) expected = 4;
+		else if( 0xF8u == ( byte & 0xFCu ) ) expected = 5;
+		else if( 0xFCu == ( byte & 0xFEu ) ) expected = 6;
+
+		return expected > k ? end - k : end;
+	}
+
+	return end;
+}
+
+//
+// validate_complete_symbols
+//
+/*!
+ * @brief Validate a buffer that is expected to hold only complete symbols.
+ *
+ * Runs of ASCII bytes are skipped by skip_ascii(). The most frequent
+ * 2- and 3-byte symbols (that can't be overlong or surrogates) are
+ * checked directly, all other symbols are validated by the DFA.
+ *
+ * @return true if the whole buffer is a valid UTF-8 sequence.
+ */
+inline bool
+validate_complete_symbols(
+	const std::uint8_t * begin, const std::uint8_t * end ) noexcept
+{
+	const std::uint8_t * table = dfa_table();
+
+	while( begin != end )
+	{
+		const std::uint8_t lead = *begin;
+		if( lead < 0x80u )
+		{
+			begin = skip_ascii( begin, end );
+			continue;
+		}
+
+		const auto rest = end - begin;
+		if( lead >= 0xC2u && lead <= 0xDFu &&
+				rest >= 2 && is_continuation( begin[ 1 ] ) )
+		{
+			begin += 2;
+			continue;
+		}
+
+		if( lead >= 0xE1u && lead <= 0xEFu && lead != 0xEDu &&
+				rest >= 3 &&
+				is_continuation( begin[ 1 ] ) && is_continuation( begin[ 2 ] ) )
+		{
+			begin += 3;
+			continue;
+		}
+
+		std::uint_fast32_t state = accept_state;
+		do
+		{
+			state = table[ 256u + state + table[ *begin ] ];
+			if( reject_state == state )
+				return false;
+			++begin;
+		}
+		while( accept_state != state && begin != end );
+
+		if( accept_state != state )
+			return false;
+	}
+
+	return true;
+}
+
+} /* namespace utf8_fast_path */
+
+} /* namespace impl */
+
+} /* namespace utils */
+
+} /* namespace restinio */
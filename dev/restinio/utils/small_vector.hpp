@@ -0,0 +1,334 @@
+/*
+	restinio
+*/
+
+/*!
+	A vector-like container with inline storage for a few items.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace restinio
+{
+
+namespace utils
+{
+
+//
+// small_vector_t
+//
+
+//! A vector-like container that keeps up to N items in place.
+/*!
+	Items are stored inside the container object until their count
+	exceeds N. Only then a dynamic storage is allocated.
+
+	Only a subset of std::vector interface is implemented.
+
+	\note T must have a move constructor and a move assignment
+	that don't throw (even if they aren't marked as noexcept).
+	Items are relocated by move constructor when the container
+	grows or is moved.
+
+	@since v.0.6.9
+*/
+template< typename T, std::size_t N >
+class small_vector_t
+{
+	static_assert( 0u != N, "inline capacity can't be zero" );
+
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T &;
+		using const_reference = const T &;
+		using pointer = T *;
+		using const_pointer = const T *;
+		using iterator = T *;
+		using const_iterator = const T *;
+
+		//! The count of items that can be stored without allocation.
+		static constexpr std::size_t inline_capacity = N;
+
+		small_vector_t() noexcept = default;
+
+		small_vector_t( const small_vector_t & ) = delete;
+		small_vector_t & operator=( const small_vector_t & ) = delete;
+
+		small_vector_t( small_vector_t && other ) noexcept
+		{
+			steal_from( other );
+		}
+
+		small_vector_t &
+		operator=( small_vector_t && other ) noexcept
+		{
+			if( this != &other )
+			{
+				clear();
+				free_dynamic_storage();
+				steal_from( other );
+			}
+
+			return *this;
+		}
+
+		~small_vector_t()
+		{
+			clear();
+			free_dynamic_storage();
+		}
+
+		friend void
+		swap( small_vector_t & a, small_vector_t & b ) noexcept
+		{
+			small_vector_t tmp{ std::move( a ) };
+			a = std::move( b );
+			b = std::move( tmp );
+		}
+
+		size_type size() const noexcept { return m_size; }
+
+		bool empty() const noexcept { return 0u == m_size; }
+
+		size_type capacity() const noexcept { return m_capacity; }
+
+		//! Does the container use dynamic storage?
+		bool
+		is_dynamic() const noexcept
+		{
+			return m_data != inline_data();
+		}
+
+		T * data() noexcept { return m_data; }
+		const T * data() const noexcept { return m_data; }
+
+		iterator begin() noexcept { return m_data; }
+		iterator end() noexcept { return m_data + m_size; }
+		const_iterator begin() const noexcept { return m_data; }
+		const_iterator end() const noexcept { return m_data + m_size; }
+		const_iterator cbegin() const noexcept { return m_data; }
+		const_iterator cend() const noexcept { return m_data + m_size; }
+
+		T & operator[]( size_type i ) noexcept { return m_data[ i ]; }
+		const T & operator[]( size_type i ) const noexcept { return m_data[ i ]; }
+
+		T & front() noexcept { return m_data[ 0 ]; }
+		const T & front() const noexcept { return m_data[ 0 ]; }
+
+		T & back() noexcept { return m_data[ m_size - 1u ]; }
+		const T & back() const noexcept { return m_data[ m_size - 1u ]; }
+
+		void
+		reserve( size_type new_capacity )
+		{
+			if( new_capacity > m_capacity )
+				reallocate( new_capacity );
+		}
+
+		//! Change the size of the container.
+		/*!
+			New items are default constructed.
+		*/
+		void
+		resize( size_type new_size )
+		{
+			if( new_size < m_size )
+			{
+				destroy_range( m_data + new_size, m_data + m_size );
+				m_size = new_size;
+			}
+			else
+			{
+				reserve( new_size );
+				while( m_size != new_size )
+					emplace_back();
+			}
+		}
+
+		//! Add an item to the end.
+		/*!
+			@a args may refer to an item of the container: when
+			the container grows the new item is constructed before
+			the old items are moved to the new storage.
+		*/
+		template< typename... Args >
+		T &
+		emplace_back( Args &&... args )
+		{
+			if( m_size == m_capacity )
+				return emplace_back_with_reallocation(
+						std::forward< Args >( args )... );
+
+			T * item = new( m_data + m_size ) T( std::forward< Args >( args )... );
+			++m_size;
+
+			return *item;
+		}
+
+		void push_back( const T & item ) { emplace_back( item ); }
+		void push_back( T && item ) { emplace_back( std::move( item ) ); }
+
+		void
+		pop_back() noexcept
+		{
+			--m_size;
+			m_data[ m_size ].~T();
+		}
+
+		//! Remove an item.
+		/*!
+			Items after @a pos are shifted by move assignment.
+		*/
+		iterator
+		erase( const_iterator pos ) noexcept
+		{
+			T * p = m_data + ( pos - m_data );
+			std::move( p + 1, end(), p );
+			pop_back();
+
+			return p;
+		}
+
+		//! Remove all items.
+		/*!
+			Dynamic storage (if any) isn't freed.
+		*/
+		void
+		clear() noexcept
+		{
+			destroy_range( m_data, m_data + m_size );
+			m_size = 0u;
+		}
+
+	private:
+		using inline_storage_t = typename std::aligned_storage<
+				sizeof(T) * N, alignof(T) >::type;
+
+		T *
+		inline_data() noexcept
+		{
+			return reinterpret_cast< T * >( &m_inline_storage );
+		}
+
+		const T *
+		inline_data() const noexcept
+		{
+			return reinterpret_cast< const T * >( &m_inline_storage );
+		}
+
+		static void
+		destroy_range( T * from, T * to ) noexcept
+		{
+			for( ; from != to; ++from )
+				from->~T();
+		}
+
+		//! Move items from one place to another and destroy the source.
+		static void
+		relocate( T * from, T * to, T * dest ) noexcept
+		{
+			for( ; from != to; ++from, ++dest )
+			{
+				new( dest ) T( std::move( *from ) );
+				from->~T();
+			}
+		}
+
+		void
+		free_dynamic_storage() noexcept
+		{
+			if( is_dynamic() )
+			{
+				std::allocator< T >{}.deallocate( m_data, m_capacity );
+				m_data = inline_data();
+				m_capacity = N;
+			}
+		}
+
+		void
+		reallocate( size_type new_capacity )
+		{
+			T * new_data = std::allocator< T >{}.allocate( new_capacity );
+
+			replace_storage( new_data, new_capacity );
+		}
+
+		//! Move items to a new storage and free the old one.
+		void
+		replace_storage( T * new_data, size_type new_capacity ) noexcept
+		{
+			relocate( m_data, m_data + m_size, new_data );
+			free_dynamic_storage();
+
+			m_data = new_data;
+			m_capacity = new_capacity;
+		}
+
+		template< typename... Args >
+		T &
+		emplace_back_with_reallocation( Args &&... args )
+		{
+			const size_type new_capacity = 2u * m_capacity;
+			T * new_data = std::allocator< T >{}.allocate( new_capacity );
+
+			// Old items are still in place, so args can refer to them.
+			T * item;
+			try
+			{
+				item = new( new_data + m_size ) T( std::forward< Args >( args )... );
+			}
+			catch( ... )
+			{
+				std::allocator< T >{}.deallocate( new_data, new_capacity );
+				throw;
+			}
+
+			replace_storage( new_data, new_capacity );
+			++m_size;
+
+			return *item;
+		}
+
+		//! Take the content of @a other.
+		/*!
+			The container must be empty and must not use dynamic storage.
+		*/
+		void
+		steal_from( small_vector_t & other ) noexcept
+		{
+			if( other.is_dynamic() )
+			{
+				m_data = other.m_data;
+				m_capacity = other.m_capacity;
+
+				other.m_data = other.inline_data();
+				other.m_capacity = N;
+			}
+			else
+				relocate( other.m_data, other.m_data + other.m_size, m_data );
+
+			m_size = other.m_size;
+			other.m_size = 0u;
+		}
+
+		inline_storage_t m_inline_storage;
+
+		T * m_data{ inline_data() };
+		size_type m_size{ 0u };
+		size_type m_capacity{ N };
+};
+
+} /* namespace utils */
+
+} /* namespace restinio */
@@ -13,6 +13,8 @@
 
 #include <restinio/compiler_features.hpp>
 
+#include <restinio/utils/impl/utf8_fast_path.hpp>
+
 #include <cstdint>
 
 namespace restinio
@@ -112,6 +114,64 @@ public:
 		return m_state == state_t::valid || m_state == state_t::may_be_overlong;
 	}
 
+	/*!
+	 * @brief Process a sequence of bytes.
+	 *
+	 * It is an equivalent of calling process_byte() for every byte
+	 * of the sequence, but long sequences are validated much faster:
+	 * runs of ASCII bytes are skipped by several bytes at once and
+	 * multi-byte symbols are checked by a table-driven DFA.
+	 *
+	 * The checking is incremental: a symbol can be split between
+	 * several calls (and calls to process_byte()).
+	 *
+	 * @note
+	 * The value of current_symbol() isn't updated for symbols
+	 * handled by the fast path.
+	 *
+	 * @return false if an invalid sequence is found.
+	 *
+	 * @since v.0.6.9
+	 */
+	RESTINIO_NODISCARD
+	bool
+	process_bytes( const std::uint8_t * data, std::size_t size ) noexcept
+	{
+		const std::uint8_t * end = data + size;
+
+		// The end of a symbol started earlier is handled byte by byte.
+		while( m_current_symbol_rest_bytes > 0 && data != end )
+		{
+			if( !process_byte( *data++ ) )
+				return false;
+		}
+
+		if( data == end || m_state != state_t::valid )
+			return m_state == state_t::valid ||
+					m_state == state_t::may_be_overlong;
+
+		// A symbol that is cut by the end of the sequence is handled
+		// byte by byte too, so the state of the checker remains
+		// consistent for the next call.
+		const std::uint8_t * tail =
+				impl::utf8_fast_path::find_incomplete_tail( data, end );
+
+		if( !impl::utf8_fast_path::validate_complete_symbols( data, tail ) )
+		{
+			m_state = state_t::invalid;
+			return false;
+		}
+
+		m_current_symbol = 0;
+		for( ; tail != end; ++tail )
+		{
+			if( !process_byte( *tail ) )
+				return false;
+		}
+
+		return true;
+	}
+
 	/*!
 	 * @return true if the current sequence finalized.
 	 */
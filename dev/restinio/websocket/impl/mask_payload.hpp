@@ -0,0 +1,250 @@
+/*
+	restinio
+*/
+
+/*!
+	Websocket: masking/unmasking of payload.
+
+	@since v.0.6.9
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+
+#if !defined(RESTINIO_WEBSOCKET_NO_SIMD_MASK)
+	#if defined(__SSE2__) || defined(_M_X64) || \
+			(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define RESTINIO_WEBSOCKET_SSE2_MASK
+		#include <emmintrin.h>
+	#endif
+
+	// AVX2 kernel is used only if RESTINIO_WEBSOCKET_PREFER_AVX2_MASK
+	// is defined (see detect_best_kernel()).
+	#if (defined(__GNUC__) || defined(__clang__)) && \
+			(defined(__x86_64__) || defined(__i386__))
+		#define RESTINIO_WEBSOCKET_AVX2_MASK
+		#include <immintrin.h>
+	#endif
+#endif
+
+namespace restinio
+{
+
+namespace websocket
+{
+
+namespace basic
+{
+
+namespace impl
+{
+
+namespace mask_impl
+{
+
+/*!
+ * @brief Masking key with bytes in the order they are applied to payload.
+ *
+ * Byte with index 0 is applied to the first byte of data to be processed.
+ *
+ * @since v.0.6.9
+ */
+using mask_bytes_t = std::array< std::uint8_t, 4 >;
+
+/*!
+ * @brief Type of function that applies a mask to a buffer.
+ *
+ * Every kernel processes the whole buffer. Because all kernels use
+ * blocks which sizes are multiple of 4 the mask phase at the tail of
+ * the buffer is the same as at the beginning.
+ *
+ * @since v.0.6.9
+ */
+using kernel_t = void (*)(
+	const mask_bytes_t & mask, unsigned char * data, std::size_t size );
+
+//! The simplest byte-by-byte implementation.
+inline void
+mask_bytewise(
+	const mask_bytes_t & mask, unsigned char * data, std::size_t size ) noexcept
+{
+	for( std::size_t i = 0u; i != size; ++i )
+		data[ i ] ^= mask[ i & 3u ];
+}
+
+//! Implementation that processes 8 bytes at once.
+inline void
+mask_words(
+	const mask_bytes_t & mask, unsigned char * data, std::size_t size ) noexcept
+{
+	unsigned char pattern_bytes[ 8 ];
+	std::memcpy( pattern_bytes, mask.data(), 4u );
+	std::memcpy( pattern_bytes + 4, mask.data(), 4u );
+
+	std::uint64_t pattern;
+	std::memcpy( &pattern, pattern_bytes, sizeof(pattern) );
+
+	std::size_t i = 0u;
+	for( ; i + 8u <= size; i += 8u )
+	{
+		std::uint64_t v;
+		std::memcpy( &v, data + i, sizeof(v) );
+		v ^= pattern;
+		std::memcpy( data + i, &v, sizeof(v) );
+	}
+
+	mask_bytewise( mask, data + i, size - i );
+}
+
+#if defined(RESTINIO_WEBSOCKET_SSE2_MASK)
+//! Implementation that processes 16 bytes at once with SSE2.
+inline void
+mask_sse2(
+	const mask_bytes_t & mask, unsigned char * data, std::size_t size ) noexcept
+{
+	std::int32_t pattern32;
+	std::memcpy( &pattern32, mask.data(), sizeof(pattern32) );
+	const __m128i pattern = _mm_set1_epi32( pattern32 );
+
+	std::size_t i = 0u;
+	for( ; i + 64u <= size; i += 64u )
+	{
+		auto * p = reinterpret_cast< __m128i * >( data + i );
+		const __m128i v0 = _mm_loadu_si128( p );
+		const __m128i v1 = _mm_loadu_si128( p + 1 );
+		const __m128i v2 = _mm_loadu_si128( p + 2 );
+		const __m128i v3 = _mm_loadu_si128( p + 3 );
+		_mm_storeu_si128( p, _mm_xor_si128( v0, pattern ) );
+		_mm_storeu_si128( p + 1, _mm_xor_si128( v1, pattern ) );
+		_mm_storeu_si128( p + 2, _mm_xor_si128( v2, pattern ) );
+		_mm_storeu_si128( p + 3, _mm_xor_si128( v3, pattern ) );
+	}
+	for( ; i + 16u <= size; i += 16u )
+	{
+		auto * p = reinterpret_cast< __m128i * >( data + i );
+		_mm_storeu_si128( p, _mm_xor_si128( _mm_loadu_si128( p ), pattern ) );
+	}
+
+	mask_words( mask, data + i, size - i );
+}
+#endif
+
+#if defined(RESTINIO_WEBSOCKET_AVX2_MASK)
+//! Implementation that processes 32 bytes at once with AVX2.
+/*!
+ * @attention
+ * Should be called only if CPU supports AVX2.
+ */
+__attribute__((target("avx2")))
+inline void
+mask_avx2(
+	const mask_bytes_t & mask, unsigned char * data, std::size_t size ) noexcept
+{
+	std::int32_t pattern32;
+	std::memcpy( &pattern32, mask.data(), sizeof(pattern32) );
+	const __m256i pattern = _mm256_set1_epi32( pattern32 );
+
+	std::size_t i = 0u;
+	for( ; i + 128u <= size; i += 128u )
+	{
+		auto * p = reinterpret_cast< __m256i * >( data + i );
+		const __m256i v0 = _mm256_loadu_si256( p );
+		const __m256i v1 = _mm256_loadu_si256( p + 1 );
+		const __m256i v2 = _mm256_loadu_si256( p + 2 );
+		const __m256i v3 = _mm256_loadu_si256( p + 3 );
+		_mm256_storeu_si256( p, _mm256_xor_si256( v0, pattern ) );
+		_mm256_storeu_si256( p + 1, _mm256_xor_si256( v1, pattern ) );
+		_mm256_storeu_si256( p + 2, _mm256_xor_si256( v2, pattern ) );
+		_mm256_storeu_si256( p + 3, _mm256_xor_si256( v3, pattern ) );
+	}
+	for( ; i + 32u <= size; i += 32u )
+	{
+		auto * p = reinterpret_cast< __m256i * >( data + i );
+		_mm256_storeu_si256(
+				p, _mm256_xor_si256( _mm256_loadu_si256( p ), pattern ) );
+	}
+
+	mask_words( mask, data + i, size - i );
+}
+#endif
+
+//! Select the best kernel for the current CPU.
+/*!
+ * SSE2 kernel is used by default (if it's available). AVX2 kernel isn't
+ * faster than SSE2 one for large payloads that are limited by memory
+ * bandwidth, so it's selected only if RESTINIO_WEBSOCKET_PREFER_AVX2_MASK
+ * is defined and the CPU supports AVX2.
+ */
+inline kernel_t
+detect_best_kernel() noexcept
+{
+#if defined(RESTINIO_WEBSOCKET_AVX2_MASK) && \
+		defined(RESTINIO_WEBSOCKET_PREFER_AVX2_MASK)
+	if( __builtin_cpu_supports( "avx2" ) )
+		return &mask_avx2;
+#endif
+
+#if defined(RESTINIO_WEBSOCKET_SSE2_MASK)
+	return &mask_sse2;
+#else
+	return &mask_words;
+#endif
+}
+
+//! Get the best kernel for the current CPU.
+/*!
+ * The detection is performed only once.
+ */
+inline kernel_t
+best_kernel() noexcept
+{
+	static const kernel_t kernel = detect_best_kernel();
+	return kernel;
+}
+
+//! Payloads shorter than that are processed without dispatching.
+constexpr std::size_t small_payload_size = 16u;
+
+} /* namespace mask_impl */
+
+/*!
+ * @brief Apply websocket mask to a part of payload.
+ *
+ * @a phase is the count of payload bytes processed before @a data
+ * (only its remainder of division by 4 matters). It allows to process
+ * a payload by parts.
+ *
+ * @a mask contains bytes of masking key in network byte order.
+ *
+ * @since v.0.6.9
+ */
+inline void
+mask_unmask_payload_part(
+	const mask_impl::mask_bytes_t & mask,
+	std::size_t phase,
+	char * data,
+	std::size_t size ) noexcept
+{
+	const mask_impl::mask_bytes_t rotated{ {
+			mask[ phase & 3u ],
+			mask[ ( phase + 1u ) & 3u ],
+			mask[ ( phase + 2u ) & 3u ],
+			mask[ ( phase + 3u ) & 3u ] } };
+
+	auto * bytes = reinterpret_cast< unsigned char * >( data );
+	if( size < mask_impl::small_payload_size )
+		mask_impl::mask_bytewise( rotated, bytes, size );
+	else
+		(*mask_impl::best_kernel())( rotated, bytes, size );
+}
+
+} /* namespace impl */
+
+} /* namespace basic */
+
+} /* namespace websocket */
+
+} /* namespace restinio */
@@ -30,12 +30,12 @@ check_utf8_is_correct( string_view_t sv ) noexcept
 {
 	restinio::utils::utf8_checker_t checker;
 
-	for( const auto & ch : sv )
+	// NOTE: since v.0.6.9 the fast path of the checker is used.
+	if( !checker.process_bytes(
+			reinterpret_cast< const std::uint8_t * >( sv.data() ),
+			sv.size() ) )
 	{
-		if( !checker.process_byte( static_cast<std::uint8_t>(ch) ) )
-		{
-			return false;
-		}
+		return false;
 	}
 
 	return checker.finalized();
@@ -144,12 +144,14 @@ class ws_connection_t final
 			//! \{
 			restinio::impl::connection_settings_handle_t< Traits > settings,
 			stream_socket_t socket,
+			restinio::impl::connection_lifetime_guard_t lifetime_guard,
 			//! \}
 			message_handler_t msg_handler )
 			:	ws_connection_base_t{ conn_id }
 			,	executor_wrapper_base_t{ socket.get_executor() }
 			,	m_settings{ std::move( settings ) }
 			,	m_socket{ std::move( socket ) }
+			,	m_lifetime_guard{ std::move( lifetime_guard ) }
 			,	m_timer_guard{ m_settings->create_timer_guard() }
 			,	m_input{ websocket_header_max_size() }
 			,	m_msg_handler{ std::move( msg_handler ) }
@@ -1248,6 +1250,10 @@ class ws_connection_t final
 		//! Connection.
 		stream_socket_t m_socket;
 
+		//! The place of the connection in connection_count_limiter.
+		//! @since v.0.6.9
+		restinio::impl::connection_lifetime_guard_t m_lifetime_guard;
+
 		//! Timers.
 		//! \{
 		static ws_connection_t &
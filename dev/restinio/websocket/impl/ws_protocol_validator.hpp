@@ -143,6 +143,20 @@ struct unmasker_t
 		return masked_byte ^ m_mask[ (m_processed_bytes_count++) % 4 ];
 	}
 
+	//! Do unmask operation for a sequence of bytes.
+	/*!
+		The mask phase is preserved between calls, so a payload
+		can be unmasked by parts.
+
+		@since v.0.6.9
+	*/
+	void
+	unmask( char * data, size_t size ) noexcept
+	{
+		mask_unmask_payload_part( m_mask, m_processed_bytes_count, data, size );
+		m_processed_bytes_count += size;
+	}
+
 	//! Reset to initial state.
 	void
 	reset( uint32_t masking_key )
@@ -286,14 +300,12 @@ class ws_protocol_validator_t
 			else
 				return m_validation_state;
 
-			for( size_t i = 0; i < size; ++i )
-			{
-				data[i] = static_cast<char>(process_payload_byte(
-					static_cast<std::uint8_t>(data[i]) ));
+			// Since v.0.6.9 the whole part is unmasked at once
+			// and only then validated.
+			if( m_unmask_flag )
+				m_unmasker.unmask( data, size );
 
-				if( m_validation_state != validation_state_t::payload_part_is_valid )
-					break;
-			}
+			validate_payload_part( data, size );
 
 			return m_validation_state;
 		}
@@ -397,7 +409,7 @@ class ws_protocol_validator_t
 
 		//! Process payload byte.
 		/*!
-			Do all necessary validations with payload byte.
+			Unmask payload byte and do all necessary validations with it.
 
 			\return unmasked byte if unmask flag is set.
 			\return copy of original byte if unmask flag isn't set.
@@ -408,9 +420,63 @@ class ws_protocol_validator_t
 			byte = m_unmask_flag?
 				m_unmasker.unmask_byte( byte ): byte;
 
-			if( m_current_frame.m_opcode == opcode_t::text_frame ||
+			validate_payload_byte( byte );
+
+			return byte;
+		}
+
+		//! Validate already unmasked part of payload.
+		/*!
+			Payload of text frames is checked by the fast UTF-8 checker,
+			payload of close frames is checked byte by byte.
+			Payload of binary frames isn't validated at all.
+
+			@since v.0.6.9
+		*/
+		void
+		validate_payload_part( const char * data, size_t size )
+		{
+			if( is_text_payload() )
+			{
+				if( !m_utf8_checker.process_bytes(
+						reinterpret_cast< const std::uint8_t * >( data ), size ) )
+				{
+					set_validation_state(
+						validation_state_t::incorrect_utf8_data );
+				}
+			}
+			else if( m_current_frame.m_opcode == opcode_t::connection_close_frame )
+			{
+				for( size_t i = 0; i < size; ++i )
+				{
+					validate_payload_byte( static_cast<std::uint8_t>(data[i]) );
+
+					if( m_validation_state != validation_state_t::payload_part_is_valid )
+						break;
+				}
+			}
+		}
+
+		//! Is it a payload of a text message?
+		/*!
+			@since v.0.6.9
+		*/
+		bool
+		is_text_payload() const noexcept
+		{
+			return m_current_frame.m_opcode == opcode_t::text_frame ||
 				(m_current_frame.m_opcode == opcode_t::continuation_frame &&
-					m_previous_data_frame == previous_data_frame_t::text) )
+					m_previous_data_frame == previous_data_frame_t::text);
+		}
+
+		//! Validate already unmasked payload byte.
+		/*!
+			@since v.0.6.9
+		*/
+		void
+		validate_payload_byte( std::uint8_t byte )
+		{
+			if( is_text_payload() )
 			{
 				if( !m_utf8_checker.process_byte( byte ) )
 				{
@@ -439,8 +505,6 @@ class ws_protocol_validator_t
 							validation_state_t::incorrect_utf8_data );
 				}
 			}
-
-			return byte;
 		}
 
 		//! Check previous frame type.
@@ -9,9 +9,11 @@ MxxRu::Cpp::composite_target {
 
 	required_prj( "test/metaprogramming/prj.ut.rb" )
 	required_prj( "test/tuple_algorithms/prj.ut.rb" )
+	required_prj( "test/small_vector/prj.ut.rb" )
 	required_prj( "test/http_field_parser/prj.ut.rb" )
 	required_prj( "test/try_parse_field/prj.ut.rb" )
 	required_prj( "test/multipart_body/prj.ut.rb" )
+	required_prj( "test/multipart_stream/prj.ut.rb" )
 
 	required_prj( "test/header/prj.ut.rb" )
 	required_prj( "test/default_constructed_settings/prj.ut.rb" )
@@ -19,6 +21,8 @@ MxxRu::Cpp::composite_target {
 	required_prj( "test/buffers/prj.ut.rb" )
 	required_prj( "test/response_coordinator/prj.ut.rb" )
 	required_prj( "test/write_group_output_ctx/prj.ut.rb" )
+	required_prj( "test/connection_pool/prj.ut.rb" )
+	required_prj( "test/prepared_response/prj.ut.rb" )
 	required_prj( "test/from_string/prj.ut.rb" )
 	required_prj( "test/uri_helpers/prj.ut.rb" )
 
@@ -29,6 +33,7 @@ MxxRu::Cpp::composite_target {
 	if RestinioOpenSSLFind.has_openssl(toolset)
 		if not $sanitizer_build or $sanitizer_build != 'thread_sanitizer'
 			required_prj( "test/socket_options_tls/prj.ut.rb" )
+			required_prj( "test/ktls/prj.ut.rb" )
 		end
 	end
 
@@ -59,6 +64,13 @@ MxxRu::Cpp::composite_target {
 	# ================================================================
 	# Benches for implementation tuning.
 	required_prj( "test/to_lower_bench/prj.rb" )
+	required_prj( "test/header_bench/prj.rb" )
+	required_prj( "test/prepared_response_bench/prj.rb" )
+	required_prj( "test/write_group_bench/prj.rb" )
+	required_prj( "test/multipart_body/bench/prj.rb" )
+	required_prj( "test/parsed_field_bench/prj.rb" )
+	required_prj( "test/easy_parser_bench/prj.rb" )
+	required_prj( "test/uri_helpers_bench/prj.rb" )
 
 	# ================================================================
 	# Websocket tests
@@ -68,6 +80,8 @@ MxxRu::Cpp::composite_target {
 	required_prj( "test/websocket/validators/prj.ut.rb" )
 	required_prj( "test/websocket/ws_connection/prj.ut.rb" )
 	required_prj( "test/websocket/notificators/prj.ut.rb" )
+	required_prj( "test/websocket/mask_bench/prj.rb" )
+	required_prj( "test/websocket/utf8_bench/prj.rb" )
 
 	# ================================================================
 	# File upload support.
@@ -0,0 +1,89 @@
+/*
+	restinio
+*/
+
+/*!
+	Simple helpers for micro-benchmarks.
+*/
+
+#pragma once
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+//
+// microbench_sink
+//
+/*!
+	A place for results of benchmarked actions.
+
+	Writing to a volatile variable prevents the compiler from throwing
+	benchmarked code out.
+*/
+inline volatile std::size_t &
+microbench_sink() noexcept
+{
+	static volatile std::size_t sink{};
+	return sink;
+}
+
+template< typename T >
+void
+microbench_consume( const T & value ) noexcept
+{
+	microbench_sink() += static_cast< std::size_t >( value );
+}
+
+//
+// microbench_iterations
+//
+/*!
+	Get the count of iterations from the first command line argument.
+*/
+inline std::size_t
+microbench_iterations(
+	int argc,
+	const char * argv[],
+	std::size_t default_value )
+{
+	if( 1 < argc )
+		return static_cast< std::size_t >( std::strtoull( argv[ 1 ], nullptr, 10 ) );
+
+	return default_value;
+}
+
+//
+// run_microbench
+//
+/*!
+	Run \a lambda \a iterations times and print the time of one iteration.
+*/
+template< typename Lambda >
+void
+run_microbench(
+	const std::string & name,
+	std::size_t iterations,
+	Lambda && lambda )
+{
+	// Warm up.
+	for( std::size_t i = 0u, n = iterations / 10u; i != n; ++i )
+		lambda();
+
+	const auto started_at = std::chrono::steady_clock::now();
+	for( std::size_t i = 0u; i != iterations; ++i )
+		lambda();
+	const auto finished_at = std::chrono::steady_clock::now();
+
+	const double ns = static_cast< double >(
+			std::chrono::duration_cast< std::chrono::nanoseconds >(
+				finished_at - started_at ).count() );
+
+	fmt::print( "{:<48} {:>12.2f} ns/iter ({} iterations)\n",
+			name,
+			ns / static_cast< double >( iterations ),
+			iterations );
+}
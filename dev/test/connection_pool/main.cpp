@@ -0,0 +1,187 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for pool of connection objects.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using namespace restinio;
+using namespace restinio::impl;
+
+namespace
+{
+
+struct dummy_object_t
+{
+	std::array< char, 100 > m_data;
+	int m_value;
+
+	explicit dummy_object_t( int value ) : m_value{ value } {}
+};
+
+} /* namespace anonymous */
+
+TEST_CASE( "memory blocks are reused" , "[connection_pool][blocks]" )
+{
+	auto pool = std::make_shared< connection_pool_t >( 2u );
+
+	REQUIRE( 0u == pool->free_blocks_count() );
+
+	const void * first_address = nullptr;
+	{
+		auto obj = std::allocate_shared< dummy_object_t >(
+				connection_pool_allocator_t< dummy_object_t >{ pool }, 42 );
+		REQUIRE( 42 == obj->m_value );
+		first_address = obj.get();
+	}
+
+	REQUIRE( 1u == pool->free_blocks_count() );
+
+	{
+		auto obj = std::allocate_shared< dummy_object_t >(
+				connection_pool_allocator_t< dummy_object_t >{ pool }, 43 );
+		REQUIRE( 43 == obj->m_value );
+		REQUIRE( first_address == obj.get() );
+		REQUIRE( 0u == pool->free_blocks_count() );
+	}
+
+	REQUIRE( 1u == pool->free_blocks_count() );
+}
+
+TEST_CASE( "pool capacity" , "[connection_pool][capacity]" )
+{
+	auto pool = std::make_shared< connection_pool_t >( 2u );
+
+	{
+		std::vector< std::shared_ptr< dummy_object_t > > objects;
+		for( int i = 0; i != 5; ++i )
+			objects.push_back( std::allocate_shared< dummy_object_t >(
+					connection_pool_allocator_t< dummy_object_t >{ pool }, i ) );
+
+		for( int i = 0; i != 5; ++i )
+			REQUIRE( i == objects[ static_cast<std::size_t>(i) ]->m_value );
+	}
+
+	REQUIRE( 2u == pool->free_blocks_count() );
+
+	for( int i = 0; i != 5; ++i )
+		pool->release_storage( pooled_connection_storage_t{} );
+
+	REQUIRE( 2u == pool->free_storages_count() );
+}
+
+TEST_CASE( "pool outlives allocated objects" , "[connection_pool][lifetime]" )
+{
+	auto pool = std::make_shared< connection_pool_t >( 2u );
+	std::weak_ptr< connection_pool_t > weak_pool{ pool };
+
+	auto obj = std::allocate_shared< dummy_object_t >(
+			connection_pool_allocator_t< dummy_object_t >{ pool }, 42 );
+
+	pool.reset();
+	REQUIRE_FALSE( weak_pool.expired() );
+
+	obj.reset();
+	REQUIRE( weak_pool.expired() );
+}
+
+TEST_CASE( "storages are reused" , "[connection_pool][storages]" )
+{
+	connection_pool_t pool{ 4u };
+
+	{
+		auto storage = pool.acquire_storage();
+		REQUIRE( 0u == storage.m_input_buffer.capacity() );
+	}
+
+	const char * input_buffer = nullptr;
+	{
+		fixed_buffer_t buf{ 1024u, pool.acquire_storage().m_input_buffer };
+		write_group_output_ctx_t output_ctx{ asio_bufs_container_t{} };
+		response_coordinator_t coordinator{ 4u, {} };
+
+		input_buffer = buf.bytes();
+
+		pool.release_storage( pooled_connection_storage_t{
+				buf.release_storage(),
+				output_ctx.release_asio_bufs_storage(),
+				coordinator.release_storage() } );
+	}
+
+	REQUIRE( 1u == pool.free_storages_count() );
+
+	auto storage = pool.acquire_storage();
+	REQUIRE( 0u == pool.free_storages_count() );
+
+	REQUIRE( input_buffer == storage.m_input_buffer.data() );
+	REQUIRE( 1024u == storage.m_input_buffer.size() );
+	REQUIRE( storage.m_asio_bufs.empty() );
+	REQUIRE( 0u != storage.m_asio_bufs.capacity() );
+	REQUIRE( 4u == storage.m_response_contexts.size() );
+
+	// Storage of non-empty coordinator isn't reused.
+	response_coordinator_t coordinator{ 4u, std::move( storage.m_response_contexts ) };
+	coordinator.register_new_request();
+	REQUIRE( coordinator.release_storage().empty() );
+}
+
+TEST_CASE( "server with connection pool" , "[connection_pool][server]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.connection_pool_capacity( 2u )
+				.request_handler(
+					[]( auto req ){
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header_date_field()
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body( req->body() )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	for( int i = 0; i != 10; ++i )
+	{
+		const std::string body = fmt::format( "request #{}", i );
+		const std::string request_str = fmt::format(
+				"POST / HTTP/1.1\r\n"
+				"Host: 127.0.0.1\r\n"
+				"User-Agent: unit-test\r\n"
+				"Content-Length: {}\r\n"
+				"Connection: close\r\n"
+				"\r\n"
+				"{}",
+				body.size(),
+				body );
+
+		std::string response;
+		REQUIRE_NOTHROW( response = do_request( request_str ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( body ) );
+	}
+
+	other_thread.stop_and_join();
+}
@@ -0,0 +1,129 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for parsers of HTTP-fields built on top of easy_parser.
+*/
+
+#include <restinio/helpers/http_field_parsers/accept.hpp>
+#include <restinio/helpers/http_field_parsers/accept-language.hpp>
+#include <restinio/helpers/http_field_parsers/cache-control.hpp>
+#include <restinio/helpers/http_field_parsers/content-type.hpp>
+#include <restinio/helpers/http_field_parsers/user-agent.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio;
+using namespace restinio::http_field_parsers;
+
+namespace
+{
+
+//! A parser for values of Cookie field.
+/*!
+	There is no parser for Cookie in RESTinio, so a simple one is
+	built from the same blocks as other parsers:
+	cookie-string = cookie-pair *( ";" OWS cookie-pair )
+	cookie-pair = token "=" ( token / quoted-string )
+*/
+auto
+make_cookie_parser()
+{
+	auto pair_p = produce< parameter_with_mandatory_value_t >(
+			token_p() >> &parameter_with_mandatory_value_t::first,
+			symbol('='),
+			alternatives(
+				token_p() >> &parameter_with_mandatory_value_t::second,
+				quoted_string_p() >> &parameter_with_mandatory_value_t::second
+			)
+		);
+
+	return produce< parameter_with_mandatory_value_container_t >(
+			pair_p >> to_container(),
+			repeat( 0, N,
+				symbol(';'),
+				ows(),
+				pair_p >> to_container()
+			)
+		);
+}
+
+template< typename Parsed_Field_Type >
+void
+run_for_value(
+	const char * name,
+	std::size_t iterations,
+	string_view_t value )
+{
+	if( !Parsed_Field_Type::try_parse( value ) )
+	{
+		fmt::print( "{}: unable to parse the value\n", name );
+		std::exit( 1 );
+	}
+
+	run_microbench( name, iterations,
+		[value] {
+			microbench_consume( Parsed_Field_Type::try_parse( value ).has_value() );
+		} );
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 100000u );
+
+	run_for_value< accept_value_t >( "Accept (Firefox)", iterations,
+			"text/html,application/xhtml+xml,application/xml;q=0.9,"
+			"image/webp,*/*;q=0.8" );
+
+	run_for_value< accept_value_t >( "Accept (Chrome)", iterations,
+			"text/html,application/xhtml+xml,application/xml;q=0.9,"
+			"image/avif,image/webp,image/apng,*/*;q=0.8,"
+			"application/signed-exchange;v=b3;q=0.9" );
+
+	run_for_value< accept_language_value_t >( "Accept-Language", iterations,
+			"en-US,en;q=0.9,de;q=0.8,ru;q=0.7" );
+
+	run_for_value< user_agent_value_t >( "User-Agent (Firefox)", iterations,
+			"Mozilla/5.0 (X11; Ubuntu; Linux x86_64; rv:81.0) "
+			"Gecko/20100101 Firefox/81.0" );
+
+	run_for_value< user_agent_value_t >( "User-Agent (Chrome)", iterations,
+			"Mozilla/5.0 (Windows NT 10.0; Win64; x64) "
+			"AppleWebKit/537.36 (KHTML, like Gecko) "
+			"Chrome/86.0.4240.75 Safari/537.36" );
+
+	run_for_value< content_type_value_t >( "Content-Type", iterations,
+			"multipart/form-data; "
+			"boundary=\"----WebKitFormBoundary7MA4YWxkTrZu0gW\"" );
+
+	run_for_value< cache_control_value_t >( "Cache-Control", iterations,
+			"no-cache, no-store, max-age=0, must-revalidate" );
+
+	{
+		const auto cookie_parser = make_cookie_parser();
+		const string_view_t cookie{
+				"_ga=GA1.2.1183946213.1600000000; "
+				"_gid=GA1.2.1028473621.1602000000; "
+				"session_id=\"0f3c9a7e2b5d4c1a8e6f\"; "
+				"theme=dark; lang=en-US; "
+				"csrftoken=Xk2mP9qR4tV7wY1zA3bC5dE8fG0hJ6kL" };
+
+		if( !easy_parser::try_parse( cookie, cookie_parser ) )
+		{
+			fmt::print( "Cookie: unable to parse\n" );
+			return 1;
+		}
+
+		run_microbench( "Cookie", iterations,
+			[&] {
+				microbench_consume(
+						easy_parser::try_parse( cookie, cookie_parser )->size() );
+			} );
+	}
+
+	return 0;
+}
@@ -0,0 +1,467 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for incoming body sinks.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+#include <atomic>
+#include <thread>
+
+class collecting_sink_t final : public restinio::incoming_body::sink_t
+{
+	restinio::incoming_body::resumer_t m_resumer;
+	const bool m_pause_on_every_chunk;
+
+public:
+	std::string m_data;
+	std::size_t m_chunks{};
+	bool m_completed{ false };
+
+	collecting_sink_t(
+		restinio::incoming_body::resumer_t resumer,
+		bool pause_on_every_chunk )
+		:	m_resumer{ std::move(resumer) }
+		,	m_pause_on_every_chunk{ pause_on_every_chunk }
+	{}
+
+	restinio::incoming_body::chunk_handling_result_t
+	on_chunk( restinio::string_view_t chunk ) override
+	{
+		m_data.append( chunk.data(), chunk.size() );
+		++m_chunks;
+
+		if( m_pause_on_every_chunk )
+		{
+			// Resumption will be performed after the return from on_chunk.
+			m_resumer.resume();
+			return restinio::incoming_body::pause_reading();
+		}
+
+		return restinio::incoming_body::continue_reading();
+	}
+
+	void
+	on_complete() override
+	{
+		m_completed = true;
+	}
+
+	void
+	on_interrupted() noexcept override
+	{}
+};
+
+//! A sink that resumes reading only after a delay.
+class slow_sink_t final : public restinio::incoming_body::sink_t
+{
+	restinio::incoming_body::resumer_t m_resumer;
+	const std::chrono::milliseconds m_delay;
+	std::thread m_resumer_thread;
+
+public:
+	std::string m_data;
+
+	slow_sink_t(
+		restinio::incoming_body::resumer_t resumer,
+		std::chrono::milliseconds delay )
+		:	m_resumer{ std::move(resumer) }
+		,	m_delay{ delay }
+	{}
+
+	~slow_sink_t() override
+	{
+		if( m_resumer_thread.joinable() )
+			m_resumer_thread.join();
+	}
+
+	restinio::incoming_body::chunk_handling_result_t
+	on_chunk( restinio::string_view_t chunk ) override
+	{
+		m_data.append( chunk.data(), chunk.size() );
+
+		if( m_resumer_thread.joinable() )
+			m_resumer_thread.join();
+
+		m_resumer_thread = std::thread{ [this] {
+				std::this_thread::sleep_for( m_delay );
+				m_resumer.resume();
+			} };
+
+		return restinio::incoming_body::pause_reading();
+	}
+
+	void
+	on_complete() override
+	{}
+
+	void
+	on_interrupted() noexcept override
+	{}
+};
+
+class sink_factory_t
+{
+	const bool m_pause_on_every_chunk;
+
+public:
+	sink_factory_t( bool pause_on_every_chunk )
+		:	m_pause_on_every_chunk{ pause_on_every_chunk }
+	{}
+
+	restinio::incoming_body::sink_handle_t
+	make_sink(
+		const restinio::http_request_header_t & header,
+		restinio::incoming_body::resumer_t resumer )
+	{
+		// Bodies of requests to /ordinary are accumulated as usual.
+		if( "/ordinary" == header.path() )
+			return {};
+
+		return std::make_shared< collecting_sink_t >(
+				std::move(resumer), m_pause_on_every_chunk );
+	}
+};
+
+struct test_traits_t : public restinio::traits_t<
+		restinio::asio_timer_manager_t,
+		utest_logger_t >
+{
+	using body_sink_factory_t = sink_factory_t;
+};
+
+using http_server_t = restinio::http_server_t< test_traits_t >;
+
+auto
+make_request_handler()
+{
+	return []( auto req ) {
+		auto sink = std::dynamic_pointer_cast< collecting_sink_t >(
+				req->body_sink() );
+
+		std::string resp_body;
+		if( sink )
+		{
+			REQUIRE( sink->m_completed );
+			REQUIRE( req->body().empty() );
+			resp_body = "sink:" + std::to_string( sink->m_chunks ) + ":" +
+					sink->m_data;
+		}
+		else
+			resp_body = "body:" + req->body();
+
+		req->create_response()
+			.append_header( "Server", "RESTinio utest server" )
+			.append_header_date_field()
+			.append_header( "Content-Type", "text/plain; charset=utf-8" )
+			.set_body( std::move(resp_body) )
+			.done();
+
+		return restinio::request_accepted();
+	};
+}
+
+std::string
+create_request( const std::string & target, const std::string & body )
+{
+	return
+		"POST " + target + " HTTP/1.0\r\n"
+		"From: unit-test\r\n"
+		"User-Agent: unit-test\r\n"
+		"Content-Type: application/octet-stream\r\n"
+		"Content-Length: " + std::to_string( body.size() ) + "\r\n"
+		"Connection: close\r\n"
+		"\r\n" +
+		body;
+}
+
+std::string
+make_big_body()
+{
+	std::string body;
+	for( int i = 0; i != 2000; ++i )
+		body += fmt::format( "{:08}|", i );
+
+	return body;
+}
+
+TEST_CASE( "no sink factory" , "[no_factory]" )
+{
+	REQUIRE_THROWS( std::unique_ptr<http_server_t>{
+		new http_server_t{
+				restinio::own_io_context(),
+				[]( auto & settings ){
+					settings
+						.port( utest_default_port() )
+						.address( "127.0.0.1" )
+						.request_handler( make_request_handler() );
+				} }
+	} );
+}
+
+TEST_CASE( "body is passed to sink" , "[sink]" )
+{
+	const bool pause_on_every_chunk = GENERATE( false, true );
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				// Small buffer to get the body in several chunks.
+				.buffer_size( 512u )
+				.body_sink_factory(
+					std::make_shared< sink_factory_t >( pause_on_every_chunk ) )
+				.request_handler( make_request_handler() );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+
+	{
+		const std::string body = "01234567890123456789";
+		REQUIRE_NOTHROW( response = do_request( create_request( "/", body ) ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "sink:1:" + body ) );
+	}
+
+	{
+		const std::string body = make_big_body();
+		REQUIRE_NOTHROW( response = do_request( create_request( "/", body ) ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::Contains( "sink:" ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( ":" + body ) );
+		REQUIRE_THAT( response,
+				!Catch::Matchers::Contains( "sink:1:" ) );
+	}
+
+	{
+		const std::string body = make_big_body();
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/ordinary", body ) ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "body:" + body ) );
+	}
+
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				"POST / HTTP/1.1\r\n"
+				"Host: 127.0.0.1\r\n"
+				"Transfer-Encoding: chunked\r\n"
+				"Connection: close\r\n"
+				"\r\n"
+				"5\r\n"
+				"Hello\r\n"
+				"7\r\n"
+				", World\r\n"
+				"0\r\n"
+				"\r\n" ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( ":Hello, World" ) );
+	}
+
+	other_thread.stop_and_join();
+}
+
+TEST_CASE( "pipelined requests with sinks" , "[sink][pipelining]" )
+{
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.max_pipelined_requests( 4 )
+				.body_sink_factory( std::make_shared< sink_factory_t >( true ) )
+				.request_handler( make_request_handler() );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request(
+			"POST / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Length: 3\r\n"
+			"\r\n"
+			"abc"
+			"POST /ordinary HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Length: 3\r\n"
+			"\r\n"
+			"def"
+			"POST / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Length: 3\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"ghi" ) );
+
+	REQUIRE_THAT( response, Catch::Matchers::Contains( "sink:1:abc" ) );
+	REQUIRE_THAT( response, Catch::Matchers::Contains( "body:def" ) );
+	REQUIRE_THAT( response, Catch::Matchers::EndsWith( "sink:1:ghi" ) );
+
+	other_thread.stop_and_join();
+}
+
+struct slow_sink_factory_t
+{
+	restinio::incoming_body::sink_handle_t
+	make_sink(
+		const restinio::http_request_header_t &,
+		restinio::incoming_body::resumer_t resumer )
+	{
+		return std::make_shared< slow_sink_t >(
+				std::move(resumer), std::chrono::milliseconds{ 300 } );
+	}
+};
+
+struct slow_sink_traits_t : public restinio::traits_t<
+		restinio::asio_timer_manager_t,
+		utest_logger_t >
+{
+	using body_sink_factory_t = slow_sink_factory_t;
+};
+
+TEST_CASE( "read timeout is suspended while sink pauses reading" ,
+		"[sink][timeout]" )
+{
+	using slow_http_server_t = restinio::http_server_t< slow_sink_traits_t >;
+
+	slow_http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.read_next_http_message_timelimit(
+						std::chrono::milliseconds{ 200 } )
+				.timer_manager( std::chrono::milliseconds{ 10 } )
+				.body_sink_factory( std::make_shared< slow_sink_factory_t >() )
+				.request_handler( []( auto req ) {
+					auto sink = std::dynamic_pointer_cast< slow_sink_t >(
+							req->body_sink() );
+					REQUIRE( sink );
+
+					req->create_response()
+						.set_body( "sink:" + sink->m_data )
+						.done();
+
+					return restinio::request_accepted();
+				} );
+		} };
+
+	other_work_thread_for_server_t<slow_http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	// The whole request arrives in one chunk, but the sink holds the
+	// reading longer than the read timeout.
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request( create_request( "/", "abc" ) ) );
+
+	REQUIRE_THAT( response, Catch::Matchers::EndsWith( "sink:abc" ) );
+
+	other_thread.stop_and_join();
+}
+
+//! A sink that never resumes the paused reading.
+class stuck_sink_t final : public restinio::incoming_body::sink_t
+{
+	std::atomic< bool > & m_interrupted;
+
+public:
+	stuck_sink_t( std::atomic< bool > & interrupted )
+		:	m_interrupted{ interrupted }
+	{}
+
+	restinio::incoming_body::chunk_handling_result_t
+	on_chunk( restinio::string_view_t ) override
+	{
+		return restinio::incoming_body::pause_reading();
+	}
+
+	void
+	on_complete() override
+	{}
+
+	void
+	on_interrupted() noexcept override
+	{
+		m_interrupted = true;
+	}
+};
+
+struct stuck_sink_factory_t
+{
+	std::atomic< bool > m_interrupted{ false };
+
+	restinio::incoming_body::sink_handle_t
+	make_sink(
+		const restinio::http_request_header_t &,
+		restinio::incoming_body::resumer_t )
+	{
+		return std::make_shared< stuck_sink_t >( m_interrupted );
+	}
+};
+
+struct stuck_sink_traits_t : public restinio::traits_t<
+		restinio::asio_timer_manager_t,
+		utest_logger_t >
+{
+	using body_sink_factory_t = stuck_sink_factory_t;
+};
+
+TEST_CASE( "connection is closed if sink doesn't resume reading" ,
+		"[sink][timeout]" )
+{
+	using stuck_http_server_t = restinio::http_server_t< stuck_sink_traits_t >;
+
+	auto factory = std::make_shared< stuck_sink_factory_t >();
+
+	stuck_http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.paused_body_reading_timelimit(
+						std::chrono::milliseconds{ 200 } )
+				.timer_manager( std::chrono::milliseconds{ 10 } )
+				.body_sink_factory( factory )
+				.request_handler( []( auto ) {
+					return restinio::request_rejected();
+				} );
+		} };
+
+	other_work_thread_for_server_t<stuck_http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	do_with_socket( []( auto & socket, auto & /*io_context*/ ) {
+			restinio::asio_ns::write( socket,
+					restinio::asio_ns::buffer( create_request( "/", "abc" ) ) );
+
+			// Nothing is sent, the connection is just closed.
+			std::array< char, 64 > buf;
+			restinio::asio_ns::error_code error;
+			const auto n = socket.read_some(
+					restinio::asio_ns::buffer( buf ), error );
+			REQUIRE( 0u == n );
+			REQUIRE( restinio::error_is_eof( error ) );
+		} );
+
+	REQUIRE( factory->m_interrupted );
+
+	other_thread.stop_and_join();
+}
@@ -4,14 +4,20 @@ require 'mxx_ru/cpp'
 MxxRu::Cpp::composite_target {
 
 	%w[
+		body_sink
 		chunked_output
+		date_field
 		echo_body
+		incoming_msg_limits
 		method
 		notificators
 		output_and_buffers
 		remote_endpoint
 		connection_state
 		ip_blocker
+		connection_limit
+		release_idle_buffers
+		pre_handler
 		slow_transmit
 		throw_exception
 		timeouts
@@ -0,0 +1,218 @@
+/*
+	restinio
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+namespace
+{
+
+using socket_t = restinio::asio_ns::ip::tcp::socket;
+
+const char * const keep_alive_request_str =
+	"GET / HTTP/1.1\r\n"
+	"Host: 127.0.0.1\r\n"
+	"User-Agent: unit-test\r\n"
+	"Accept: */*\r\n"
+	"Connection: keep-alive\r\n"
+	"\r\n";
+
+void
+connect( socket_t & socket )
+{
+	socket.connect(
+		restinio::asio_ns::ip::tcp::endpoint{
+			restinio::asio_ns::ip::make_address( "127.0.0.1" ),
+			utest_default_port() } );
+}
+
+std::string
+send_request_and_read_response( socket_t & socket )
+{
+	restinio::asio_ns::write(
+		socket,
+		restinio::asio_ns::buffer(
+			keep_alive_request_str, std::strlen( keep_alive_request_str ) ) );
+
+	restinio::asio_ns::streambuf response_stream;
+	restinio::asio_ns::read_until( socket, response_stream, "\r\n\r\n" );
+
+	std::ostringstream sout;
+	sout << &response_stream;
+	return sout.str();
+}
+
+template< typename Predicate >
+bool
+wait_for( Predicate && predicate )
+{
+	for( int i = 0; i != 500; ++i )
+	{
+		if( predicate() )
+			return true;
+		std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+	}
+
+	return predicate();
+}
+
+} /* namespace anonymous */
+
+TEST_CASE( "no limit by default" , "[connection_limit][no_limit]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.request_handler(
+					[]( auto req ){
+						return req->create_response()
+							.set_body( "OK" )
+							.done();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	restinio::asio_ns::io_context io_context;
+	std::vector< std::unique_ptr< socket_t > > sockets;
+	for( int i = 0; i != 8; ++i )
+	{
+		sockets.emplace_back( new socket_t{ io_context } );
+		REQUIRE_NOTHROW( connect( *sockets.back() ) );
+		REQUIRE_THAT( send_request_and_read_response( *sockets.back() ),
+				Catch::Matchers::StartsWith( "HTTP/1.1 200 OK" ) );
+	}
+
+	REQUIRE( 8u == http_server.connections_count() );
+	REQUIRE_FALSE( http_server.is_accept_paused() );
+
+	sockets.clear();
+
+	REQUIRE( wait_for( [&]{ return 0u == http_server.connections_count(); } ) );
+
+	other_thread.stop_and_join();
+}
+
+TEST_CASE( "accept is paused and resumed" , "[connection_limit][pause]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.concurrent_accepts_count( 2 )
+				.max_connections( 2 )
+				.request_handler(
+					[]( auto req ){
+						return req->create_response()
+							.set_body( "OK" )
+							.done();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	restinio::asio_ns::io_context io_context;
+
+	socket_t first{ io_context };
+	socket_t second{ io_context };
+	socket_t third{ io_context };
+
+	REQUIRE_NOTHROW( connect( first ) );
+	REQUIRE_THAT( send_request_and_read_response( first ),
+			Catch::Matchers::StartsWith( "HTTP/1.1 200 OK" ) );
+	REQUIRE_NOTHROW( connect( second ) );
+	REQUIRE_THAT( send_request_and_read_response( second ),
+			Catch::Matchers::StartsWith( "HTTP/1.1 200 OK" ) );
+
+	REQUIRE( 2u == http_server.connections_count() );
+	REQUIRE( wait_for( [&]{ return http_server.is_accept_paused(); } ) );
+
+	// The connection is established by OS but isn't accepted by the server.
+	REQUIRE_NOTHROW( connect( third ) );
+	REQUIRE_NOTHROW( restinio::asio_ns::write(
+		third,
+		restinio::asio_ns::buffer(
+			keep_alive_request_str, std::strlen( keep_alive_request_str ) ) ) );
+
+	std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+	REQUIRE( 2u == http_server.connections_count() );
+
+	first.close();
+
+	restinio::asio_ns::streambuf response_stream;
+	REQUIRE_NOTHROW( restinio::asio_ns::read_until(
+			third, response_stream, "\r\n\r\n" ) );
+	{
+		std::ostringstream sout;
+		sout << &response_stream;
+		REQUIRE_THAT( sout.str(),
+				Catch::Matchers::StartsWith( "HTTP/1.1 200 OK" ) );
+	}
+
+	REQUIRE( 2u == http_server.connections_count() );
+	REQUIRE( wait_for( [&]{ return http_server.is_accept_paused(); } ) );
+
+	second.close();
+	third.close();
+
+	REQUIRE( wait_for( [&]{ return 0u == http_server.connections_count(); } ) );
+	REQUIRE( wait_for( [&]{ return !http_server.is_accept_paused(); } ) );
+
+	other_thread.stop_and_join();
+}
+
+TEST_CASE( "throwing resume callback" , "[connection_limit][limiter]" )
+{
+	using namespace restinio::impl;
+
+	auto limiter = std::make_shared< connection_count_limiter_t >( 1u, 1u );
+
+	REQUIRE( limiter->try_start_accept( 0u ) );
+	auto guard = std::make_unique< connection_lifetime_guard_t >(
+			limiter->accepted() );
+	REQUIRE_FALSE( limiter->try_start_accept( 0u ) );
+
+	limiter->resume_accept_callback( []( std::size_t ) {
+			throw std::runtime_error{ "can't resume" };
+		} );
+
+	// The exception doesn't leave the destructor, the slot remains paused.
+	guard.reset();
+	REQUIRE( 0u == limiter->connections_count() );
+	REQUIRE( limiter->is_accept_paused() );
+
+	std::size_t resumed = 1000u;
+	limiter->resume_accept_callback( [&resumed]( std::size_t slot ) {
+			resumed = slot;
+		} );
+
+	// The place isn't held by the failed resume.
+	REQUIRE( limiter->try_start_accept( 1u ) );
+	limiter->accept_failed();
+	REQUIRE( 0u == resumed );
+	REQUIRE_FALSE( limiter->is_accept_paused() );
+}
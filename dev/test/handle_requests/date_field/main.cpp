@@ -0,0 +1,161 @@
+/*
+	restinio
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+namespace
+{
+
+const char * const request_str =
+	"GET / HTTP/1.1\r\n"
+	"Host: 127.0.0.1\r\n"
+	"User-Agent: unit-test\r\n"
+	"Connection: close\r\n"
+	"\r\n";
+
+std::size_t
+count_date_fields( const std::string & response )
+{
+	std::size_t result = 0u;
+	for( auto pos = response.find( "\r\nDate: " );
+			std::string::npos != pos;
+			pos = response.find( "\r\nDate: ", pos + 1u ) )
+		++result;
+
+	return result;
+}
+
+using http_server_t =
+	restinio::http_server_t<
+		restinio::traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t > >;
+
+} /* namespace anonymous */
+
+TEST_CASE( "cached date field value" , "[date_field][cache]" )
+{
+	const std::time_t t = 1600000000;
+
+	const auto & value = restinio::impl::cached_date_field_value( t );
+	REQUIRE( "Sun, 13 Sep 2020 12:26:40 GMT" == value );
+	REQUIRE( restinio::make_date_field_value( t ) == value );
+
+	REQUIRE( &value == &restinio::impl::cached_date_field_value( t ) );
+
+	REQUIRE( "Sun, 13 Sep 2020 12:26:41 GMT" ==
+			restinio::impl::cached_date_field_value( t + 1 ) );
+}
+
+TEST_CASE( "create_header_string adds date field" , "[date_field][header]" )
+{
+	using namespace restinio::impl;
+
+	restinio::http_response_header_t header{ restinio::status_ok() };
+	header.set_field( "Server", "RESTinio" );
+
+	REQUIRE( 0u == count_date_fields( create_header_string( header ) ) );
+
+	const auto with_date = create_header_string(
+			header,
+			content_length_field_presence_t::add_content_length,
+			0u,
+			date_field_presence_t::add_if_absent );
+	REQUIRE( 1u == count_date_fields( with_date ) );
+	REQUIRE_THAT( with_date, Catch::Matchers::EndsWith(
+			" GMT\r\nServer: RESTinio\r\n\r\n" ) );
+
+	header.set_field( restinio::http_field::date, "Thu, 01 Jan 1970 00:00:00 GMT" );
+	const auto user_date = create_header_string(
+			header,
+			content_length_field_presence_t::add_content_length,
+			0u,
+			date_field_presence_t::add_if_absent );
+	REQUIRE( 1u == count_date_fields( user_date ) );
+	REQUIRE_THAT( user_date, Catch::Matchers::Contains(
+			"Date: Thu, 01 Jan 1970 00:00:00 GMT\r\n" ) );
+}
+
+TEST_CASE( "no date field by default" , "[date_field][default]" )
+{
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.request_handler(
+					[]( auto req ){
+						return req->create_response()
+							.set_body( "OK" )
+							.done();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request( request_str ) );
+	REQUIRE( 0u == count_date_fields( response ) );
+
+	other_thread.stop_and_join();
+}
+
+TEST_CASE( "date field is always added" , "[date_field][always]" )
+{
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.always_add_date_field( true )
+				.request_handler(
+					[]( auto req ){
+						if( "/user_date" == req->header().path() )
+							return req->create_response()
+								.append_header_date_field()
+								.set_body( "user date" )
+								.done();
+
+						if( "/chunked" == req->header().path() )
+							return req->template create_response<
+										restinio::chunked_output_t >()
+								.append_chunk( "chunked" )
+								.done();
+
+						return req->create_response()
+							.set_body( "OK" )
+							.done();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	for( const char * path : { "/", "/user_date", "/chunked" } )
+	{
+		const auto request = fmt::format(
+				"GET {} HTTP/1.1\r\n"
+				"Host: 127.0.0.1\r\n"
+				"User-Agent: unit-test\r\n"
+				"Connection: close\r\n"
+				"\r\n",
+				path );
+
+		std::string response;
+		REQUIRE_NOTHROW( response = do_request( request ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::StartsWith( "HTTP/1.1 200 OK\r\n" ) );
+		REQUIRE( 1u == count_date_fields( response ) );
+	}
+
+	other_thread.stop_and_join();
+}
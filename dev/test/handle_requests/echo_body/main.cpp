@@ -102,3 +102,93 @@ TEST_CASE( "HTTP echo server" , "[echo]" )
 
 	other_thread.stop_and_join();
 }
+
+struct arena_traits_t : public restinio::traits_t<
+		restinio::asio_timer_manager_t,
+		utest_logger_t >
+{
+	using incoming_header_storage_t =
+			restinio::incoming_header_storage::arena_views_t;
+};
+
+TEST_CASE( "HTTP echo server with header fields in arena" , "[echo][arena]" )
+{
+	using http_server_t = restinio::http_server_t< arena_traits_t >;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				// Small buffer to get fields split between several reads.
+				.buffer_size( 16u )
+				.request_handler(
+					[]( auto req ){
+						std::string fields;
+						req->header().for_each_field_view(
+							[&]( restinio::string_view_t n, restinio::string_view_t v ) {
+								fields.append( n.data(), n.size() );
+								fields += '=';
+								fields.append( v.data(), v.size() );
+								fields += ';';
+							} );
+
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body(
+								fields + "|" +
+								req->header().get_field_or(
+										"X-Unknown", "unknown" ) + "|" +
+								req->body() )
+							.done();
+						return restinio::request_accepted();
+					} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	{
+		std::string response;
+		REQUIRE_NOTHROW( response = do_request(
+				"POST /data HTTP/1.0\r\n"
+				"From: unit-test\r\n"
+				"User-Agent: unit-test-with-a-very-long-value\r\n"
+				"Content-Length: 5\r\n"
+				"Connection: close\r\n"
+				"\r\n"
+				"Hello" ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith(
+				"From=unit-test;"
+				"User-Agent=unit-test-with-a-very-long-value;"
+				"Content-Length=5;"
+				"Connection=close;"
+				"|unknown|Hello" ) );
+	}
+
+	{
+		std::string response;
+		REQUIRE_NOTHROW( response = do_request(
+				"POST /data HTTP/1.1\r\n"
+				"Host: 127.0.0.1\r\n"
+				"Transfer-Encoding: chunked\r\n"
+				"Connection: close\r\n"
+				"\r\n"
+				"5\r\n"
+				"Hello\r\n"
+				"0\r\n"
+				"\r\n" ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith(
+				"Host=127.0.0.1;"
+				"Transfer-Encoding=chunked;"
+				"Connection=close;"
+				"|unknown|Hello" ) );
+	}
+
+	other_thread.stop_and_join();
+}
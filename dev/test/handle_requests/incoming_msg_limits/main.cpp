@@ -0,0 +1,149 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for limits of incoming HTTP messages.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using http_server_t =
+	restinio::http_server_t<
+		restinio::traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t > >;
+
+std::string
+create_request(
+	const std::string & target,
+	const std::string & extra_headers,
+	const std::string & body )
+{
+	return
+		"POST " + target + " HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"Content-Length: " + std::to_string( body.size() ) + "\r\n" +
+		extra_headers +
+		"Connection: close\r\n"
+		"\r\n" +
+		body;
+}
+
+TEST_CASE( "limits for incoming messages" , "[limits]" )
+{
+	auto stats = std::make_shared< restinio::incoming_http_msg_limits_stats_t >();
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[stats]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.incoming_http_msg_limits(
+					restinio::incoming_http_msg_limits_t{}
+						.max_url_size( 32u )
+						.max_field_name_size( 24u )
+						.max_field_value_size( 64u )
+						.max_field_count( 8u )
+						.max_body_size( 100u ) )
+				.incoming_http_msg_limits_stats( stats )
+				.request_handler( []( auto req ){
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.set_body( "body:" + req->body() )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+
+	SECTION( "within limits" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/", "X-Field: value\r\n",
+						std::string( 100u, 'a' ) ) ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::EndsWith( "body:" + std::string( 100u, 'a' ) ) );
+	}
+
+	SECTION( "url too long" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/" + std::string( 32u, 'u' ), "", "" ) ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::StartsWith( "HTTP/1.1 414 URI Too Long" ) );
+		REQUIRE( 1u == stats->url_too_long() );
+	}
+
+	SECTION( "field name too long" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/",
+						"X-" + std::string( 23u, 'f' ) + ": value\r\n", "" ) ) );
+		REQUIRE_THAT( response, Catch::Matchers::StartsWith(
+				"HTTP/1.1 431 Request Header Fields Too Large" ) );
+		REQUIRE( 1u == stats->header_fields_too_large() );
+	}
+
+	SECTION( "field value too long" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/",
+						"X-Field: " + std::string( 65u, 'v' ) + "\r\n", "" ) ) );
+		REQUIRE_THAT( response, Catch::Matchers::StartsWith(
+				"HTTP/1.1 431 Request Header Fields Too Large" ) );
+		REQUIRE( 1u == stats->header_fields_too_large() );
+	}
+
+	SECTION( "too many fields" )
+	{
+		std::string fields;
+		for( int i = 0; i != 8; ++i )
+			fields += fmt::format( "X-Field-{}: value\r\n", i );
+
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/", fields, "" ) ) );
+		REQUIRE_THAT( response, Catch::Matchers::StartsWith(
+				"HTTP/1.1 431 Request Header Fields Too Large" ) );
+		REQUIRE( 1u == stats->header_fields_too_large() );
+	}
+
+	SECTION( "body too large" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/", "", std::string( 101u, 'a' ) ) ) );
+		REQUIRE_THAT( response, Catch::Matchers::StartsWith(
+				"HTTP/1.1 413 Payload Too Large" ) );
+		REQUIRE( 1u == stats->body_too_large() );
+	}
+
+	SECTION( "chunked body too large" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				"POST / HTTP/1.1\r\n"
+				"Host: 127.0.0.1\r\n"
+				"Transfer-Encoding: chunked\r\n"
+				"Connection: close\r\n"
+				"\r\n"
+				"40\r\n" + std::string( 64u, 'a' ) + "\r\n"
+				"40\r\n" + std::string( 64u, 'b' ) + "\r\n"
+				"0\r\n"
+				"\r\n" ) );
+		REQUIRE_THAT( response, Catch::Matchers::StartsWith(
+				"HTTP/1.1 413 Payload Too Large" ) );
+		REQUIRE( 1u == stats->body_too_large() );
+	}
+
+	other_thread.stop_and_join();
+}
@@ -0,0 +1,250 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for pre-handlers of incoming requests.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+class pre_handler_t
+{
+public:
+	restinio::pre_handler::verdict_t
+	on_headers_complete(
+		const restinio::pre_handler::incoming_info_t & info )
+	{
+		const auto & header = info.header();
+
+		if( const auto expect = header.opt_value_of(
+				restinio::http_field::expect ) )
+		{
+			if( "100-continue" != *expect )
+				return restinio::pre_handler::reject(
+						restinio::status_expectation_failed() );
+		}
+
+		if( "/protected" == header.path() &&
+			!header.has_field( restinio::http_field::authorization ) )
+			return restinio::pre_handler::reject(
+					restinio::status_unauthorized() );
+
+		if( "/discard" == header.path() )
+			return restinio::pre_handler::accept(
+					restinio::pre_handler::body_policy_t::discard );
+
+		return restinio::pre_handler::accept();
+	}
+};
+
+struct test_traits_t : public restinio::traits_t<
+		restinio::asio_timer_manager_t,
+		utest_logger_t >
+{
+	using pre_handler_t = ::pre_handler_t;
+};
+
+using http_server_t = restinio::http_server_t< test_traits_t >;
+
+std::string
+create_request(
+	const std::string & target,
+	const std::string & extra_headers,
+	const std::string & body )
+{
+	return
+		"POST " + target + " HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"Content-Type: application/octet-stream\r\n"
+		"Content-Length: " + std::to_string( body.size() ) + "\r\n" +
+		extra_headers +
+		"Connection: close\r\n"
+		"\r\n" +
+		body;
+}
+
+TEST_CASE( "no pre-handler" , "[no_pre_handler]" )
+{
+	REQUIRE_THROWS( std::unique_ptr<http_server_t>{
+		new http_server_t{
+				restinio::own_io_context(),
+				[]( auto & settings ){
+					settings
+						.port( utest_default_port() )
+						.address( "127.0.0.1" )
+						.request_handler( []( auto ){
+								return restinio::request_rejected();
+							} );
+				} }
+	} );
+}
+
+TEST_CASE( "pre-handler verdicts" , "[pre_handler]" )
+{
+	std::atomic< int > handler_calls{ 0 };
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&handler_calls]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.max_pipelined_requests( 4 )
+				.pre_handler( std::make_shared< pre_handler_t >() )
+				.request_handler( [&handler_calls]( auto req ){
+						++handler_calls;
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header_date_field()
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body( "body:" + req->body() )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+
+	SECTION( "accepted" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/", "", "0123456789" ) ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "body:0123456789" ) );
+		REQUIRE( 1 == handler_calls );
+
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/protected",
+						"Authorization: Basic dXNlcjoxMjM0NQ==\r\n",
+						"0123456789" ) ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "body:0123456789" ) );
+		REQUIRE( 2 == handler_calls );
+	}
+
+	SECTION( "rejected" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/protected", "", "0123456789" ) ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::StartsWith( "HTTP/1.1 401 Unauthorized" ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::Contains( "Connection: close" ) );
+		REQUIRE( 0 == handler_calls );
+
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/", "Expect: something-strange\r\n", "0123" ) ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::StartsWith( "HTTP/1.1 417 Expectation Failed" ) );
+		REQUIRE( 0 == handler_calls );
+	}
+
+	SECTION( "discarded body" )
+	{
+		REQUIRE_NOTHROW( response = do_request(
+				create_request( "/discard", "", "0123456789" ) ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "body:" ) );
+		REQUIRE( 1 == handler_calls );
+	}
+
+	SECTION( "100-continue" )
+	{
+		const std::string body = "0123456789";
+		const std::string headers =
+			"POST / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Length: " + std::to_string( body.size() ) + "\r\n"
+			"Expect: 100-continue\r\n"
+			"Connection: close\r\n"
+			"\r\n";
+
+		std::string interim_response;
+		REQUIRE_NOTHROW( do_with_socket(
+			[&]( auto & socket, auto & /*io_context*/ ){
+				restinio::asio_ns::write(
+						socket, restinio::asio_ns::buffer( headers ) );
+
+				restinio::asio_ns::streambuf interim;
+				restinio::asio_ns::read_until( socket, interim, "\r\n\r\n" );
+				interim_response.assign(
+						restinio::asio_ns::buffers_begin( interim.data() ),
+						restinio::asio_ns::buffers_end( interim.data() ) );
+
+				restinio::asio_ns::write(
+						socket, restinio::asio_ns::buffer( body ) );
+
+				restinio::asio_ns::streambuf final_response;
+				restinio::asio_ns::error_code error;
+				restinio::asio_ns::read( socket, final_response, error );
+				response.assign(
+						restinio::asio_ns::buffers_begin( final_response.data() ),
+						restinio::asio_ns::buffers_end( final_response.data() ) );
+			} ) );
+
+		REQUIRE( "HTTP/1.1 100 Continue\r\n\r\n" == interim_response );
+		REQUIRE_THAT( response,
+				Catch::Matchers::StartsWith( "HTTP/1.1 200 OK" ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "body:" + body ) );
+		REQUIRE( 1 == handler_calls );
+	}
+
+	SECTION( "100-continue after pipelined request" )
+	{
+		const std::string body = "0123456789";
+		const std::string requests =
+			"POST / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Length: 3\r\n"
+			"\r\n"
+			"abc"
+			"POST / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Length: " + std::to_string( body.size() ) + "\r\n"
+			"Expect: 100-continue\r\n"
+			"Connection: close\r\n"
+			"\r\n";
+
+		std::string first_response;
+		REQUIRE_NOTHROW( do_with_socket(
+			[&]( auto & socket, auto & /*io_context*/ ){
+				restinio::asio_ns::write(
+						socket, restinio::asio_ns::buffer( requests ) );
+
+				// The interim response must follow the response
+				// to the first request.
+				restinio::asio_ns::streambuf interim;
+				restinio::asio_ns::read_until(
+						socket, interim, "HTTP/1.1 100 Continue\r\n\r\n" );
+				first_response.assign(
+						restinio::asio_ns::buffers_begin( interim.data() ),
+						restinio::asio_ns::buffers_end( interim.data() ) );
+
+				restinio::asio_ns::write(
+						socket, restinio::asio_ns::buffer( body ) );
+
+				restinio::asio_ns::streambuf final_response;
+				restinio::asio_ns::error_code error;
+				restinio::asio_ns::read( socket, final_response, error );
+				response.assign(
+						restinio::asio_ns::buffers_begin( final_response.data() ),
+						restinio::asio_ns::buffers_end( final_response.data() ) );
+			} ) );
+
+		REQUIRE_THAT( first_response,
+				Catch::Matchers::StartsWith( "HTTP/1.1 200 OK" ) );
+		REQUIRE_THAT( first_response, Catch::Matchers::EndsWith(
+				"body:abcHTTP/1.1 100 Continue\r\n\r\n" ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "body:" + body ) );
+		REQUIRE( 2 == handler_calls );
+	}
+
+	other_thread.stop_and_join();
+}
@@ -0,0 +1,227 @@
+/*
+	restinio
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+namespace
+{
+
+using socket_t = restinio::asio_ns::ip::tcp::socket;
+
+std::string
+make_request( const std::string & body )
+{
+	return fmt::format(
+			"POST /data HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"User-Agent: unit-test\r\n"
+			"Content-Length: {}\r\n"
+			"Connection: keep-alive\r\n"
+			"\r\n"
+			"{}",
+			body.size(),
+			body );
+}
+
+//! Read a response with Content-Length and return its body.
+std::string
+read_response_body(
+	socket_t & socket,
+	restinio::asio_ns::streambuf & stream )
+{
+	restinio::asio_ns::read_until( socket, stream, "\r\n\r\n" );
+
+	const std::string data{
+			restinio::asio_ns::buffers_begin( stream.data() ),
+			restinio::asio_ns::buffers_end( stream.data() ) };
+
+	const auto header_end = data.find( "\r\n\r\n" ) + 4u;
+	const std::string header = data.substr( 0u, header_end );
+	stream.consume( header_end );
+
+	const std::string content_length_field{ "Content-Length: " };
+	const auto pos = header.find( content_length_field );
+	REQUIRE( std::string::npos != pos );
+	const auto body_size = static_cast< std::size_t >( std::stoul(
+			header.substr( pos + content_length_field.size() ) ) );
+
+	if( stream.size() < body_size )
+		restinio::asio_ns::read(
+				socket,
+				stream,
+				restinio::asio_ns::transfer_exactly( body_size - stream.size() ) );
+
+	const std::string body{
+			restinio::asio_ns::buffers_begin( stream.data() ),
+			restinio::asio_ns::buffers_begin( stream.data() ) +
+				static_cast< std::ptrdiff_t >( body_size ) };
+	stream.consume( body_size );
+
+	return body;
+}
+
+auto
+make_echo_server_settings_setter()
+{
+	return []( auto & settings ){
+		settings
+			.port( utest_default_port() )
+			.address( "127.0.0.1" )
+			.buffer_size( 16u * 1024u )
+			.max_pipelined_requests( 8u )
+			.release_idle_input_buffers( true )
+			.request_handler(
+				[]( auto req ){
+					return req->create_response()
+						.append_header( "Server", "RESTinio utest server" )
+						.set_body( req->body() )
+						.done();
+				} );
+	};
+}
+
+} /* namespace anonymous */
+
+TEST_CASE( "adaptive buffer size" , "[release_idle_buffers][adaptive_size]" )
+{
+	using restinio::impl::adaptive_buffer_size_t;
+
+	adaptive_buffer_size_t size{ 8u * 1024u };
+	REQUIRE( 1024u == size.current() );
+
+	// Reads that fill the whole buffer make it bigger.
+	size.on_read( 1024u, 1024u );
+	REQUIRE( 2048u == size.current() );
+	size.on_read( 2048u, 2048u );
+	size.on_read( 4096u, 4096u );
+	REQUIRE( 8192u == size.current() );
+	size.on_read( 8192u, 8192u );
+	REQUIRE( 8192u == size.current() );
+
+	// A series of small reads make it smaller.
+	for( unsigned i = 0u;
+			i != adaptive_buffer_size_t::small_reads_to_shrink - 1u; ++i )
+		size.on_read( 8192u, 100u );
+	REQUIRE( 8192u == size.current() );
+	size.on_read( 8192u, 100u );
+	REQUIRE( 4096u == size.current() );
+
+	for( int i = 0; i != 100; ++i )
+		size.on_read( size.current(), 100u );
+	REQUIRE( 1024u == size.current() );
+
+	// Max size less than the default min size.
+	adaptive_buffer_size_t small_size{ 100u };
+	REQUIRE( 100u == small_size.current() );
+	small_size.on_read( 100u, 100u );
+	REQUIRE( 100u == small_size.current() );
+}
+
+TEST_CASE( "buffers cache gives buffers of suitable capacity" ,
+	"[release_idle_buffers][cache]" )
+{
+	using restinio::impl::thread_local_buffers_cache_t;
+
+	auto big = thread_local_buffers_cache_t::acquire( 64u * 1024u );
+	const char * big_data = big.data();
+	thread_local_buffers_cache_t::release( std::move( big ) );
+
+	// A small buffer is requested: the big one isn't used.
+	auto small = thread_local_buffers_cache_t::acquire( 1024u );
+	REQUIRE( 1024u == small.size() );
+	REQUIRE( 2048u >= small.capacity() );
+
+	// The big buffer is still in the cache.
+	auto big_again = thread_local_buffers_cache_t::acquire( 48u * 1024u );
+	REQUIRE( big_data == big_again.data() );
+
+	const char * small_data = small.data();
+	thread_local_buffers_cache_t::release( std::move( small ) );
+	thread_local_buffers_cache_t::release( std::move( big_again ) );
+
+	// The best fit is used.
+	auto small_again = thread_local_buffers_cache_t::acquire( 1000u );
+	REQUIRE( small_data == small_again.data() );
+	thread_local_buffers_cache_t::release( std::move( small_again ) );
+}
+
+TEST_CASE( "keep-alive requests of different sizes" ,
+	"[release_idle_buffers][keep_alive]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		make_echo_server_settings_setter() };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	do_with_socket( [&]( auto & socket, auto & /*io_context*/ ){
+		restinio::asio_ns::streambuf stream;
+
+		for( const std::size_t body_size :
+				{ 10u, 100u, 5000u, 100000u, 10u, 70000u, 0u, 1u } )
+		{
+			std::string body( body_size, 'x' );
+			for( std::size_t i = 0u; i != body_size; ++i )
+				body[ i ] = static_cast< char >( 'a' + i % 26u );
+
+			restinio::asio_ns::write(
+					socket, restinio::asio_ns::buffer( make_request( body ) ) );
+
+			REQUIRE( body == read_response_body( socket, stream ) );
+
+			// Let the connection become idle.
+			std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+		}
+	} );
+
+	other_thread.stop_and_join();
+}
+
+TEST_CASE( "pipelined requests" , "[release_idle_buffers][pipelining]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		make_echo_server_settings_setter() };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	do_with_socket( [&]( auto & socket, auto & /*io_context*/ ){
+		std::vector< std::string > bodies;
+		std::string requests;
+		for( std::size_t i = 0u; i != 8u; ++i )
+		{
+			bodies.push_back( fmt::format( "{}-{}",
+					i, std::string( i * 997u, 'p' ) ) );
+			requests += make_request( bodies.back() );
+		}
+
+		restinio::asio_ns::write(
+				socket, restinio::asio_ns::buffer( requests ) );
+
+		restinio::asio_ns::streambuf stream;
+		for( const auto & body : bodies )
+			REQUIRE( body == read_response_body( socket, stream ) );
+	} );
+
+	other_thread.stop_and_join();
+}
@@ -13,6 +13,9 @@
 #include <test/common/utest_logger.hpp>
 #include <test/common/pub.hpp>
 
+#include <atomic>
+#include <thread>
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic ignored "-Wparentheses"
 #endif
@@ -189,3 +192,220 @@ TEST_CASE( "Timeout on handling request" , "[timeout][handle_request]" )
 	other_thread.stop_and_join();
 	req_to_store.reset();
 }
+
+TEST_CASE( "Timeout on reading requests with timing wheel" ,
+		"[timeout][read][timing_wheel]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::timing_wheel_timer_manager_t,
+				utest_logger_t > >;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.timer_manager( std::chrono::milliseconds( 4 ) )
+				.read_next_http_message_timelimit( std::chrono::milliseconds( 5 ) )
+				.request_handler( []( auto ){
+					return restinio::request_rejected();
+				} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	// Nodes of the wheel are reused by subsequent connections.
+	for( int i = 0; i != 3; ++i )
+	{
+		do_with_socket( [ & ]( auto & socket, auto & /*io_context*/ ){
+
+			const std::string a_part_of_request{ "GET / HTT" };
+
+			REQUIRE_NOTHROW(
+				restinio::asio_ns::write( socket, restinio::asio_ns::buffer( a_part_of_request ) )
+				);
+
+			const auto started_at = std::chrono::steady_clock::now();
+
+			std::array< char, 64 > data{};
+			restinio::asio_ns::error_code error;
+
+			size_t length =
+				restinio::asio_ns::read( socket, restinio::asio_ns::buffer(data), error );
+
+			REQUIRE( 0 == length );
+			REQUIRE( error == restinio::asio_ns::error::eof );
+			// The connection should be closed long before
+			// the default check period (1s).
+			REQUIRE( std::chrono::steady_clock::now() - started_at <
+					std::chrono::milliseconds( 500 ) );
+		} );
+	}
+
+	other_thread.stop_and_join();
+}
+
+TEST_CASE( "Timeout on handling request with timing wheel" ,
+		"[timeout][handle_request][timing_wheel]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::single_thread_traits_t<
+				restinio::single_threaded_timing_wheel_timer_manager_t,
+				utest_logger_t > >;
+
+	restinio::request_handle_t req_to_store;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[ & ]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.timer_manager( std::chrono::milliseconds( 4 ), 2u )
+				.handle_request_timeout( std::chrono::milliseconds( 5 ) )
+				.request_handler( [ & ]( auto req ){
+
+					// Store connection.
+					req_to_store = std::move( req );
+
+					// Signal that request is going to be handled.
+					return restinio::request_accepted();
+				} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	do_with_socket( [ & ]( auto & socket, auto & io_context ){
+
+		const std::string request{
+			"GET / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"User-Agent: unit-test\r\n"
+			"Accept: */*\r\n"
+			"Connection: close\r\n"
+			"\r\n" };
+
+		REQUIRE_NOTHROW(
+			restinio::asio_ns::write( socket, restinio::asio_ns::buffer( request ) )
+			);
+
+		std::array< char, 1024 > data{};
+
+		socket.async_read_some(
+			restinio::asio_ns::buffer( data ),
+			[ & ]( auto ec, std::size_t length ){
+
+				REQUIRE( 0 == length );
+				REQUIRE( ec );
+				REQUIRE( ec == restinio::asio_ns::error::eof );
+			} );
+
+		io_context.run();
+	} );
+
+	other_thread.stop_and_join();
+	req_to_store.reset();
+}
+
+namespace
+{
+
+//! Counters of check_timeout() calls made by the wheel.
+struct check_counters_t
+{
+	std::atomic< int > m_active{ 0 };
+	std::atomic< int > m_max_active{ 0 };
+	std::atomic< int > m_checks{ 0 };
+};
+
+//! A connection that is checked slower than the wheel ticks.
+class slow_connection_t final : public restinio::tcp_connection_ctx_base_t
+{
+	public:
+		slow_connection_t(
+			restinio::connection_id_t id,
+			const restinio::timing_wheel_timer_manager_t & manager,
+			check_counters_t & counters )
+			:	restinio::tcp_connection_ctx_base_t{ id }
+			,	m_guard{ manager.create_timer_guard() }
+			,	m_counters{ counters }
+		{}
+
+		void
+		schedule()
+		{
+			m_guard.schedule( shared_from_this() );
+		}
+
+		void
+		check_timeout(
+			std::shared_ptr< restinio::tcp_connection_ctx_base_t > & ) override
+		{
+			const int active = ++m_counters.m_active;
+			int max_active = m_counters.m_max_active.load();
+			while( active > max_active &&
+				!m_counters.m_max_active.compare_exchange_weak( max_active, active ) )
+			{}
+
+			std::this_thread::sleep_for( std::chrono::milliseconds( 3 ) );
+
+			--m_counters.m_active;
+			++m_counters.m_checks;
+
+			schedule();
+		}
+
+	private:
+		restinio::timing_wheel_timer_manager_t::timer_guard_t m_guard;
+		check_counters_t & m_counters;
+};
+
+} /* namespace anonymous */
+
+TEST_CASE( "Ticks of timing wheel don't overlap on thread pool" ,
+		"[timeout][timing_wheel][thread_pool]" )
+{
+	restinio::asio_ns::io_context io_context;
+	auto work = restinio::asio_ns::make_work_guard( io_context );
+
+	auto manager = restinio::timing_wheel_timer_manager_t::factory_t{
+			std::chrono::milliseconds( 2 ), 2u }.create( io_context );
+
+	check_counters_t counters;
+
+	std::vector< std::shared_ptr< slow_connection_t > > connections;
+	for( restinio::connection_id_t id = 0u; id != 8u; ++id )
+	{
+		connections.push_back( std::make_shared< slow_connection_t >(
+				id, *manager, counters ) );
+		connections.back()->schedule();
+	}
+
+	manager->start();
+
+	std::vector< std::thread > threads;
+	for( int i = 0; i != 4; ++i )
+		threads.emplace_back( [&io_context]{ io_context.run(); } );
+
+	const auto deadline =
+			std::chrono::steady_clock::now() + std::chrono::seconds( 5 );
+	while( counters.m_checks < 50 &&
+			std::chrono::steady_clock::now() < deadline )
+		std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+
+	restinio::asio_ns::post( io_context, [&manager]{ manager->stop(); } );
+	work.reset();
+	for( auto & t : threads )
+		t.join();
+
+	REQUIRE( 50 <= counters.m_checks );
+	REQUIRE( 1 == counters.m_max_active );
+}
@@ -8,8 +8,11 @@
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <cctype>
 #include <iterator>
 #include <set>
+#include <thread>
 
 #include <restinio/all.hpp>
 
@@ -437,6 +440,129 @@ TEST_CASE( "Enumeration of fields" , "[header][fields][for_each]" )
 	REQUIRE( values == std::set< std::string >{
 			"text/plain", "utf-8", "Unknown"
 		} );
+
+	const auto & cfields = fields;
+	const auto noexcept_lambda = [](const auto &) noexcept {};
+	STATIC_REQUIRE( noexcept( cfields.begin() ) );
+	STATIC_REQUIRE( noexcept( cfields.end() ) );
+	STATIC_REQUIRE( noexcept( cfields.fields_count() ) );
+	const restinio::string_view_t server_name{ "Server" };
+	STATIC_REQUIRE( noexcept( cfields.try_get_field( server_name ) ) );
+	STATIC_REQUIRE( noexcept( cfields.try_get_field( http_field::server ) ) );
+	STATIC_REQUIRE( noexcept( cfields.for_each_field( noexcept_lambda ) ) );
+}
+
+TEST_CASE( "Fields stored in arena" , "[header][fields][arena]" )
+{
+	auto arena = std::make_shared< restinio::impl::header_fields_arena_t >();
+
+	// The same sequence as from http-parser's callbacks.
+	arena->start_name( "Content-" );
+	arena->append_name( "Type" );
+	arena->start_value( "text/" );
+	arena->append_value( "plain" );
+	arena->start_name( "X-Custom" );
+	arena->start_value( "first" );
+	arena->start_name( "Server" );
+	arena->start_value( "Unknown" );
+	arena->start_name( "x-custom" );
+	arena->start_value( "second" );
+
+	REQUIRE( 4u == arena->size() );
+	REQUIRE( http_field::content_type == arena->field_id( 0u ) );
+	REQUIRE( http_field::field_unspecified == arena->field_id( 1u ) );
+
+	http_header_fields_t fields;
+	restinio::impl::use_fields_arena_accessor( fields, arena );
+
+	SECTION( "access without conversion" )
+	{
+		REQUIRE( fields.has_field( "content-type" ) );
+		REQUIRE( fields.has_field( http_field::server ) );
+		REQUIRE_FALSE( fields.has_field( http_field::age ) );
+		REQUIRE_FALSE( fields.has_field( "Age" ) );
+
+		REQUIRE( "text/plain" == fields.value_of( http_field::content_type ) );
+		REQUIRE( "Unknown" == fields.value_of( "SERVER" ) );
+		// The last value wins like for set_field().
+		REQUIRE( "second" == fields.value_of( "X-Custom" ) );
+		REQUIRE_THROWS( fields.value_of( "Age" ) );
+		REQUIRE_THROWS( fields.value_of( http_field::age ) );
+
+		REQUIRE_FALSE( fields.opt_value_of( "Age" ) );
+		REQUIRE( "Unknown" == *fields.opt_value_of( http_field::server ) );
+
+		std::vector< std::string > names, values;
+		fields.for_each_field_view( [&]( string_view_t n, string_view_t v ) {
+				names.emplace_back( n.data(), n.size() );
+				values.emplace_back( v.data(), v.size() );
+			} );
+
+		REQUIRE( names == std::vector< std::string >{
+				"Content-Type", "X-Custom", "Server", "x-custom" } );
+		REQUIRE( values == std::vector< std::string >{
+				"text/plain", "first", "Unknown", "second" } );
+	}
+
+	SECTION( "conversion to ordinary fields" )
+	{
+		REQUIRE( "text/plain" == fields.get_field( "Content-Type" ) );
+		REQUIRE( 3 == fields.fields_count() );
+		REQUIRE( "second" == fields.get_field( "X-Custom" ) );
+		REQUIRE( "Unknown" == fields.get_field( http_field::server ) );
+
+		fields.set_field( http_field::server, "UNIT-TEST" );
+		REQUIRE( "UNIT-TEST" == fields.value_of( "Server" ) );
+
+		std::size_t count{};
+		fields.for_each_field_view( [&]( string_view_t, string_view_t ) {
+				++count;
+			} );
+		REQUIRE( 3u == count );
+	}
+
+	SECTION( "const access" )
+	{
+		const auto & cfields = fields;
+
+		// Fields are converted inside the arena, the object isn't modified.
+		REQUIRE( "second" == cfields.get_field( "X-Custom" ) );
+		REQUIRE( 3 == cfields.fields_count() );
+
+		std::size_t count{};
+		cfields.for_each_field_view( [&]( string_view_t, string_view_t ) {
+				++count;
+			} );
+		REQUIRE( 4u == count );
+	}
+
+	SECTION( "const access from several threads" )
+	{
+		const auto & cfields = fields;
+
+		std::vector< std::thread > threads;
+		std::atomic< int > successes{ 0 };
+		for( int i = 0; i != 4; ++i )
+			threads.emplace_back( [&] {
+					if( "text/plain" == cfields.get_field( http_field::content_type ) &&
+						"second" == cfields.get_field( "x-custom" ) &&
+						3 == cfields.fields_count() )
+						++successes;
+				} );
+
+		for( auto & t : threads )
+			t.join();
+
+		REQUIRE( 4 == successes );
+	}
+
+	SECTION( "copy" )
+	{
+		const http_header_fields_t copy{ fields };
+		REQUIRE( 3 == copy.fields_count() );
+		REQUIRE( "text/plain" == fields.value_of( "Content-Type" ) );
+		REQUIRE( "Unknown" == copy.value_of( "Server" ) );
+	}
 }
 
 TEST_CASE( "Working with common header" , "[header][common]" )
@@ -710,6 +836,89 @@ TEST_CASE( "working with string_to_field()" , "[header][string_to_field]" )
 #undef RESTINIO_FIELD_FROM_STRIN_TEST
 }
 
+TEST_CASE( "string_to_field() for all known fields" ,
+		"[header][string_to_field][perfect_hash]" )
+{
+	const auto to_upper = []( std::string s ) {
+		for( auto & ch : s )
+			ch = static_cast< char >( std::toupper(
+					static_cast< unsigned char >( ch ) ) );
+		return s;
+	};
+	const auto to_lower = []( std::string s ) {
+		for( auto & ch : s )
+			ch = static_cast< char >( std::tolower(
+					static_cast< unsigned char >( ch ) ) );
+		return s;
+	};
+
+	for( std::size_t i = 0u;
+		i != static_cast< std::size_t >( http_field::field_unspecified );
+		++i )
+	{
+		const auto id = static_cast< http_field_t >( i );
+		const std::string name{ field_to_string( id ) };
+
+		REQUIRE( id == string_to_field( name ) );
+		REQUIRE( id == string_to_field( to_upper( name ) ) );
+		REQUIRE( id == string_to_field( to_lower( name ) ) );
+
+		// Names that differ only by the last character.
+		REQUIRE( http_field::field_unspecified ==
+				string_to_field( name.substr( 0u, name.size() - 1u ) + "#" ) );
+	}
+
+	REQUIRE( http_field::field_unspecified == string_to_field( "" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "A" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "X-Request-Id" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "Content-Typo" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "Hos" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "Hostt" ) );
+}
+
+TEST_CASE( "Lookup of known fields after modifications" ,
+		"[header][fields][index]" )
+{
+	http_header_fields_t fields;
+
+	fields.set_field( "Host", "localhost" );
+	fields.set_field( "X-Custom", "custom" );
+	fields.set_field( http_field::content_type, "text/plain" );
+	fields.set_field( "Accept", "*/*" );
+	fields.append_field( "accept", ",text/html" );
+
+	REQUIRE( 4u == fields.fields_count() );
+	REQUIRE( "localhost" == fields.value_of( http_field::host ) );
+	REQUIRE( "text/plain" == fields.value_of( "content-type" ) );
+	REQUIRE( "*/*,text/html" == fields.value_of( http_field::accept ) );
+
+	fields.remove_field( "Host" );
+	REQUIRE( 3u == fields.fields_count() );
+	REQUIRE_FALSE( fields.has_field( http_field::host ) );
+	REQUIRE( "custom" == fields.value_of( "x-custom" ) );
+	REQUIRE( "text/plain" == fields.value_of( http_field::content_type ) );
+	REQUIRE( "*/*,text/html" == fields.value_of( "ACCEPT" ) );
+
+	fields.remove_field( http_field::content_type );
+	REQUIRE( 2u == fields.fields_count() );
+	REQUIRE_FALSE( fields.has_field( "Content-Type" ) );
+	REQUIRE( "*/*,text/html" == fields.value_of( http_field::accept ) );
+
+	fields.set_field( "Host", "example.com" );
+	REQUIRE( 3u == fields.fields_count() );
+	REQUIRE( "example.com" == fields.value_of( http_field::host ) );
+
+	http_header_fields_t other;
+	other.set_field( http_field::host, "other.com" );
+	other.swap_fields( fields );
+
+	REQUIRE( 1u == fields.fields_count() );
+	REQUIRE( "other.com" == fields.value_of( http_field::host ) );
+	REQUIRE_FALSE( fields.has_field( http_field::accept ) );
+	REQUIRE( "example.com" == other.value_of( http_field::host ) );
+	REQUIRE( "*/*,text/html" == other.value_of( http_field::accept ) );
+}
+
 TEST_CASE( "Connection" , "[header][connection]" )
 {
 	using namespace Catch;
@@ -772,6 +981,110 @@ TEST_CASE( "Connection" , "[header][connection]" )
 	}
 }
 
+TEST_CASE( "Format unsigned" , "[header][format_unsigned]" )
+{
+	const auto format = []( std::uint64_t v ) {
+		std::array< char, 20 > buf;
+		auto * end = buf.data() + buf.size();
+		auto * begin = impl::format_unsigned( v, end );
+		return std::string{ begin, end };
+	};
+
+	REQUIRE( "0" == format( 0u ) );
+	REQUIRE( "7" == format( 7u ) );
+	REQUIRE( "10" == format( 10u ) );
+	REQUIRE( "99" == format( 99u ) );
+	REQUIRE( "100" == format( 100u ) );
+	REQUIRE( "1234567" == format( 1234567u ) );
+	REQUIRE( "18446744073709551615" ==
+			format( std::numeric_limits< std::uint64_t >::max() ) );
+
+	for( std::uint64_t v = 0u; v < 100000u; v += 97u )
+		REQUIRE( std::to_string( v ) == format( v ) );
+}
+
+TEST_CASE( "Serialized response header" , "[header][serializer]" )
+{
+	http_response_header_t h{ status_created() };
+	h.should_keep_alive( true );
+	h.content_length( 1234567890123u );
+	h.set_field( http_field::content_type, "application/json" );
+	h.set_field( "X-Empty", "" );
+	h.set_field( "Server", "RESTinio" );
+
+	const std::string expected =
+		"HTTP/1.1 201 Created\r\n"
+		"Connection: keep-alive\r\n"
+		"Content-Length: 1234567890123\r\n"
+		"Content-Type: application/json\r\n"
+		"X-Empty: \r\n"
+		"Server: RESTinio\r\n"
+		"\r\n";
+
+	const impl::header_serializer_t serializer{
+			h,
+			impl::content_length_field_presence_t::add_content_length,
+			impl::date_field_presence_t::as_is };
+	REQUIRE( expected.size() == serializer.size() );
+
+	REQUIRE( expected == impl::create_header_string( h ) );
+
+	const auto buffer = impl::create_header_buffer( h );
+	REQUIRE( expected == std::string( buffer.data(), buffer.size() ) );
+
+	h.http_major( 1u );
+	h.http_minor( 0u );
+	h.should_keep_alive( false );
+	h.content_length( 0u );
+	REQUIRE( impl::create_header_string( h ) ==
+		"HTTP/1.0 201 Created\r\n"
+		"Connection: close\r\n"
+		"Content-Length: 0\r\n"
+		"Content-Type: application/json\r\n"
+		"X-Empty: \r\n"
+		"Server: RESTinio\r\n"
+		"\r\n" );
+
+	REQUIRE( impl::create_header_string( h,
+			impl::content_length_field_presence_t::skip_content_length ) ==
+		"HTTP/1.0 201 Created\r\n"
+		"Connection: close\r\n"
+		"Content-Type: application/json\r\n"
+		"X-Empty: \r\n"
+		"Server: RESTinio\r\n"
+		"\r\n" );
+}
+
+
+TEST_CASE( "Header buffers go back to the cache of their thread" ,
+		"[header][serializer][cache]" )
+{
+	// A buffer returned to the cache is given for a smaller request,
+	// so the capacity shows whether the buffer was cached.
+	const auto cached_capacity = []() {
+		auto buf = impl::header_buffers_cache_t::acquire( 600u );
+		const auto capacity = buf.capacity();
+		impl::header_buffers_cache_t::release( std::move( buf ) );
+		return capacity;
+	};
+
+	std::unique_ptr< impl::header_buffer_t > buffer;
+
+	std::thread{ [&] {
+		impl::header_buffer_t{ 1000u };
+		REQUIRE( 1000u == cached_capacity() );
+
+		buffer.reset( new impl::header_buffer_t{ 900u } );
+	} }.join();
+
+	// Destroyed on other thread: isn't cached there.
+	std::thread{ [&] {
+		REQUIRE( 600u == cached_capacity() );
+
+		buffer.reset();
+		REQUIRE( 600u == cached_capacity() );
+	} }.join();
+}
 
 TEST_CASE( "Query" , "[header][query string][query path]" )
 {
@@ -0,0 +1,130 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for lookup of header fields.
+*/
+
+#include <restinio/all.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio;
+
+namespace
+{
+
+// Typical header of a request from a browser.
+http_header_fields_t
+make_browser_header()
+{
+	http_header_fields_t fields;
+
+	fields.set_field( "Host", "localhost:8080" );
+	fields.set_field( "User-Agent",
+			"Mozilla/5.0 (X11; Linux x86_64; rv:80.0) Gecko/20100101 Firefox/80.0" );
+	fields.set_field( "Accept",
+			"text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8" );
+	fields.set_field( "Accept-Language", "en-US,en;q=0.5" );
+	fields.set_field( "Accept-Encoding", "gzip, deflate" );
+	fields.set_field( "DNT", "1" );
+	fields.set_field( "Upgrade-Insecure-Requests", "1" );
+	fields.set_field( "Cache-Control", "max-age=0" );
+	fields.set_field( "Cookie", "session=0123456789abcdef" );
+	fields.set_field( "Referer", "http://localhost:8080/index.html" );
+	fields.set_field( "If-Modified-Since", "Sat, 29 Aug 2020 10:00:00 GMT" );
+	fields.set_field( "If-None-Match", "\"0123456789\"" );
+	fields.set_field( "Origin", "http://localhost:8080" );
+	fields.set_field( "Pragma", "no-cache" );
+	fields.set_field( "Content-Type", "text/plain" );
+	fields.set_field( "X-Request-Id", "d2a9a1b0-0c5e-4b6e-8f0c-1f2e3d4c5b6a" );
+
+	return fields;
+}
+
+const char * const names_to_detect[] = {
+	"Host", "User-Agent", "Accept", "Accept-Language", "Accept-Encoding",
+	"Cookie", "Referer", "Content-Type", "Authorization",
+	"Access-Control-Request-Headers", "X-Request-Id", "X-Forwarded-For"
+};
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 1000000u );
+
+	{
+		std::vector< string_view_t > names;
+		for( const auto * n : names_to_detect )
+			names.emplace_back( n );
+
+		run_microbench( "string_to_field (12 names)", iterations,
+			[&] {
+				for( const auto & n : names )
+					microbench_consume( string_to_field( n ) );
+			} );
+	}
+
+	const auto fields = make_browser_header();
+
+	run_microbench( "has_field by id (4 present, 2 absent)", iterations,
+		[&] {
+			microbench_consume( fields.has_field( http_field::host ) );
+			microbench_consume( fields.has_field( http_field::content_type ) );
+			microbench_consume( fields.has_field( http_field::origin ) );
+			microbench_consume( fields.has_field( http_field::accept_encoding ) );
+			microbench_consume( fields.has_field( http_field::authorization ) );
+			microbench_consume( fields.has_field( http_field::content_encoding ) );
+		} );
+
+	run_microbench( "opt_value_of by id (4 present, 2 absent)", iterations,
+		[&] {
+			microbench_consume( fields.opt_value_of( http_field::host ).has_value() );
+			microbench_consume( fields.opt_value_of( http_field::content_type ).has_value() );
+			microbench_consume( fields.opt_value_of( http_field::origin ).has_value() );
+			microbench_consume( fields.opt_value_of( http_field::accept_encoding ).has_value() );
+			microbench_consume( fields.opt_value_of( http_field::authorization ).has_value() );
+			microbench_consume( fields.opt_value_of( http_field::content_encoding ).has_value() );
+		} );
+
+	run_microbench( "opt_value_of by name (4 present, 2 absent)", iterations,
+		[&] {
+			microbench_consume( fields.opt_value_of( "host" ).has_value() );
+			microbench_consume( fields.opt_value_of( "Content-Type" ).has_value() );
+			microbench_consume( fields.opt_value_of( "Origin" ).has_value() );
+			microbench_consume( fields.opt_value_of( "X-Request-Id" ).has_value() );
+			microbench_consume( fields.opt_value_of( "Authorization" ).has_value() );
+			microbench_consume( fields.opt_value_of( "X-Forwarded-For" ).has_value() );
+		} );
+
+	{
+		http_response_header_t response_header{ status_ok() };
+		response_header.should_keep_alive( true );
+		response_header.content_length( 12345u );
+		response_header.set_field( http_field::server, "RESTinio bench" );
+		response_header.set_field( http_field::content_type, "application/json" );
+		response_header.set_field( http_field::cache_control, "no-cache" );
+
+		run_microbench( "create_header_string (3 fields)", iterations,
+			[&] {
+				microbench_consume(
+					impl::create_header_string( response_header ).size() );
+			} );
+
+		run_microbench( "create_header_buffer (3 fields)", iterations,
+			[&] {
+				microbench_consume(
+					impl::create_header_buffer( response_header ).size() );
+			} );
+	}
+
+	run_microbench( "fill header with 16 fields", iterations / 10u,
+		[] {
+			microbench_consume( make_browser_header().fields_count() );
+		} );
+
+	return 0;
+}
@@ -2441,3 +2441,114 @@ TEST_CASE( "comment producer", "[comment_producer]" )
 	}
 }
 
+
+TEST_CASE( "char class tables", "[char_class_table]" )
+{
+	namespace impl = restinio::http_field_parsers::impl;
+
+	for( int i = 0; i != 256; ++i )
+	{
+		const char ch = static_cast< char >( i );
+		INFO( "character code: " << i );
+
+		REQUIRE( impl::is_token_char( ch ) == impl::token_chars()( ch ) );
+		REQUIRE( impl::is_qdtext( ch ) == impl::qdtext_chars()( ch ) );
+		REQUIRE( impl::is_ctext( ch ) == impl::ctext_chars()( ch ) );
+	}
+}
+
+TEST_CASE( "consume runs of characters", "[source][consume_while]" )
+{
+	namespace impl = restinio::http_field_parsers::impl;
+	using restinio::easy_parser::impl::source_t;
+
+	{
+		source_t from{ "max-age=0" };
+
+		REQUIRE( "max-age" == from.consume_while( impl::token_chars() ) );
+		REQUIRE( 7u == from.current_position() );
+		REQUIRE( "" == from.consume_while( impl::token_chars() ) );
+		REQUIRE( 7u == from.current_position() );
+	}
+
+	// Every character as a stop in every position of long runs
+	// (those are checked by blocks).
+	for( int code = 0; code != 256; ++code )
+	{
+		const char stop = static_cast< char >( code );
+		for( std::size_t pos = 0u; pos != 40u; ++pos )
+		{
+			std::string text( 40u, 'a' );
+			text[ pos ] = stop;
+			text[ 3 ] = '\xE0'; // obs-text.
+			text[ 5 ] = '\t';
+
+			INFO( "character code: " << code << ", position: " << pos );
+
+			source_t expected_qd{ text };
+			source_t actual_qd{ text };
+			REQUIRE( expected_qd.consume_while( impl::qdtext_chars() ) ==
+					actual_qd.consume_text_while(
+							impl::qdtext_chars(), '"', '\\', '\\' ) );
+
+			source_t expected_c{ text };
+			source_t actual_c{ text };
+			REQUIRE( expected_c.consume_while( impl::ctext_chars() ) ==
+					actual_c.consume_text_while(
+							impl::ctext_chars(), '(', ')', '\\' ) );
+		}
+	}
+}
+
+TEST_CASE( "long token, quoted-string and comment", "[token][quoted_string]" )
+{
+	using namespace restinio::http_field_parsers;
+	using restinio::easy_parser::try_parse;
+
+	{
+		const auto result = try_parse(
+				"abcdefghijklmnopqrstuvwxyz0123456789!#$%&'*+-.^_`|~",
+				token_p() );
+
+		REQUIRE( result );
+		REQUIRE( "abcdefghijklmnopqrstuvwxyz0123456789!#$%&'*+-.^_`|~" ==
+				*result );
+	}
+
+	{
+		const auto result = try_parse(
+				"\"----WebKitFormBoundary7MA4YWxkTrZu0gW \\\"and\\\\ more\"",
+				quoted_string_p() );
+
+		REQUIRE( result );
+		REQUIRE( "----WebKitFormBoundary7MA4YWxkTrZu0gW \"and\\ more" ==
+				*result );
+	}
+
+	{
+		const auto result = try_parse(
+				"\"----WebKitFormBoundary7MA4YWxkTrZu0gW\x7F\"",
+				quoted_string_p() );
+
+		REQUIRE( !result );
+		REQUIRE( 38u == result.error().position() );
+	}
+
+	{
+		const auto result = try_parse(
+				"(Windows NT 10.0; Win64; x64 \\(really\\) (KHTML, like Gecko))",
+				comment_p() );
+
+		REQUIRE( result );
+		REQUIRE( "Windows NT 10.0; Win64; x64 (really) KHTML, like Gecko" ==
+				*result );
+	}
+
+	{
+		const auto result = try_parse(
+				"(Windows NT 10.0; Win64; x64\r\n)",
+				comment_p() );
+
+		REQUIRE( !result );
+	}
+}
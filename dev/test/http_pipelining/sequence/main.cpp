@@ -343,3 +343,76 @@ TEST_CASE( "Interrupt sequesnces HTTP piplining" , "[long_sequences][interrupt]"
 	other_thread.stop_and_join();
 }
 
+
+TEST_CASE( "Responses completed together" , "[coalesced_responses]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	constexpr unsigned int requests_count = 8;
+
+	std::vector< restinio::request_handle_t > requests;
+	std::mutex notifications_lock;
+	std::vector< std::string > notifications;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.max_pipelined_requests( requests_count )
+				.request_handler(
+					[&]( auto req ){
+						requests.push_back( std::move( req ) );
+
+						if( requests_count == requests.size() )
+						{
+							// Complete responses in reverse order, so all
+							// of them are ready when the first one is done.
+							for( auto it = requests.rbegin(); it != requests.rend(); ++it )
+							{
+								const auto target =
+									std::string{ (*it)->header().request_target() };
+
+								(*it)->create_response()
+									.append_header( "Server", "RESTinio utest server" )
+									.set_body( (*it)->body() )
+									.done( [&, target]( const auto & ec ) {
+										std::lock_guard< std::mutex > lock{ notifications_lock };
+										notifications.push_back(
+											target + ( ec ? ":error" : ":ok" ) );
+									} );
+							}
+							requests.clear();
+						}
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string pipelinedrequests;
+	for( unsigned int i = 0; i < requests_count - 1; ++i )
+		pipelinedrequests += create_request( i );
+	pipelinedrequests += create_request( requests_count - 1, "close" );
+
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request( pipelinedrequests ) );
+
+	const auto resp_seq = get_response_sequence( response );
+	REQUIRE( requests_count == resp_seq.size() );
+	for( unsigned int i = 0; i < requests_count; ++i )
+		REQUIRE( i == resp_seq[ i ] );
+
+	other_thread.stop_and_join();
+
+	REQUIRE( ( std::vector< std::string >{
+			"/0:ok", "/1:ok", "/2:ok", "/3:ok",
+			"/4:ok", "/5:ok", "/6:ok", "/7:ok" } ) == notifications );
+}
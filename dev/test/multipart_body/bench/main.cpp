@@ -0,0 +1,139 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for splitting of multipart bodies.
+*/
+
+#include <restinio/helpers/multipart_body.hpp>
+#include <restinio/helpers/multipart_stream.hpp>
+
+#include <test/common/microbench.hpp>
+
+#include <random>
+
+using namespace restinio;
+using namespace restinio::multipart_body;
+
+namespace
+{
+
+const string_view_t boundary{ "--------------------------8f2a6b04e1d3c5a7" };
+
+//! Content of a part: random bytes like in an uploaded file.
+std::string
+make_part_content( std::size_t size, std::mt19937 & gen )
+{
+	std::uniform_int_distribution< int > dist{ 0, 255 };
+
+	std::string result( size, ' ' );
+	for( auto & ch : result )
+		ch = static_cast< char >( dist( gen ) );
+
+	return result;
+}
+
+std::string
+make_body( std::size_t parts, std::size_t part_size )
+{
+	std::mt19937 gen{ 42u };
+
+	std::string body;
+	for( std::size_t i = 0u; i != parts; ++i )
+	{
+		body.append( boundary.data(), boundary.size() );
+		body.append(
+				"\r\n"
+				"Content-Disposition: form-data; name=\"file\"; filename=\"a.bin\"\r\n"
+				"Content-Type: application/octet-stream\r\n"
+				"\r\n" );
+		body.append( make_part_content( part_size, gen ) );
+		body.append( "\r\n" );
+	}
+	body.append( boundary.data(), boundary.size() );
+	body.append( "--\r\n" );
+
+	return body;
+}
+
+//! Count of boundaries found by string_view_t::find.
+std::size_t
+count_by_string_view_find( string_view_t body )
+{
+	std::size_t count = 0u;
+	for( auto pos = body.find( boundary );
+		string_view_t::npos != pos;
+		pos = body.find( boundary, pos + boundary.size() ) )
+		++count;
+
+	return count;
+}
+
+//! Count of boundaries found by substring_finder_t.
+std::size_t
+count_by_substring_finder( string_view_t body )
+{
+	const utils::impl::substring_finder_t finder{ boundary };
+
+	std::size_t count = 0u;
+	for( auto pos = finder.find( body );
+		string_view_t::npos != pos;
+		pos = finder.find( body, pos + boundary.size() ) )
+		++count;
+
+	return count;
+}
+
+void
+run_for_body( const std::string & name, std::size_t iterations,
+	const std::string & body )
+{
+	run_microbench( name + ": string_view_t::find", iterations,
+		[&] {
+			microbench_consume( count_by_string_view_find( body ) );
+		} );
+
+	run_microbench( name + ": substring_finder_t", iterations,
+		[&] {
+			microbench_consume( count_by_substring_finder( body ) );
+		} );
+
+	run_microbench( name + ": split_multipart_body", iterations,
+		[&] {
+			microbench_consume( split_multipart_body( body, boundary ).size() );
+		} );
+
+	run_microbench( name + ": stream_parser_t (16KiB pieces)", iterations,
+		[&] {
+			stream_parser_t parser{ boundary,
+				[]( parsed_part_t ) -> part_sink_handle_t {
+					return std::make_unique< callback_part_sink_t >(
+							[]( string_view_t data ) {
+								microbench_consume( data.size() );
+							} );
+				} };
+
+			const string_view_t whole{ body };
+			for( std::size_t pos = 0u; pos < whole.size(); pos += 16u * 1024u )
+				parser.consume( whole.substr( pos, 16u * 1024u ) );
+
+			microbench_consume( *parser.finish() );
+		} );
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 1000u );
+
+	run_for_body( "1000 parts of 100 bytes", iterations,
+			make_body( 1000u, 100u ) );
+
+	run_for_body( "1 part of 1MiB", iterations,
+			make_body( 1u, 1024u * 1024u ) );
+
+	return 0;
+}
@@ -5,6 +5,9 @@
 #include <catch2/catch.hpp>
 
 #include <restinio/helpers/multipart_body.hpp>
+#include <restinio/utils/impl/substring_finder.hpp>
+
+#include <cstdlib>
 
 using namespace std::string_literals;
 
@@ -574,3 +577,77 @@ TEST_CASE( "Several parts in the body", "[body]" )
 	REQUIRE( 5 == ordinal );
 }
 
+
+TEST_CASE( "substring_finder", "[substring_finder]" )
+{
+	using restinio::utils::impl::substring_finder_t;
+
+	const auto check = []( const std::string & text, const std::string & pattern ) {
+			const substring_finder_t finder{ pattern };
+
+			for( std::size_t from = 0u; from <= text.size() + 1u; ++from )
+			{
+				INFO( "text: '" << text << "', pattern: '" << pattern <<
+						"', from: " << from );
+				REQUIRE( text.find( pattern, from ) == finder.find( text, from ) );
+			}
+		};
+
+	SECTION( "simple cases" )
+	{
+		check( "", "" );
+		check( "abc", "" );
+		check( "", "a" );
+		check( "a", "a" );
+		check( "abc", "c" );
+		check( "abcabc", "ca" );
+		check( "ab", "abc" );
+		check( "--boundary", "--boundary" );
+		check( "\r\n--boundary\r\n--bound\r\n--boundary--\r\n", "\r\n--boundary" );
+	}
+
+	SECTION( "matches at every position" )
+	{
+		// Long enough to be checked by blocks and by the tail loop.
+		const std::string pattern{ "\r\n--boundary" };
+		for( std::size_t len = pattern.size(); len != 80u; ++len )
+		{
+			for( std::size_t pos = 0u; pos + pattern.size() <= len; ++pos )
+			{
+				std::string text( len, 'x' );
+				text.replace( pos, pattern.size(), pattern );
+				check( text, pattern );
+			}
+		}
+	}
+
+	SECTION( "partial matches" )
+	{
+		// The first and the last bytes match but the middle doesn't.
+		check( std::string( 100u, '-' ) + "-ab-" + std::string( 20u, '-' ),
+				"-aa-" );
+		check( "--boundar--boundarx--boundary-boundary", "--boundary" );
+		check( std::string( 64u, 'a' ), "aab" );
+		check( std::string( 64u, 'a' ) + "b", "aab" );
+	}
+
+	SECTION( "random texts" )
+	{
+		std::srand( 42u );
+		const auto random_string = []( std::size_t len ) {
+				std::string r( len, ' ' );
+				for( auto & ch : r )
+					ch = "ab-\r\n"[ std::rand() % 5 ];
+				return r;
+			};
+
+		for( int i = 0; i != 2000; ++i )
+		{
+			const auto text = random_string(
+					static_cast< std::size_t >( std::rand() % 100 ) );
+			const auto pattern = random_string(
+					1u + static_cast< std::size_t >( std::rand() % 6 ) );
+			check( text, pattern );
+		}
+	}
+}
@@ -0,0 +1,510 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for incremental parser of multipart bodies.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+#include <restinio/helpers/file_upload.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+using namespace std::string_literals;
+using namespace restinio::multipart_body;
+
+namespace
+{
+
+//! Description of a part collected by tests.
+struct collected_part_t
+{
+	std::string name;
+	std::string body;
+	bool completed{ false };
+	bool interrupted{ false };
+};
+
+class collecting_sink_t final : public part_sink_t
+{
+	collected_part_t & m_part;
+
+public:
+	collecting_sink_t( collected_part_t & part ) : m_part{ part } {}
+
+	void
+	on_data( restinio::string_view_t data ) override
+	{
+		REQUIRE( !data.empty() );
+		m_part.body.append( data.data(), data.size() );
+	}
+
+	void
+	on_complete() override { m_part.completed = true; }
+
+	void
+	on_interrupted() noexcept override { m_part.interrupted = true; }
+};
+
+//! Make a handler that collects parts to @a parts.
+stream_parser_t::part_handler_t
+make_collecting_handler( std::vector< collected_part_t > & parts )
+{
+	return [&parts]( parsed_part_t part ) -> part_sink_handle_t {
+			parts.emplace_back();
+			const auto name = part.fields.opt_value_of( "name" );
+			if( name )
+				parts.back().name = std::string{ name->data(), name->size() };
+
+			return std::make_unique< collecting_sink_t >( parts.back() );
+		};
+}
+
+const std::string boundary{ "--boundary" };
+
+const std::string multipart_body =
+	"preamble\r\n"
+	"--boundary\r\n"
+	"Name: first\r\n"
+	"Content-Type: text/plain\r\n"
+	"\r\n"
+	"Hello\r\n--boundar\r\n-\r\n\r\n--\r"
+	"\r\n"
+	"--boundary\r\n"
+	"\r\n"
+	"no fields\r\n"
+	"--boundary\r\n"
+	"Name: empty\r\n"
+	"\r\n"
+	"\r\n"
+	"--boundary\r\n"
+	"Name: last\r\n"
+	"\r\n"
+	"--boundar--boundary\r"
+	"\r\n"
+	"--boundary--\r\n"
+	"epilogue\r\n--boundary\r\n";
+
+} /* namespace anonymous */
+
+TEST_CASE( "Parse by pieces of different sizes", "[stream_parser][pieces]" )
+{
+	for( std::size_t piece = 1u; piece <= multipart_body.size(); ++piece )
+	{
+		std::vector< collected_part_t > parts;
+		parts.reserve( 10 );
+
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ) };
+
+		for( std::size_t pos = 0u; pos < multipart_body.size(); pos += piece )
+			parser.consume(
+				restinio::string_view_t{ multipart_body }.substr( pos, piece ) );
+
+		REQUIRE( parser.completed() );
+
+		const auto result = parser.finish();
+		REQUIRE( result );
+		REQUIRE( 4u == *result );
+
+		REQUIRE( 4u == parts.size() );
+
+		REQUIRE( "first" == parts[ 0 ].name );
+		REQUIRE( "Hello\r\n--boundar\r\n-\r\n\r\n--\r" == parts[ 0 ].body );
+
+		REQUIRE( "" == parts[ 1 ].name );
+		REQUIRE( "no fields" == parts[ 1 ].body );
+
+		REQUIRE( "empty" == parts[ 2 ].name );
+		REQUIRE( "" == parts[ 2 ].body );
+
+		REQUIRE( "last" == parts[ 3 ].name );
+		REQUIRE( "--boundar--boundary\r" == parts[ 3 ].body );
+
+		for( const auto & p : parts )
+		{
+			REQUIRE( p.completed );
+			REQUIRE_FALSE( p.interrupted );
+		}
+	}
+}
+
+TEST_CASE( "The same parts as split_multipart_body", "[stream_parser][split]" )
+{
+	const std::string body =
+		"--boundary\r\n"
+		"Content-Disposition: form-data; name=\"a\"\r\n"
+		"\r\n"
+		"value of a\r\n"
+		"--boundary\r\n"
+		"Content-Disposition: form-data; name=\"b\"\r\n"
+		"\r\n"
+		"value\r\nof b\r\n"
+		"--boundary--\r\n";
+
+	const auto expected = split_multipart_body( body, boundary );
+	REQUIRE( 2u == expected.size() );
+
+	std::vector< std::string > bodies;
+	stream_parser_t parser{ boundary,
+		[&bodies]( parsed_part_t part ) -> part_sink_handle_t {
+			REQUIRE( part.body.empty() );
+			REQUIRE( part.fields.has_field(
+					restinio::http_field::content_disposition ) );
+
+			bodies.emplace_back();
+			return std::make_unique< callback_part_sink_t >(
+					[&bodies]( restinio::string_view_t data ) {
+						bodies.back().append( data.data(), data.size() );
+					} );
+		} };
+
+	parser.consume( body );
+	REQUIRE( 2u == *parser.finish() );
+
+	REQUIRE( 2u == bodies.size() );
+	for( std::size_t i = 0u; i != expected.size(); ++i )
+	{
+		const auto parsed = try_parse_part( expected[ i ] );
+		REQUIRE( parsed );
+		REQUIRE( parsed->body == bodies[ i ] );
+	}
+}
+
+TEST_CASE( "Skipped parts", "[stream_parser][skip]" )
+{
+	std::size_t parts_seen = 0u;
+	stream_parser_t parser{ boundary,
+		[&parts_seen]( parsed_part_t ) -> part_sink_handle_t {
+			++parts_seen;
+			return {};
+		} };
+
+	parser.consume( multipart_body );
+
+	REQUIRE( 4u == parts_seen );
+	REQUIRE( 4u == *parser.finish() );
+}
+
+TEST_CASE( "Broken bodies", "[stream_parser][errors]" )
+{
+	SECTION( "no closing boundary" )
+	{
+		std::vector< collected_part_t > parts;
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ) };
+
+		parser.consume(
+				"--boundary\r\n"
+				"Name: first\r\n"
+				"\r\n"
+				"Hello" );
+
+		REQUIRE_FALSE( parser.completed() );
+
+		const auto result = parser.finish();
+		REQUIRE_FALSE( result );
+		REQUIRE( enumeration_error_t::unexpected_error == result.error() );
+
+		REQUIRE( 1u == parts.size() );
+		REQUIRE( "Hello" == parts[ 0 ].body );
+		REQUIRE_FALSE( parts[ 0 ].completed );
+		REQUIRE( parts[ 0 ].interrupted );
+	}
+
+	SECTION( "no boundary at all" )
+	{
+		std::vector< collected_part_t > parts;
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ) };
+
+		parser.consume( "Hello, World" );
+
+		const auto result = parser.finish();
+		REQUIRE_FALSE( result );
+		REQUIRE( enumeration_error_t::unexpected_error == result.error() );
+		REQUIRE( parts.empty() );
+	}
+
+	SECTION( "no parts" )
+	{
+		std::vector< collected_part_t > parts;
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ) };
+
+		parser.consume( "--boundary--\r\n" );
+
+		const auto result = parser.finish();
+		REQUIRE_FALSE( result );
+		REQUIRE( enumeration_error_t::no_parts_found == result.error() );
+	}
+
+	SECTION( "garbage after boundary" )
+	{
+		std::vector< collected_part_t > parts;
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ) };
+
+		parser.consume( "--boundary\r\n\r\nHello\r\n--boundaryXX\r\n" );
+		REQUIRE( parser.failed() );
+
+		REQUIRE( 1u == parts.size() );
+		REQUIRE( parts[ 0 ].completed );
+
+		REQUIRE_FALSE( parser.finish() );
+	}
+
+	SECTION( "invalid part header" )
+	{
+		std::vector< collected_part_t > parts;
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ) };
+
+		parser.consume( "--boundary\r\nName first\r\n\r\nHello" );
+		REQUIRE( parser.failed() );
+		REQUIRE( parts.empty() );
+	}
+
+	SECTION( "too long part headers" )
+	{
+		std::vector< collected_part_t > parts;
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ), 64u };
+
+		parser.consume( "--boundary\r\n" );
+		for( int i = 0; i != 10 && !parser.failed(); ++i )
+			parser.consume( "Name: 0123456789\r\n" );
+
+		REQUIRE( parser.failed() );
+		REQUIRE( parts.empty() );
+	}
+
+	SECTION( "interrupt" )
+	{
+		std::vector< collected_part_t > parts;
+		stream_parser_t parser{ boundary, make_collecting_handler( parts ) };
+
+		parser.consume( "--boundary\r\n\r\nHello\r\n--bou" );
+		parser.interrupt();
+
+		REQUIRE( parser.failed() );
+		REQUIRE( 1u == parts.size() );
+		REQUIRE( "Hello" == parts[ 0 ].body );
+		REQUIRE( parts[ 0 ].interrupted );
+	}
+}
+
+TEST_CASE( "Failure of a part sink", "[body_sink][errors]" )
+{
+	int data_calls = 0;
+	bool interrupted = false;
+
+	class failing_sink_t final : public part_sink_t
+	{
+		int & m_data_calls;
+		bool & m_interrupted;
+
+	public:
+		failing_sink_t( int & data_calls, bool & interrupted )
+			:	m_data_calls{ data_calls }, m_interrupted{ interrupted }
+		{}
+
+		void
+		on_data( restinio::string_view_t ) override
+		{
+			++m_data_calls;
+			throw restinio::exception_t{ "disk is full" };
+		}
+
+		void
+		on_complete() override {}
+
+		void
+		on_interrupted() noexcept override { m_interrupted = true; }
+	};
+
+	body_sink_t sink{ boundary,
+		[&]( parsed_part_t ) -> part_sink_handle_t {
+			return std::make_unique< failing_sink_t >( data_calls, interrupted );
+		} };
+
+	REQUIRE_FALSE( sink.error() );
+
+	REQUIRE_THROWS_AS(
+			sink.on_chunk( "--boundary\r\n\r\nHello" ),
+			restinio::exception_t );
+	REQUIRE( 1 == data_calls );
+	REQUIRE( interrupted );
+	REQUIRE( sink.error() );
+
+	// The parser isn't fed anymore.
+	REQUIRE_THROWS_AS(
+			sink.on_chunk( ", World\r\n--boundary--\r\n" ),
+			restinio::exception_t );
+	REQUIRE( 1 == data_calls );
+
+	sink.on_interrupted();
+	REQUIRE_FALSE( sink.result() );
+}
+
+#if !defined( _MSC_VER ) && !defined( __MINGW32__ )
+
+#include <fcntl.h>
+
+TEST_CASE( "File part sink", "[file_part_sink]" )
+{
+	const std::string file_name{ "multipart_stream_test.tmp" };
+
+	{
+		const auto fd = ::open(
+				file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600 );
+		REQUIRE( -1 != fd );
+
+		file_part_sink_t sink{ fd };
+		sink.on_data( "Hello, " );
+		sink.on_data( "World" );
+		sink.on_complete();
+	}
+
+	std::ifstream in{ file_name, std::ios::binary };
+	const std::string content{
+			std::istreambuf_iterator< char >{ in },
+			std::istreambuf_iterator< char >{} };
+	in.close();
+	std::remove( file_name.c_str() );
+
+	REQUIRE( "Hello, World" == content );
+}
+
+#endif
+
+namespace
+{
+
+//! Uploaded files are collected here.
+struct uploaded_files_t
+{
+	std::mutex m_lock;
+	std::map< std::string, std::string > m_files;
+};
+
+class multipart_sink_factory_t
+{
+	std::shared_ptr< uploaded_files_t > m_files;
+
+public:
+	multipart_sink_factory_t( std::shared_ptr< uploaded_files_t > files )
+		:	m_files{ std::move( files ) }
+	{}
+
+	restinio::incoming_body::sink_handle_t
+	make_sink(
+		const restinio::http_request_header_t & header,
+		restinio::incoming_body::resumer_t )
+	{
+		using namespace restinio::file_upload;
+
+		auto files = m_files;
+		auto sink = make_body_sink( header,
+				make_stream_part_handler(
+					[files]( part_description_t part ) -> part_sink_handle_t {
+						const auto name = *part.filename;
+						return std::make_unique< callback_part_sink_t >(
+								[files, name]( restinio::string_view_t data ) {
+									std::lock_guard< std::mutex > lock{ files->m_lock };
+									files->m_files[ name ].append(
+											data.data(), data.size() );
+								} );
+					} ),
+				"multipart", restinio::string_view_t{ "form-data" } );
+
+		if( sink )
+			return *sink;
+
+		return {};
+	}
+};
+
+struct upload_traits_t : public restinio::traits_t<
+		restinio::asio_timer_manager_t,
+		utest_logger_t >
+{
+	using body_sink_factory_t = multipart_sink_factory_t;
+};
+
+} /* namespace anonymous */
+
+TEST_CASE( "Upload without buffering", "[body_sink][upload]" )
+{
+	using http_server_t = restinio::http_server_t< upload_traits_t >;
+
+	auto files = std::make_shared< uploaded_files_t >();
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[files]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.body_sink_factory(
+					std::make_shared< multipart_sink_factory_t >( files ) )
+				.request_handler(
+					[]( auto req ){
+						auto sink = std::dynamic_pointer_cast< body_sink_t >(
+								req->body_sink() );
+
+						std::string resp_body;
+						if( sink && sink->result() )
+						{
+							REQUIRE( req->body().empty() );
+							resp_body = "parts: " + std::to_string( *sink->result() );
+						}
+						else
+							resp_body = "failure";
+
+						return req->create_response()
+							.set_body( std::move( resp_body ) )
+							.done();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string big_file;
+	for( int i = 0; i != 20000; ++i )
+		big_file += "line " + std::to_string( i ) + "\r\n";
+
+	const std::string body =
+		"--boundary\r\n"
+		"Content-Disposition: form-data; name=\"comment\"\r\n"
+		"\r\n"
+		"Just a comment\r\n"
+		"--boundary\r\n"
+		"Content-Disposition: form-data; name=\"file\"; filename=\"big.txt\"\r\n"
+		"Content-Type: text/plain\r\n"
+		"\r\n" +
+		big_file + "\r\n"
+		"--boundary--\r\n";
+
+	const std::string request =
+		"POST /upload HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"Content-Type: multipart/form-data; boundary=boundary\r\n"
+		"Content-Length: " + std::to_string( body.size() ) + "\r\n"
+		"Connection: close\r\n"
+		"\r\n" + body;
+
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request( request ) );
+
+	REQUIRE_THAT( response, Catch::Matchers::EndsWith( "parts: 2" ) );
+
+	other_thread.stop_and_join();
+
+	REQUIRE( 1u == files->m_files.size() );
+	REQUIRE( big_file == files->m_files[ "big.txt" ] );
+}
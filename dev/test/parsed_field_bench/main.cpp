@@ -0,0 +1,111 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for repeated access to parsed values of header fields.
+*/
+
+#include <restinio/all.hpp>
+
+#include <restinio/helpers/http_field_parsers/content-type.hpp>
+#include <restinio/helpers/http_field_parsers/cache-control.hpp>
+#include <restinio/helpers/http_field_parsers/authorization.hpp>
+#include <restinio/helpers/http_field_parsers/range.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio;
+using namespace restinio::http_field_parsers;
+
+namespace
+{
+
+http_request_header_t
+make_header()
+{
+	http_request_header_t header{ http_method_post(), "/upload" };
+
+	header.set_field( http_field::content_type,
+			"multipart/form-data; boundary=\"----WebKitFormBoundary7MA4YWxkTrZu0gW\"" );
+	header.set_field( http_field::cache_control,
+			"no-cache, no-store, max-age=0, must-revalidate" );
+	header.set_field( http_field::authorization,
+			"Bearer eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9.eyJzdWIiOiIxMjM0NTY3ODkwIn0" );
+	header.set_field( http_field::range, "bytes=0-1023,2048-4095,-512" );
+
+	return header;
+}
+
+//! How many times every field is accessed by middleware layers.
+constexpr int accesses_per_request = 4;
+
+template< typename Parsed_Field_Type >
+void
+run_for_field( const char * name, std::size_t iterations, http_field_t field_id )
+{
+	const auto header = make_header();
+
+	run_microbench( fmt::format( "{}: try_parse", name ), iterations,
+		[&] {
+			const auto r = Parsed_Field_Type::try_parse(
+					header.value_of( field_id ) );
+			microbench_consume( r.has_value() );
+		} );
+
+	run_microbench( fmt::format( "{}: parsed (cached)", name ), iterations,
+		[&] {
+			const auto r = header.parsed< Parsed_Field_Type >( field_id );
+			microbench_consume( r->has_value() );
+		} );
+
+	// Every request gets its own copy of the header without
+	// cached values.
+	const auto fresh_header = make_header();
+
+	run_microbench(
+		fmt::format( "{}: {} accesses per request by try_parse",
+				name, accesses_per_request ),
+		iterations,
+		[&] {
+			const auto h = fresh_header;
+			for( int i = 0; i != accesses_per_request; ++i )
+			{
+				const auto r = Parsed_Field_Type::try_parse(
+						h.value_of( field_id ) );
+				microbench_consume( r.has_value() );
+			}
+		} );
+
+	run_microbench(
+		fmt::format( "{}: {} accesses per request by parsed",
+				name, accesses_per_request ),
+		iterations,
+		[&] {
+			const auto h = fresh_header;
+			for( int i = 0; i != accesses_per_request; ++i )
+			{
+				const auto r = h.parsed< Parsed_Field_Type >( field_id );
+				microbench_consume( r->has_value() );
+			}
+		} );
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 100000u );
+
+	run_for_field< content_type_value_t >(
+			"Content-Type", iterations, http_field::content_type );
+	run_for_field< cache_control_value_t >(
+			"Cache-Control", iterations, http_field::cache_control );
+	run_for_field< authorization_value_t >(
+			"Authorization", iterations, http_field::authorization );
+	run_for_field< range_value_t< std::uint64_t > >(
+			"Range", iterations, http_field::range );
+
+	return 0;
+}
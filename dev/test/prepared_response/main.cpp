@@ -0,0 +1,274 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for pre-serialized responses.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/all.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using namespace std::string_literals;
+
+namespace
+{
+
+//! Connection that stores the last written response.
+class capturing_connection_t : public restinio::impl::connection_base_t
+{
+public:
+	using restinio::impl::connection_base_t::connection_base_t;
+
+	void
+	write_response_parts(
+		restinio::request_id_t request_id,
+		restinio::response_output_flags_t response_output_flags,
+		restinio::write_group_t wg ) override
+	{
+		m_request_id = request_id;
+		m_flags = response_output_flags;
+		m_items_count = wg.items_count();
+		m_status_line_size = wg.status_line_size();
+
+		m_data.clear();
+		for( const auto & item : wg.items() )
+		{
+			const auto buf = item.buf();
+			m_data.append( static_cast< const char * >( buf.data() ), buf.size() );
+		}
+	}
+
+	void
+	check_timeout(
+		std::shared_ptr< restinio::tcp_connection_ctx_base_t > & /*self*/ ) override
+	{}
+
+	bool
+	always_add_date_field() const noexcept override
+	{
+		return m_always_add_date_field;
+	}
+
+	bool m_always_add_date_field{ false };
+
+	restinio::request_id_t m_request_id{ 0u };
+	restinio::response_output_flags_t m_flags{
+			restinio::response_parts_attr_t::not_final_parts,
+			restinio::response_connection_attr_t::connection_keepalive };
+	std::size_t m_items_count{ 0u };
+	std::size_t m_status_line_size{ 0u };
+	std::string m_data;
+};
+
+restinio::request_handle_t
+make_request(
+	restinio::request_id_t id,
+	bool keep_alive,
+	std::shared_ptr< capturing_connection_t > conn )
+{
+	restinio::http_request_header_t header{ restinio::http_method_get(), "/" };
+	header.should_keep_alive( keep_alive );
+
+	return std::make_shared< restinio::request_t >(
+			id,
+			std::move( header ),
+			""s,
+			std::move( conn ),
+			restinio::endpoint_t{
+					restinio::asio_ns::ip::address::from_string("127.0.0.1"),
+					12345u } );
+}
+
+} /* namespace anonymous */
+
+TEST_CASE( "prepared response content" , "[prepared_response][content]" )
+{
+	restinio::http_response_header_t header{ restinio::status_ok() };
+	header.set_field( restinio::http_field::content_type, "text/plain" );
+	header.set_field( "Server", "RESTinio utest server" );
+
+	const restinio::prepared_response_t response{ std::move( header ), "Hello!" };
+
+	auto conn = std::make_shared< capturing_connection_t >( 1u );
+
+	REQUIRE( restinio::request_accepted() ==
+			response.send( make_request( 42u, true, conn ) ) );
+
+	REQUIRE( 42u == conn->m_request_id );
+	REQUIRE( 1u == conn->m_items_count );
+	REQUIRE( 15u == conn->m_status_line_size );
+	REQUIRE( restinio::response_parts_attr_t::final_parts ==
+			conn->m_flags.m_response_parts );
+	REQUIRE( restinio::response_connection_attr_t::connection_keepalive ==
+			conn->m_flags.m_response_connection );
+	REQUIRE( conn->m_data ==
+			"HTTP/1.1 200 OK\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 6\r\n"
+			"Content-Type: text/plain\r\n"
+			"Server: RESTinio utest server\r\n"
+			"\r\n"
+			"Hello!" );
+
+	REQUIRE( restinio::request_accepted() ==
+			response.send( make_request( 43u, false, conn ) ) );
+
+	REQUIRE( 43u == conn->m_request_id );
+	REQUIRE( restinio::response_connection_attr_t::connection_close ==
+			conn->m_flags.m_response_connection );
+	REQUIRE( conn->m_data ==
+			"HTTP/1.1 200 OK\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 6\r\n"
+			"Content-Type: text/plain\r\n"
+			"Server: RESTinio utest server\r\n"
+			"\r\n"
+			"Hello!" );
+}
+
+TEST_CASE( "buffers are shared" , "[prepared_response][buffers]" )
+{
+	const restinio::prepared_response_t response{
+			restinio::http_response_header_t{ restinio::status_not_found() },
+			"" };
+
+	const auto keep_alive = response.buffer( true );
+	REQUIRE( keep_alive == response.buffer( true ) );
+	REQUIRE( keep_alive != response.buffer( false ) );
+
+	REQUIRE( *response.buffer( false ) ==
+			"HTTP/1.1 404 Not Found\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 0\r\n"
+			"\r\n" );
+}
+
+TEST_CASE( "date field is updated" , "[prepared_response][date]" )
+{
+	restinio::http_response_header_t header{ restinio::status_ok() };
+	header.set_field( restinio::http_field::date, "" );
+
+	const restinio::prepared_response_t response{ std::move( header ), "OK" };
+
+	const auto extract_date = []( const std::string & data ) {
+		const auto pos = data.find( "Date: " );
+		REQUIRE( std::string::npos != pos );
+		return data.substr( pos + 6u, data.find( "\r\n", pos ) - pos - 6u );
+	};
+
+	const auto first = response.buffer( true );
+	const auto first_date = extract_date( *first );
+	REQUIRE_THAT( first_date, Catch::Matchers::EndsWith( " GMT" ) );
+
+	std::this_thread::sleep_for( std::chrono::milliseconds( 1100 ) );
+
+	const auto second = response.buffer( true );
+	REQUIRE( first != second );
+	REQUIRE( first_date != extract_date( *second ) );
+
+	// The old buffer is still valid.
+	REQUIRE( first_date == extract_date( *first ) );
+}
+
+TEST_CASE( "date field is added if server requires" , "[prepared_response][date]" )
+{
+	restinio::http_response_header_t header{ restinio::status_ok() };
+	header.set_field( "Server", "RESTinio utest server" );
+
+	const restinio::prepared_response_t response{ std::move( header ), "OK" };
+
+	auto conn = std::make_shared< capturing_connection_t >( 1u );
+	conn->m_always_add_date_field = true;
+
+	REQUIRE_NOTHROW( response.send( make_request( 1u, true, conn ) ) );
+
+	REQUIRE( 3u == conn->m_items_count );
+	REQUIRE( 15u == conn->m_status_line_size );
+	REQUIRE_THAT( conn->m_data,
+			Catch::Matchers::StartsWith(
+				"HTTP/1.1 200 OK\r\n"
+				"Connection: keep-alive\r\n"
+				"Content-Length: 2\r\n"
+				"Date: " ) );
+	REQUIRE_THAT( conn->m_data,
+			Catch::Matchers::EndsWith(
+				" GMT\r\n"
+				"Server: RESTinio utest server\r\n"
+				"\r\n"
+				"OK" ) );
+
+	// The shared buffer is not changed.
+	REQUIRE( std::string::npos == response.buffer( true )->find( "Date: " ) );
+}
+
+TEST_CASE( "response can be sent only once" , "[prepared_response][once]" )
+{
+	const restinio::prepared_response_t response{
+			restinio::http_response_header_t{ restinio::status_ok() },
+			"OK" };
+
+	auto conn = std::make_shared< capturing_connection_t >( 1u );
+	auto req = make_request( 1u, true, conn );
+
+	REQUIRE_NOTHROW( response.send( req ) );
+	REQUIRE_THROWS_AS( response.send( req ), restinio::exception_t );
+	REQUIRE_THROWS_AS( req->create_response(), restinio::exception_t );
+}
+
+TEST_CASE( "server with prepared response" , "[prepared_response][server]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	restinio::http_response_header_t header{ restinio::status_ok() };
+	header.set_field( restinio::http_field::content_type, "text/plain" );
+	header.set_field( restinio::http_field::date, "" );
+
+	auto prepared = std::make_shared< restinio::prepared_response_t >(
+			std::move( header ), "Prepared!" );
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[prepared]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.request_handler(
+					[prepared]( auto req ){
+						return prepared->send( req );
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	for( int i = 0; i != 3; ++i )
+	{
+		std::string response;
+		REQUIRE_NOTHROW( response = do_request(
+				"GET / HTTP/1.1\r\n"
+				"Host: 127.0.0.1\r\n"
+				"User-Agent: unit-test\r\n"
+				"Connection: close\r\n"
+				"\r\n" ) );
+
+		REQUIRE_THAT( response,
+				Catch::Matchers::StartsWith( "HTTP/1.1 200 OK\r\n" ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::Contains( "Connection: close\r\n" ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::Contains( "Content-Length: 9\r\n" ) );
+		REQUIRE_THAT( response,
+				Catch::Matchers::EndsWith( "Prepared!" ) );
+	}
+
+	other_thread.stop_and_join();
+}
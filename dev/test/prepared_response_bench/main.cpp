@@ -0,0 +1,96 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for prepared responses vs ordinary response builder.
+*/
+
+#include <restinio/all.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio;
+
+namespace
+{
+
+//! Connection that just looks at the data to be written.
+class null_connection_t : public impl::connection_base_t
+{
+public:
+	using impl::connection_base_t::connection_base_t;
+
+	void
+	write_response_parts(
+		request_id_t /*request_id*/,
+		response_output_flags_t /*response_output_flags*/,
+		write_group_t wg ) override
+	{
+		for( const auto & item : wg.items() )
+			microbench_consume( item.size() );
+	}
+
+	void
+	check_timeout(
+		std::shared_ptr< tcp_connection_ctx_base_t > & /*self*/ ) override
+	{}
+};
+
+request_handle_t
+make_request( const std::shared_ptr< null_connection_t > & conn )
+{
+	http_request_header_t header{ http_method_get(), "/health" };
+	header.should_keep_alive( true );
+
+	return std::make_shared< request_t >(
+			request_id_t{ 0u },
+			std::move( header ),
+			std::string{},
+			conn,
+			endpoint_t{} );
+}
+
+const char * const body =
+	"{\"status\":\"ok\",\"version\":\"1.0.0\"}";
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 1000000u );
+
+	auto conn = std::make_shared< null_connection_t >( 1u );
+
+	run_microbench( "make request only (baseline)", iterations,
+		[&] {
+			microbench_consume( make_request( conn )->request_id() );
+		} );
+
+	run_microbench( "response builder (3 fields + Date)", iterations,
+		[&] {
+			make_request( conn )->create_response()
+				.append_header( http_field::server, "RESTinio bench" )
+				.append_header( http_field::content_type, "application/json" )
+				.append_header( http_field::cache_control, "no-cache" )
+				.append_header_date_field()
+				.set_body( body )
+				.done();
+		} );
+
+	http_response_header_t header{ status_ok() };
+	header.set_field( http_field::server, "RESTinio bench" );
+	header.set_field( http_field::content_type, "application/json" );
+	header.set_field( http_field::cache_control, "no-cache" );
+	header.set_field( http_field::date, "" );
+
+	const prepared_response_t prepared{ std::move( header ), body };
+
+	run_microbench( "prepared response (3 fields + Date)", iterations,
+		[&] {
+			prepared.send( make_request( conn ) );
+		} );
+
+	return 0;
+}
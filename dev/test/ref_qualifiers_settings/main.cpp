@@ -162,6 +162,10 @@ TEST_CASE( "Ref-qualifiers" , "[settings][ref_qualifiers]" )
 
 
 			REQUIRE( settings.separate_accept_and_create_connect() );
+			REQUIRE( 1024u == settings.max_connections() );
+			REQUIRE( 128u == settings.connection_pool_capacity() );
+			REQUIRE( settings.release_idle_input_buffers() );
+			REQUIRE( settings.always_add_date_field() );
 		};
 
 	check_params(
@@ -186,5 +190,9 @@ TEST_CASE( "Ref-qualifiers" , "[settings][ref_qualifiers]" )
 				[&]( auto & ){
 					socket_options_lambda_was_called = true;
 				} )
-			.separate_accept_and_create_connect( true ) );
+			.separate_accept_and_create_connect( true )
+			.max_connections( 1024u )
+			.connection_pool_capacity( 128u )
+			.release_idle_input_buffers( true )
+			.always_add_date_field( true ) );
 }
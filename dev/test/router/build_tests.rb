@@ -14,6 +14,9 @@ MxxRu::Cpp::composite_target {
 	required_prj( "test/router/express_router/prj.ut.rb" )
 	required_prj( "test/router/express_router_bench/prj.rb" )
 
+	required_prj( "test/router/radix_router/prj.ut.rb" )
+	required_prj( "test/router/radix_router_bench/prj.rb" )
+
 	if RestinioPCREFind.has_pcre(toolset)
 		required_prj( "test/router/express_pcre/prj.ut.rb" )
 		required_prj( "test/router/express_router_pcre/prj.ut.rb" )
@@ -0,0 +1,273 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for radix router.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <iterator>
+
+#include <restinio/all.hpp>
+#include <restinio/router/radix_router.hpp>
+
+using namespace restinio;
+
+// The same tests as for express router.
+using express_router_t = restinio::router::radix_router_t<>;
+using restinio::router::route_params_t;
+
+#include "../express_router/tests.ipp"
+
+namespace
+{
+
+// Result of handling of a request by a router.
+struct handling_result_t
+{
+	int m_handler{ -1 };
+	std::string m_match;
+	std::vector< std::pair< std::string, std::string > > m_named;
+	std::vector< std::string > m_indexed;
+
+	bool
+	operator==( const handling_result_t & o ) const
+	{
+		return m_handler == o.m_handler && m_match == o.m_match &&
+				m_named == o.m_named && m_indexed == o.m_indexed;
+	}
+};
+
+std::ostream &
+operator<<( std::ostream & to, const handling_result_t & r )
+{
+	to << "{handler:" << r.m_handler << ", match:'" << r.m_match << "'";
+	for( const auto & p : r.m_named )
+		to << ", " << p.first << "='" << p.second << "'";
+	for( const auto & v : r.m_indexed )
+		to << ", '" << v << "'";
+	return to << "}";
+}
+
+struct route_info_t
+{
+	http_method_id_t m_method;
+	const char * m_path;
+	restinio::path2regex::options_t m_options;
+};
+
+const std::vector< route_info_t > &
+routes_for_comparison()
+{
+	using restinio::path2regex::options_t;
+
+	static const std::vector< route_info_t > routes{
+		{ http_method_get(), "/", {} },
+		{ http_method_get(), "/api/v1/users", {} },
+		{ http_method_post(), "/api/v1/users", {} },
+		{ http_method_get(), "/api/v1/users/:id(\\d+)", {} },
+		{ http_method_get(), "/api/v1/users/me", {} },
+		{ http_method_get(), "/api/v1/users/:name", {} },
+		{ http_method_get(), "/api/v1/users/:id(\\d+)/posts/:post", {} },
+		{ http_method_delete(), "/api/v1/users/:id/posts/:post", {} },
+		{ http_method_get(), "/api/v1/users/:id/posts/latest", {} },
+		{ http_method_get(), "/api/v1/:resource/:id([0-9a-f]{4})", {} },
+		{ http_method_get(), "/api/v1/items/:id?", {} },
+		{ http_method_get(), "/static/:file(.*)", {} },
+		{ http_method_get(), "/files/:name.:ext", {} },
+		{ http_method_get(), "/Case/Sensitive", options_t{}.sensitive( true ) },
+		{ http_method_get(), "/strict/", options_t{}.strict( true ) },
+		{ http_method_get(), "/prefix", options_t{}.ending( false ) },
+		{ http_method_get(), "/unnamed/(\\d+)", {} },
+		{ http_method_get(), "/api/v2/:a/:b/:c", {} },
+		{ http_method_get(), "/api/v2/x/:b/z", {} },
+		{ http_method_get(), "/api/v2/:a/y/:c(\\w+)", {} },
+		{ http_method_get(), "/range/:v([!-0]+)", {} },
+		{ http_method_get(), "/range/:v([a-z]+)/end", {} },
+	};
+
+	return routes;
+}
+
+template< typename Router >
+std::unique_ptr< Router >
+make_router_for_comparison( int & last_handler, route_params_t & last_params )
+{
+	auto router = std::make_unique< Router >();
+
+	const auto & routes = routes_for_comparison();
+	for( std::size_t i = 0u; i != routes.size(); ++i )
+	{
+		router->add_handler(
+			routes[ i ].m_method,
+			routes[ i ].m_path,
+			routes[ i ].m_options,
+			[&last_handler, &last_params, i]( auto, auto p ) {
+				last_handler = static_cast< int >( i );
+				last_params = std::move( p );
+				return request_accepted();
+			} );
+	}
+
+	return router;
+}
+
+template< typename Router >
+handling_result_t
+handle_request(
+	const Router & router,
+	int & last_handler,
+	route_params_t & last_params,
+	const std::string & target,
+	http_method_id_t method )
+{
+	using restinio::router::impl::route_params_accessor_t;
+
+	last_handler = -1;
+	last_params = route_params_t{};
+
+	handling_result_t result;
+	if( request_accepted() == router( create_fake_request( target, method ) ) )
+	{
+		result.m_handler = last_handler;
+		result.m_match = restinio::cast_to< std::string >( last_params.match() );
+		for( const auto & p :
+				route_params_accessor_t::named_parameters( last_params ) )
+			result.m_named.emplace_back(
+					restinio::cast_to< std::string >( p.first ),
+					restinio::cast_to< std::string >( p.second ) );
+		for( const auto & v :
+				route_params_accessor_t::indexed_parameters( last_params ) )
+			result.m_indexed.push_back( restinio::cast_to< std::string >( v ) );
+	}
+
+	return result;
+}
+
+} /* anonymous namespace */
+
+TEST_CASE( "Same results as express router" , "[radix][express]" )
+{
+	int express_handler = -1;
+	route_params_t express_params;
+	const auto express = make_router_for_comparison<
+			restinio::router::express_router_t<> >( express_handler, express_params );
+
+	int radix_handler = -1;
+	route_params_t radix_params;
+	const auto radix = make_router_for_comparison<
+			restinio::router::radix_router_t<> >( radix_handler, radix_params );
+
+	// Routes with optional params, partial segments, unnamed groups,
+	// patterns that can match '/' and non-default options.
+	REQUIRE( 8u == radix->regex_routes_count() );
+
+	const char * targets[] = {
+		"/", "//", "", "/api", "/api/v1/users", "/API/V1/Users/",
+		"/api/v1/users//", "/api/v1/users/42", "/api/v1/users/42/",
+		"/api/v1/users/me", "/api/v1/users/ME", "/api/v1/users/john",
+		"/api/v1/users/42/posts/7", "/api/v1/users/john/posts/7",
+		"/api/v1/users/42/posts/latest", "/api/v1/users/john/posts/latest",
+		"/api/v1/users/42/posts/", "/api/v1/users/42/posts//",
+		"/api/v1/orders/beef", "/api/v1/orders/BEEF", "/api/v1/orders/beefy",
+		"/api/v1/items", "/api/v1/items/", "/api/v1/items/5",
+		"/static/css/main.css", "/static/", "/files/a.txt", "/files/a",
+		"/Case/Sensitive", "/case/sensitive", "/strict/", "/strict",
+		"/prefix", "/prefix/and/more", "/prefixes",
+		"/unnamed/12", "/unnamed/ab",
+		"/api/v2/x/y/z", "/api/v2/x/q/z", "/api/v2/a/y/c", "/api/v2/a/y/c-d",
+		"/api/v2/%7Ex/y/z", "/api/v1/users/%34%32",
+		"/range/!-0", "/range/!/0", "/range/abc/end", "/range/a/b/end",
+		"/unknown/route"
+	};
+
+	const http_method_id_t methods[] = {
+		http_method_get(), http_method_post(), http_method_delete()
+	};
+
+	for( const auto * target : targets )
+		for( const auto & method : methods )
+		{
+			INFO( "target: '" << target << "', method: " << method.c_str() );
+
+			const auto expected = handle_request(
+					*express, express_handler, express_params, target, method );
+			const auto actual = handle_request(
+					*radix, radix_handler, radix_params, target, method );
+
+			REQUIRE( expected == actual );
+		}
+}
+
+TEST_CASE( "Order of routes is respected" , "[radix][order]" )
+{
+	restinio::router::radix_router_t<> router;
+
+	std::string last_handler;
+	const auto make_handler = [&]( std::string name ) {
+		return [&last_handler, name]( auto, auto ) {
+			last_handler = name;
+			return request_accepted();
+		};
+	};
+
+	// A route with a parameter is added before a static one,
+	// so it has a priority.
+	router.http_get( "/users/:id", make_handler( "param" ) );
+	router.http_get( "/users/all", make_handler( "static" ) );
+	router.http_get( "/users/all/details", make_handler( "static-details" ) );
+	router.http_get( "/users/:id/details", make_handler( "param-details" ) );
+
+	REQUIRE( request_accepted() == router( create_fake_request( "/users/all" ) ) );
+	REQUIRE( "param" == last_handler );
+
+	REQUIRE( request_accepted() == router(
+			create_fake_request( "/users/all/details" ) ) );
+	REQUIRE( "static-details" == last_handler );
+
+	REQUIRE( request_accepted() == router(
+			create_fake_request( "/users/42/details" ) ) );
+	REQUIRE( "param-details" == last_handler );
+
+	REQUIRE( request_rejected() == router(
+			create_fake_request( "/users/42/details", http_method_post() ) ) );
+}
+
+TEST_CASE( "Segment-local patterns" , "[radix][pattern]" )
+{
+	using restinio::router::radix_router::impl::is_segment_local_pattern;
+
+	REQUIRE( is_segment_local_pattern( "\\d+" ) );
+	REQUIRE( is_segment_local_pattern( "[0-9a-f]{4}" ) );
+	REQUIRE( is_segment_local_pattern( "[a-z\\-_]+" ) );
+	REQUIRE( is_segment_local_pattern( "[0-]" ) );
+	REQUIRE( is_segment_local_pattern( "[\\d-z]" ) );
+
+	REQUIRE_FALSE( is_segment_local_pattern( ".*" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[^0-9]+" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "\\D+" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "a\\/b" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[!-0]" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[a-z!-0]" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[\\!-\\0]" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[\\!-\\/]" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[/-9]" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[!-/]" ) );
+	REQUIRE_FALSE( is_segment_local_pattern( "[\\x00-\\x7F]" ) );
+}
+
+TEST_CASE( "Invalid routes" , "[radix][invalid]" )
+{
+	restinio::router::radix_router_t<> router;
+
+	const auto handler = []( auto, auto ) { return request_accepted(); };
+
+	REQUIRE_THROWS_AS( router.http_get( "/users/:id(\\d+", handler ),
+			restinio::exception_t );
+	REQUIRE_THROWS_AS( router.http_get( "/users/:id([0-9)", handler ),
+			restinio::exception_t );
+	REQUIRE_THROWS_AS( router.http_get( "/users/(", handler ),
+			restinio::exception_t );
+}
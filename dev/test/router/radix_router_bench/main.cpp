@@ -0,0 +1,145 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmark for matching of requests by routers with many routes.
+*/
+
+#include <restinio/all.hpp>
+#include <restinio/router/easy_parser_router.hpp>
+#include <restinio/router/radix_router.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio;
+
+#include "../fake_connection_and_request.ipp"
+
+namespace epr = restinio::router::easy_parser_router;
+
+namespace
+{
+
+// Count of resources. There are 4 routes for every resource.
+constexpr std::size_t resources_count = 100u;
+
+std::string
+resource_prefix( std::size_t r )
+{
+	return "/api/v1/res" + std::to_string( r );
+}
+
+template< typename Router >
+std::unique_ptr< Router >
+make_express_style_router()
+{
+	auto router = std::make_unique< Router >();
+	const auto handler = []( auto, auto ) { return request_accepted(); };
+
+	for( std::size_t r = 0u; r != resources_count; ++r )
+	{
+		const auto prefix = resource_prefix( r );
+
+		router->http_get( prefix, handler );
+		router->http_get( prefix + "/:id(\\d+)", handler );
+		router->http_put( prefix + "/:id(\\d+)", handler );
+		router->http_get( prefix + "/:id(\\d+)/items/:item", handler );
+	}
+
+	return router;
+}
+
+std::unique_ptr< router::easy_parser_router_t >
+make_easy_parser_router()
+{
+	auto router = std::make_unique< router::easy_parser_router_t >();
+	const auto id_p = epr::non_negative_decimal_number_p< std::uint32_t >();
+
+	for( std::size_t r = 0u; r != resources_count; ++r )
+	{
+		const auto prefix = resource_prefix( r );
+
+		router->http_get(
+				epr::path_to_params( prefix ),
+				[]( const auto & ) { return request_accepted(); } );
+		router->http_get(
+				epr::path_to_params( prefix + "/", id_p ),
+				[]( const auto &, auto ) { return request_accepted(); } );
+		router->http_put(
+				epr::path_to_params( prefix + "/", id_p ),
+				[]( const auto &, auto ) { return request_accepted(); } );
+		router->http_get(
+				epr::path_to_params(
+					prefix + "/", id_p, "/items/", epr::path_fragment_p() ),
+				[]( const auto &, auto, const auto & ) {
+					return request_accepted();
+				} );
+	}
+
+	return router;
+}
+
+std::vector< request_handle_t >
+make_requests()
+{
+	std::vector< request_handle_t > requests;
+
+	for( const auto r : { std::size_t{ 0u },
+			resources_count / 2u, resources_count - 1u } )
+	{
+		const auto prefix = resource_prefix( r );
+		requests.push_back( create_fake_request( prefix ) );
+		requests.push_back( create_fake_request( prefix + "/42" ) );
+		requests.push_back( create_fake_request( prefix + "/42/items/abc" ) );
+	}
+
+	// A request that doesn't match any route.
+	requests.push_back( create_fake_request( "/api/v1/unknown/42" ) );
+
+	return requests;
+}
+
+template< typename Router >
+void
+bench_router(
+	const std::string & name,
+	std::size_t iterations,
+	const Router & router,
+	const std::vector< request_handle_t > & requests )
+{
+	run_microbench( name, iterations,
+		[&] {
+			for( const auto & req : requests )
+				microbench_consume( request_accepted() == router( req ) );
+		} );
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 1000u );
+	const auto requests = make_requests();
+
+	fmt::print( "{} routes, {} requests per iteration\n",
+			resources_count * 4u, requests.size() );
+
+	bench_router( "express_router_t",
+			iterations,
+			*make_express_style_router< router::express_router_t<> >(),
+			requests );
+
+	bench_router( "easy_parser_router_t",
+			iterations,
+			*make_easy_parser_router(),
+			requests );
+
+	bench_router( "radix_router_t",
+			iterations,
+			*make_express_style_router< router::radix_router_t<> >(),
+			requests );
+
+	return 0;
+}
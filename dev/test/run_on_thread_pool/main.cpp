@@ -385,3 +385,106 @@ TEST_CASE( "run_async with automatic stop/wait" , "[run_async]" )
 
 	REQUIRE( "" != endpoint_value );
 }
+
+TEST_CASE( "sharded servers runner" , "[sharded_runner]" )
+{
+	using traits_t = restinio::single_thread_traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t >;
+
+	std::atomic<std::size_t> configurator_calls{ 0u };
+	std::atomic<std::size_t> requests_handled{ 0u };
+
+	restinio::sharded_servers_runner_t< traits_t > runner{
+		4u,
+		true,
+		[&]( auto & settings ){
+			++configurator_calls;
+
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.request_handler(
+					[&requests_handled]( auto req ){
+						++requests_handled;
+
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header_date_field()
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body(
+								restinio::const_buffer( req->header().method().c_str() ) )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	REQUIRE( 4u == configurator_calls );
+	REQUIRE( 4u == runner.size() );
+
+	std::promise<void> started;
+	runner.start(
+		[&started]() noexcept { started.set_value(); },
+		[&started]( std::exception_ptr ex ) noexcept {
+			started.set_exception( std::move(ex) );
+		} );
+	REQUIRE_NOTHROW( started.get_future().get() );
+
+	const char * request_str =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"User-Agent: unit-test\r\n"
+		"Accept: */*\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	for( int i = 0; i != 16; ++i )
+	{
+		std::string response;
+		REQUIRE_NOTHROW( response = repeat_request( request_str ) );
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "GET" ) );
+	}
+
+	runner.stop();
+	runner.wait();
+
+	REQUIRE( 16u == requests_handled );
+}
+
+TEST_CASE( "sharded servers runner with start failure" , "[sharded_runner]" )
+{
+	using traits_t = restinio::single_thread_traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t >;
+
+	// Occupy the port by an ordinary server without SO_REUSEPORT.
+	auto server_handle = restinio::run_async<traits_t>(
+		restinio::own_io_context(),
+		restinio::server_settings_t<traits_t>{}
+			.port( utest_default_port() )
+			.address( "127.0.0.1" )
+			.request_handler( []( auto ){ return restinio::request_rejected(); } ),
+		1 );
+
+	restinio::sharded_servers_runner_t< traits_t > runner{
+		2u,
+		false,
+		[]( auto & settings ){
+			settings
+				.port( utest_default_port() )
+				.address( "127.0.0.1" )
+				.request_handler( []( auto ){ return restinio::request_rejected(); } );
+		} };
+
+	std::promise<void> started;
+	runner.start(
+		[&started]() noexcept { started.set_value(); },
+		[&started]( std::exception_ptr ex ) noexcept {
+			started.set_exception( std::move(ex) );
+		} );
+	REQUIRE_THROWS( started.get_future().get() );
+
+	runner.wait();
+	REQUIRE( !runner.started() );
+}
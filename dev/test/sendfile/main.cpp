@@ -12,6 +12,10 @@
 
 #include <restinio/utils/at_scope_exit.hpp>
 
+#include <fstream>
+#include <future>
+#include <atomic>
+
 #include <test/common/utest_logger.hpp>
 #include <test/common/pub.hpp>
 
@@ -712,3 +716,278 @@ TEST_CASE( "sendfile with partially-read response" ,
 	other_thread.stop_and_join();
 }
 
+
+namespace
+{
+
+std::string
+read_whole_file( const char * file_name )
+{
+	std::ifstream f{ file_name, std::ios::binary };
+	return std::string{
+			std::istreambuf_iterator< char >{ f },
+			std::istreambuf_iterator< char >{} };
+}
+
+struct read_result_t
+{
+	restinio::asio_ns::error_code m_ec;
+	std::string m_data;
+};
+
+read_result_t
+read_by( restinio::async_file_reader_t & reader,
+	restinio::file_descriptor_t fd,
+	restinio::file_offset_t offset,
+	std::size_t size )
+{
+	std::unique_ptr< char[] > buffer{ new char[ size ] };
+	std::promise< read_result_t > promise;
+
+	reader.async_read( fd, offset, buffer.get(), size,
+		[&]( const restinio::asio_ns::error_code & ec, std::size_t n ) {
+			promise.set_value( read_result_t{ ec, std::string{ buffer.get(), n } } );
+		} );
+
+	return promise.get_future().get();
+}
+
+void
+check_file_reader( restinio::async_file_reader_t & reader )
+{
+	const auto expected = read_whole_file( "test/sendfile/f3.dat" );
+	auto sf = restinio::sendfile( "test/sendfile/f3.dat" );
+
+	{
+		const auto r = read_by( reader, sf.file_descriptor(), 0, expected.size() );
+		REQUIRE_FALSE( r.m_ec );
+		REQUIRE( expected == r.m_data );
+	}
+
+	{
+		const auto r = read_by( reader, sf.file_descriptor(), 1000, 4096 );
+		REQUIRE_FALSE( r.m_ec );
+		REQUIRE( expected.substr( 1000, 4096 ) == r.m_data );
+	}
+
+	{
+		const auto r = read_by( reader, sf.file_descriptor(),
+				static_cast< restinio::file_offset_t >( expected.size() ), 100 );
+		REQUIRE_FALSE( r.m_ec );
+		REQUIRE( r.m_data.empty() );
+	}
+
+	{
+		const auto r = read_by( reader, -1, 0, 100 );
+		REQUIRE( r.m_ec );
+	}
+
+	// Many requests at once.
+	{
+		constexpr std::size_t chunk = 1000u;
+		const std::size_t count = expected.size() / chunk;
+
+		std::vector< std::unique_ptr< char[] > > buffers;
+		std::vector< std::promise< std::size_t > > promises( count );
+		for( std::size_t i = 0u; i != count; ++i )
+		{
+			buffers.emplace_back( new char[ chunk ] );
+			reader.async_read(
+				sf.file_descriptor(),
+				static_cast< restinio::file_offset_t >( i * chunk ),
+				buffers.back().get(),
+				chunk,
+				[&promises, i]( const restinio::asio_ns::error_code & ec, std::size_t n ) {
+					promises[ i ].set_value( ec ? 0u : n );
+				} );
+		}
+
+		for( std::size_t i = 0u; i != count; ++i )
+		{
+			REQUIRE( chunk == promises[ i ].get_future().get() );
+			REQUIRE( expected.substr( i * chunk, chunk ) ==
+					std::string( buffers[ i ].get(), chunk ) );
+		}
+	}
+}
+
+} /* anonymous namespace */
+
+TEST_CASE( "async file readers" , "[sendfile][file_reader]" )
+{
+	SECTION( "thread pool" )
+	{
+		restinio::thread_pool_file_reader_t reader{ 2u };
+		check_file_reader( reader );
+	}
+
+#if defined( RESTINIO_HAS_IO_URING_FILE_READER )
+	SECTION( "io_uring" )
+	{
+		std::unique_ptr< restinio::io_uring_file_reader_t > reader;
+		try
+		{
+			reader.reset( new restinio::io_uring_file_reader_t{ 8u } );
+		}
+		catch( const std::exception & x )
+		{
+			WARN( "io_uring is not available: " << x.what() );
+		}
+
+		if( reader )
+		{
+			check_file_reader( *reader );
+
+			// Destruction waits for requests in flight.
+			auto sf = restinio::sendfile( "test/sendfile/f3.dat" );
+			constexpr std::size_t count = 32u;
+			char buffers[ count ][ 100 ];
+			std::atomic< std::size_t > completed{ 0u };
+			for( std::size_t i = 0u; i != count; ++i )
+				reader->async_read(
+					sf.file_descriptor(),
+					static_cast< restinio::file_offset_t >( i * 100u ),
+					buffers[ i ],
+					100u,
+					[&completed]( const restinio::asio_ns::error_code &, std::size_t ) {
+						++completed;
+					} );
+
+			reader.reset();
+			REQUIRE( count == completed.load() );
+
+			// async_read() doesn't block when CQ is full.
+			reader.reset( new restinio::io_uring_file_reader_t{ 1u } );
+
+			std::promise< void > release_handlers;
+			auto handlers_released = release_handlers.get_future().share();
+			std::atomic< std::size_t > bytes_read{ 0u };
+			for( std::size_t i = 0u; i != count; ++i )
+				reader->async_read(
+					sf.file_descriptor(),
+					static_cast< restinio::file_offset_t >( i * 100u ),
+					buffers[ i ],
+					100u,
+					[&bytes_read, handlers_released](
+						const restinio::asio_ns::error_code & ec, std::size_t n )
+					{
+						// The completion thread is stuck here, so there
+						// are no free slots in CQ until the release.
+						handlers_released.wait();
+						if( !ec )
+							bytes_read += n;
+					} );
+
+			release_handlers.set_value();
+			reader.reset();
+			REQUIRE( count * 100u == bytes_read.load() );
+
+			const auto expected = read_whole_file( "test/sendfile/f3.dat" );
+			for( std::size_t i = 0u; i != count; ++i )
+				REQUIRE( expected.substr( i * 100u, 100u ) ==
+						std::string( buffers[ i ], 100u ) );
+		}
+	}
+#endif
+
+	SECTION( "make_async_file_reader" )
+	{
+		auto reader = restinio::make_async_file_reader( 1u );
+		REQUIRE( reader );
+		check_file_reader( *reader );
+	}
+}
+
+TEST_CASE( "sendfile runner with async file reader" , "[sendfile][file_reader]" )
+{
+	using socket_t = restinio::asio_ns::local::stream_protocol::socket;
+	using runner_t = restinio::impl::sendfile_operation_runner_t< socket_t >;
+
+	const auto expected = read_whole_file( "test/sendfile/f3.dat" );
+	auto reader = restinio::make_async_file_reader( 2u );
+
+	const auto run = [&]( restinio::sendfile_t sf )
+	{
+		restinio::asio_ns::io_context io_context;
+		socket_t out{ io_context };
+		socket_t in{ io_context };
+		restinio::asio_ns::local::connect_pair( out, in );
+
+		sf.chunk_size( 4096 ).file_reader( reader );
+
+		restinio::asio_ns::error_code result_ec;
+		restinio::file_size_t result_size{ 0 };
+		bool completed = false;
+
+		auto runner = std::make_shared< runner_t >(
+				sf,
+				io_context.get_executor(),
+				out,
+				[&]( const restinio::asio_ns::error_code & ec,
+					restinio::file_size_t transfered ) {
+					REQUIRE_FALSE( completed );
+					completed = true;
+					result_ec = ec;
+					result_size = transfered;
+					out.close();
+				} );
+		runner->start();
+		runner.reset();
+
+		std::string received;
+		std::array< char, 1000 > buf;
+		std::function< void() > read_next = [&] {
+			in.async_read_some( restinio::asio_ns::buffer( buf ),
+				[&]( const restinio::asio_ns::error_code & ec, std::size_t n ) {
+					received.append( buf.data(), n );
+					if( !ec )
+						read_next();
+				} );
+		};
+		read_next();
+
+		io_context.run();
+
+		REQUIRE( completed );
+		return std::make_tuple( result_ec, result_size, received );
+	};
+
+	SECTION( "whole file" )
+	{
+		const auto r = run( restinio::sendfile( "test/sendfile/f3.dat" ) );
+		REQUIRE_FALSE( std::get<0>( r ) );
+		REQUIRE( expected.size() == std::get<1>( r ) );
+		REQUIRE( expected == std::get<2>( r ) );
+	}
+
+	SECTION( "part of file" )
+	{
+		const auto r = run(
+				restinio::sendfile( "test/sendfile/f3.dat" )
+					.offset_and_size( 12345, 54321 ) );
+		REQUIRE_FALSE( std::get<0>( r ) );
+		REQUIRE( 54321u == std::get<1>( r ) );
+		REQUIRE( expected.substr( 12345, 54321 ) == std::get<2>( r ) );
+	}
+
+	SECTION( "unexpected end of file" )
+	{
+		const char * file_name = "test/sendfile/truncated.dat";
+		{
+			std::ofstream f{ file_name, std::ios::binary };
+			f << expected;
+		}
+		auto file_remover = restinio::utils::at_scope_exit( [file_name] {
+				std::remove( file_name );
+			} );
+
+		auto sf = restinio::sendfile( file_name );
+		// The file is truncated after sendfile_t is created.
+		REQUIRE( 0 == ::truncate( file_name, 10000 ) );
+
+		const auto r = run( std::move( sf ) );
+		REQUIRE( std::get<0>( r ) );
+		REQUIRE( 10000u == std::get<1>( r ) );
+		REQUIRE( expected.substr( 0, 10000 ) == std::get<2>( r ) );
+	}
+}
@@ -0,0 +1,186 @@
+/*
+	restinio
+*/
+
+#include <catch2/catch.hpp>
+
+#include <restinio/utils/small_vector.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using restinio::utils::small_vector_t;
+
+namespace
+{
+
+//! Item that counts alive instances.
+class counted_t
+{
+	public:
+		static int & alive() { static int v = 0; return v; }
+
+		counted_t() : m_value{ std::make_unique< int >( 0 ) } { ++alive(); }
+		explicit counted_t( int v ) : m_value{ std::make_unique< int >( v ) } { ++alive(); }
+		counted_t( counted_t && o ) noexcept : m_value{ std::move( o.m_value ) } { ++alive(); }
+		counted_t & operator=( counted_t && o ) noexcept
+		{
+			m_value = std::move( o.m_value );
+			return *this;
+		}
+		~counted_t() { --alive(); }
+
+		int value() const { return m_value ? *m_value : -1; }
+
+	private:
+		std::unique_ptr< int > m_value;
+};
+
+template< std::size_t N >
+std::vector< int >
+values( const small_vector_t< counted_t, N > & v )
+{
+	std::vector< int > result;
+	for( const auto & i : v )
+		result.push_back( i.value() );
+	return result;
+}
+
+} /* namespace anonymous */
+
+TEST_CASE( "inline and dynamic storage" , "[small_vector][storage]" )
+{
+	{
+		small_vector_t< counted_t, 2 > v;
+		REQUIRE( v.empty() );
+		REQUIRE( 2u == v.capacity() );
+		REQUIRE_FALSE( v.is_dynamic() );
+
+		v.emplace_back( 1 );
+		v.emplace_back( 2 );
+		REQUIRE_FALSE( v.is_dynamic() );
+		REQUIRE( 2 == counted_t::alive() );
+
+		v.emplace_back( 3 );
+		REQUIRE( v.is_dynamic() );
+		REQUIRE( 4u == v.capacity() );
+		REQUIRE( 3 == counted_t::alive() );
+		REQUIRE( ( std::vector< int >{ 1, 2, 3 } ) == values( v ) );
+
+		REQUIRE( 1 == v.front().value() );
+		REQUIRE( 3 == v.back().value() );
+		REQUIRE( 2 == v[ 1 ].value() );
+
+		v.clear();
+		REQUIRE( v.empty() );
+		REQUIRE( v.is_dynamic() );
+		REQUIRE( 0 == counted_t::alive() );
+
+		v.emplace_back( 4 );
+	}
+
+	REQUIRE( 0 == counted_t::alive() );
+}
+
+TEST_CASE( "move" , "[small_vector][move]" )
+{
+	{
+		small_vector_t< counted_t, 2 > v1;
+		v1.emplace_back( 1 );
+		v1.emplace_back( 2 );
+
+		small_vector_t< counted_t, 2 > v2{ std::move( v1 ) };
+		REQUIRE( v1.empty() );
+		REQUIRE( ( std::vector< int >{ 1, 2 } ) == values( v2 ) );
+		REQUIRE( 2 == counted_t::alive() );
+
+		v2.emplace_back( 3 );
+		const auto * data = v2.data();
+
+		small_vector_t< counted_t, 2 > v3;
+		v3.emplace_back( 10 );
+		v3 = std::move( v2 );
+		REQUIRE( data == v3.data() );
+		REQUIRE( v2.empty() );
+		REQUIRE_FALSE( v2.is_dynamic() );
+		REQUIRE( ( std::vector< int >{ 1, 2, 3 } ) == values( v3 ) );
+		REQUIRE( 3 == counted_t::alive() );
+
+		v2.emplace_back( 5 );
+		swap( v2, v3 );
+		REQUIRE( ( std::vector< int >{ 1, 2, 3 } ) == values( v2 ) );
+		REQUIRE( ( std::vector< int >{ 5 } ) == values( v3 ) );
+	}
+
+	REQUIRE( 0 == counted_t::alive() );
+}
+
+TEST_CASE( "resize, reserve and erase" , "[small_vector][modify]" )
+{
+	{
+		small_vector_t< counted_t, 4 > v;
+		v.resize( 3 );
+		REQUIRE( ( std::vector< int >{ 0, 0, 0 } ) == values( v ) );
+		REQUIRE_FALSE( v.is_dynamic() );
+
+		v.resize( 1 );
+		REQUIRE( 1 == counted_t::alive() );
+
+		v.reserve( 10 );
+		REQUIRE( v.is_dynamic() );
+		REQUIRE( 10u == v.capacity() );
+
+		v[ 0 ] = counted_t{ 1 };
+		v.push_back( counted_t{ 2 } );
+		v.emplace_back( 3 );
+		v.emplace_back( 4 );
+
+		auto it = v.erase( v.begin() + 1 );
+		REQUIRE( 3 == it->value() );
+		REQUIRE( ( std::vector< int >{ 1, 3, 4 } ) == values( v ) );
+
+		v.erase( v.begin() );
+		REQUIRE( ( std::vector< int >{ 3, 4 } ) == values( v ) );
+
+		v.pop_back();
+		REQUIRE( ( std::vector< int >{ 3 } ) == values( v ) );
+		REQUIRE( 1 == counted_t::alive() );
+	}
+
+	REQUIRE( 0 == counted_t::alive() );
+}
+
+TEST_CASE( "back_inserter" , "[small_vector][back_inserter]" )
+{
+	small_vector_t< std::string, 1 > v;
+	const std::string src[] = { "a", "b", "c" };
+
+	std::copy( std::begin( src ), std::end( src ), std::back_inserter( v ) );
+
+	REQUIRE( 3u == v.size() );
+	REQUIRE( "a" == v[ 0 ] );
+	REQUIRE( "c" == v[ 2 ] );
+}
+
+TEST_CASE( "push an item of the container itself" , "[small_vector][self]" )
+{
+	small_vector_t< std::string, 2 > v;
+	v.push_back( "first item that doesn't fit into SSO buffer" );
+	v.push_back( "second" );
+	REQUIRE_FALSE( v.is_dynamic() );
+
+	// Storage grows on this call.
+	v.push_back( v[ 0 ] );
+	REQUIRE( v.is_dynamic() );
+	REQUIRE( v[ 0 ] == v[ 2 ] );
+
+	v.push_back( v[ 1 ] );
+	REQUIRE( "second" == v[ 3 ] );
+
+	// Storage grows again.
+	v.emplace_back( v[ 3 ], 0u, 3u );
+	REQUIRE( 8u == v.capacity() );
+	REQUIRE( "sec" == v[ 4 ] );
+}
@@ -0,0 +1,11 @@
+require 'mxx_ru/cpp'
+
+MxxRu::Cpp::exe_target {
+
+	required_prj 'test/catch_main/prj.rb'
+
+	target( "_unit.test.small_vector" )
+
+	cpp_source( "main.cpp" )
+}
+
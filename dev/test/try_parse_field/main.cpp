@@ -9,6 +9,10 @@
 
 #include <test/common/dummy_connection.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace std::string_literals;
 
 RESTINIO_NODISCARD
@@ -281,3 +285,179 @@ TEST_CASE( "Normal Content-Encoding field with get_if", "[try_parse_field]" )
 	}
 }
 
+
+namespace
+{
+
+// A type that counts calls of try_parse.
+struct counting_value_t
+{
+	static std::atomic< int > parse_calls;
+
+	std::string value;
+
+	static restinio::expected_t<
+			counting_value_t, restinio::easy_parser::parse_error_t >
+	try_parse( restinio::string_view_t what )
+	{
+		++parse_calls;
+		if( what.empty() )
+			return restinio::make_unexpected(
+					restinio::easy_parser::parse_error_t{
+						0u,
+						restinio::easy_parser::error_reason_t::unexpected_eof } );
+
+		return counting_value_t{ std::string{ what.data(), what.size() } };
+	}
+};
+
+std::atomic< int > counting_value_t::parse_calls{ 0 };
+
+} /* anonymous namespace */
+
+TEST_CASE( "Parsed values of fields are cached", "[parsed]" )
+{
+	using namespace restinio::http_field_parsers;
+
+	counting_value_t::parse_calls = 0;
+
+	restinio::http_request_header_t header{
+			restinio::http_method_post(),
+			"/"
+	};
+	header.set_field(
+			restinio::http_field::content_encoding,
+			"UTF-8"s );
+
+	REQUIRE( nullptr == header.parsed< content_encoding_value_t >(
+			restinio::http_field::content_type ) );
+	REQUIRE( nullptr == header.parsed< counting_value_t >(
+			restinio::http_field::content_type ) );
+	REQUIRE( 0 == counting_value_t::parse_calls );
+
+	const auto ce = header.parsed< content_encoding_value_t >(
+			restinio::http_field::content_encoding );
+	REQUIRE( ce );
+	REQUIRE( *ce );
+	REQUIRE( std::vector<std::string>{ "utf-8"s } == (*ce)->values );
+
+	SECTION( "the same result for every call" )
+	{
+		const auto v1 = header.parsed< counting_value_t >(
+				restinio::http_field::content_encoding );
+		REQUIRE( v1 );
+		REQUIRE( *v1 );
+		REQUIRE( "UTF-8" == (*v1)->value );
+		REQUIRE( 1 == counting_value_t::parse_calls );
+
+		for( int i = 0; i != 10; ++i )
+		{
+			REQUIRE( v1 == header.parsed< counting_value_t >(
+					restinio::http_field::content_encoding ) );
+			REQUIRE( v1 == header.parsed< counting_value_t >(
+					"content-encoding" ) );
+		}
+		REQUIRE( 1 == counting_value_t::parse_calls );
+
+		// Value of another type isn't affected.
+		REQUIRE( ce == header.parsed< content_encoding_value_t >(
+				restinio::http_field::content_encoding ) );
+	}
+
+	SECTION( "modified field is parsed again" )
+	{
+		const auto old_value = header.parsed< counting_value_t >(
+				restinio::http_field::content_encoding );
+		REQUIRE( "UTF-8" == (*old_value)->value );
+
+		// The same size of the value.
+		header.set_field(
+				restinio::http_field::content_encoding,
+				"GZIP!"s );
+		REQUIRE( "GZIP!" == (*header.parsed< counting_value_t >(
+				restinio::http_field::content_encoding ))->value );
+		REQUIRE( 2 == counting_value_t::parse_calls );
+
+		// The value received before the modification is still valid.
+		REQUIRE( "UTF-8" == (*old_value)->value );
+
+		header.remove_field( restinio::http_field::content_encoding );
+		REQUIRE( nullptr == header.parsed< counting_value_t >(
+				restinio::http_field::content_encoding ) );
+		REQUIRE( 2 == counting_value_t::parse_calls );
+	}
+
+	SECTION( "parse errors are cached too" )
+	{
+		header.set_field( "X-Empty", std::string{} );
+
+		const auto v = header.parsed< counting_value_t >( "X-Empty" );
+		REQUIRE( v );
+		REQUIRE( !*v );
+		REQUIRE( 1 == counting_value_t::parse_calls );
+
+		REQUIRE( v == header.parsed< counting_value_t >( "x-empty" ) );
+		REQUIRE( 1 == counting_value_t::parse_calls );
+	}
+
+	SECTION( "fields with custom names" )
+	{
+		header.set_field( "X-First", "first"s );
+		header.set_field( "X-Second", "second"s );
+
+		REQUIRE( "first" == (*header.parsed< counting_value_t >(
+				"X-First" ))->value );
+		REQUIRE( "second" == (*header.parsed< counting_value_t >(
+				"X-Second" ))->value );
+		REQUIRE( "first" == (*header.parsed< counting_value_t >(
+				"x-first" ))->value );
+		REQUIRE( 2 == counting_value_t::parse_calls );
+
+		REQUIRE( nullptr == header.parsed< counting_value_t >( "X-Third" ) );
+	}
+
+	SECTION( "parallel access" )
+	{
+		using value_ptr_t = std::shared_ptr<
+				const restinio::impl::parsed_field_value_t< counting_value_t > >;
+
+		const auto & const_header = header;
+
+		std::vector< value_ptr_t > results( 8u );
+		std::vector< std::thread > threads;
+		for( auto & r : results )
+			threads.emplace_back( [&const_header, &r] {
+					for( int i = 0; i != 1000; ++i )
+						r = const_header.parsed< counting_value_t >(
+								restinio::http_field::content_encoding );
+				} );
+
+		for( auto & t : threads )
+			t.join();
+
+		// The value can be parsed by several threads at the same time,
+		// but only one result is stored and returned to all of them.
+		REQUIRE( 1 <= counting_value_t::parse_calls );
+		REQUIRE( counting_value_t::parse_calls <= 8 );
+		for( const auto & r : results )
+			REQUIRE( results.front() == r );
+		REQUIRE( "UTF-8" == (*results.front())->value );
+	}
+
+	SECTION( "access via request" )
+	{
+		auto req = std::make_shared< restinio::request_t >(
+				restinio::request_id_t{1},
+				std::move(header),
+				"Body"s,
+				dummy_connection_t::make(1u),
+				make_dummy_endpoint() );
+
+		const auto v = req->header().parsed< content_encoding_value_t >(
+				restinio::http_field::content_encoding );
+		REQUIRE( v );
+		REQUIRE( std::vector<std::string>{ "utf-8"s } == (*v)->values );
+		REQUIRE( v == req->header().parsed< content_encoding_value_t >(
+				restinio::http_field::content_encoding ) );
+	}
+}
@@ -1188,3 +1188,112 @@ TEST_CASE( "Query string with only web-beacon" , "[web-beacon]" )
 	}
 }
 
+
+namespace
+{
+
+using params_vector_t = std::vector< std::pair< std::string, std::string > >;
+
+// Collect params by for_each_query_param and by parse_query and
+// compare the results.
+template< typename Traits >
+void
+check_for_each_query_param( string_view_t query )
+{
+	INFO( "query: " << query );
+
+	auto expected = try_parse_query< Traits >( query );
+
+	params_vector_t actual_params;
+	std::string scratch;
+	const auto actual = try_for_each_query_param< Traits >( query, scratch,
+		[&]( string_view_t name, string_view_t value ) {
+			actual_params.emplace_back(
+					std::string{ name.data(), name.size() },
+					std::string{ value.data(), value.size() } );
+		} );
+
+	REQUIRE( static_cast<bool>(expected) == static_cast<bool>(actual) );
+	if( !expected )
+	{
+		REQUIRE( expected.error().description() == actual.error().description() );
+		return;
+	}
+
+	params_vector_t expected_params;
+	for( const auto & p : *expected )
+		expected_params.emplace_back(
+				std::string{ p.first.data(), p.first.size() },
+				std::string{ p.second.data(), p.second.size() } );
+	if( expected->tag() )
+		expected_params.emplace_back(
+				std::string{ expected->tag()->data(), expected->tag()->size() },
+				std::string{} );
+
+	REQUIRE( expected_params.size() == *actual );
+	REQUIRE( expected_params == actual_params );
+}
+
+} /* anonymous namespace */
+
+TEST_CASE( "for_each_query_param" , "[for_each_query_param]" )
+{
+	using default_traits = restinio::parse_query_traits::restinio_defaults;
+	using js_comp_traits = restinio::parse_query_traits::javascript_compatible;
+	using form_traits = restinio::parse_query_traits::x_www_form_urlencoded;
+	using relaxed_traits = restinio::parse_query_traits::relaxed;
+
+	const char * queries[] = {
+		"",
+		"a=b",
+		"a=",
+		"=b",
+		"=",
+		"a=b&c=d;e=f",
+		"a=b&&c=d",
+		"a=b&",
+		"q=hello+world&lang=en-US&page=2&size=50&sort=-date",
+		"name=%D0%98%D0%B2%D0%B0%D0%BD&city=New%20York&plain=value",
+		"param%00=123",
+		"param+=123",
+		"a=(&b=)&c=[&d=]&e=!&f=,&g=;",
+		"name=A*&flags=!",
+		"a=%2",
+		"a=%zz",
+		"a=%D0",
+		"a=b&123456",
+		"123456",
+		"12%33+456",
+		"a=b=c",
+	};
+
+	for( const auto q : queries )
+	{
+		check_for_each_query_param< default_traits >( q );
+		check_for_each_query_param< js_comp_traits >( q );
+		check_for_each_query_param< form_traits >( q );
+		check_for_each_query_param< relaxed_traits >( q );
+	}
+
+	SECTION( "views into the query string" )
+	{
+		const string_view_t query{ "a=1&b=2" };
+
+		const auto count = for_each_query_param( query,
+			[&]( string_view_t name, string_view_t value ) {
+				REQUIRE( query.data() <= name.data() );
+				REQUIRE( name.data() + name.size() <= query.data() + query.size() );
+				REQUIRE( query.data() <= value.data() );
+				REQUIRE( value.data() + value.size() <= query.data() + query.size() );
+			} );
+		REQUIRE( 2u == count );
+	}
+
+	SECTION( "exception on failure" )
+	{
+		std::size_t calls{};
+		REQUIRE_THROWS( for_each_query_param( "a=b&c=%zz",
+			[&]( string_view_t, string_view_t ) { ++calls; } ) );
+		REQUIRE( 1u == calls );
+	}
+}
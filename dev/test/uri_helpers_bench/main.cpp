@@ -0,0 +1,82 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for parsing of query strings.
+*/
+
+#include <restinio/uri_helpers.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio;
+
+namespace
+{
+
+//! Make a query string with @a count params.
+std::string
+make_query( std::size_t count, bool escaped )
+{
+	std::string result;
+	for( std::size_t i = 0u; i != count; ++i )
+	{
+		if( i )
+			result += '&';
+		result += "param";
+		result += std::to_string( i );
+		result += escaped ? "=some%20value+" : "=some-value-";
+		result += std::to_string( i );
+	}
+
+	return result;
+}
+
+void
+run_for_query( const char * name, std::size_t iterations, const std::string & query )
+{
+	const std::string prefix = std::string{ name } + ": ";
+
+	run_microbench( prefix + "parse_query", iterations,
+		[&] {
+			microbench_consume( parse_query( query ).size() );
+		} );
+
+	{
+		std::string scratch;
+		run_microbench( prefix + "try_for_each_query_param (reused scratch)", iterations,
+			[&] {
+				std::size_t total{};
+				const auto r = try_for_each_query_param< parse_query_traits::restinio_defaults >(
+						query, scratch,
+						[&]( string_view_t n, string_view_t v ) {
+							total += n.size() + v.size();
+						} );
+				microbench_consume( *r + total );
+			} );
+	}
+
+	run_microbench( prefix + "for_each_query_param", iterations,
+		[&] {
+			std::size_t total{};
+			microbench_consume( for_each_query_param( query,
+					[&]( string_view_t n, string_view_t v ) {
+						total += n.size() + v.size();
+					} ) + total );
+		} );
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 200000u );
+
+	run_for_query( "40 plain params", iterations, make_query( 40u, false ) );
+	run_for_query( "40 escaped params", iterations, make_query( 40u, true ) );
+	run_for_query( "3 plain params", iterations * 10u, make_query( 3u, false ) );
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for masking/unmasking of websocket payload.
+*/
+
+#include <restinio/all.hpp>
+#include <restinio/websocket/impl/ws_parser.hpp>
+#include <restinio/websocket/impl/ws_protocol_validator.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio::websocket::basic;
+using namespace restinio::websocket::basic::impl;
+
+namespace
+{
+
+const std::uint32_t masking_key = 0x37FA213D;
+
+raw_data_t
+make_payload( std::size_t size )
+{
+	raw_data_t result;
+	result.reserve( size );
+	for( std::size_t i = 0u; i != size; ++i )
+		result.push_back( static_cast< char >( i * 7u + 3u ) );
+
+	return result;
+}
+
+// The implementation used before v.0.6.9.
+void
+mask_unmask_payload_bytewise( std::uint32_t key, raw_data_t & payload )
+{
+	using namespace ::restinio::utils::impl::bitops;
+
+	const std::size_t MASK_SIZE = 4;
+	const uint8_t mask[ MASK_SIZE ] = {
+		n_bits_from< std::uint8_t, 24 >(key),
+		n_bits_from< std::uint8_t, 16 >(key),
+		n_bits_from< std::uint8_t, 8 >(key),
+		n_bits_from< std::uint8_t, 0 >(key),
+	};
+
+	const auto payload_size = payload.size();
+	for( std::size_t i = 0; i < payload_size; )
+	{
+		for( std::size_t j = 0; j < MASK_SIZE && i < payload_size; ++j, ++i )
+		{
+			payload[ i ] ^= mask[ j ];
+		}
+	}
+}
+
+void
+run_kernel_bench(
+	const std::string & name,
+	std::size_t iterations,
+	raw_data_t & payload,
+	mask_impl::kernel_t kernel )
+{
+	const mask_impl::mask_bytes_t mask{ { 0x37, 0xFA, 0x21, 0x3D } };
+
+	run_microbench( name, iterations,
+		[&] {
+			(*kernel)( mask,
+					reinterpret_cast< unsigned char * >( &payload[ 0 ] ),
+					payload.size() );
+			microbench_consume( payload[ payload.size() / 2u ] );
+		} );
+}
+
+void
+run_benches_for_size( std::size_t payload_size, std::size_t iterations )
+{
+	auto payload = make_payload( payload_size );
+	const auto suffix = fmt::format( " ({} bytes)", payload_size );
+
+	run_microbench( "old byte-by-byte loop" + suffix, iterations,
+		[&] {
+			mask_unmask_payload_bytewise( masking_key, payload );
+			microbench_consume( payload[ payload.size() / 2u ] );
+		} );
+
+	run_kernel_bench( "kernel: bytewise" + suffix, iterations,
+			payload, &mask_impl::mask_bytewise );
+	run_kernel_bench( "kernel: words" + suffix, iterations,
+			payload, &mask_impl::mask_words );
+#if defined(RESTINIO_WEBSOCKET_SSE2_MASK)
+	run_kernel_bench( "kernel: sse2" + suffix, iterations,
+			payload, &mask_impl::mask_sse2 );
+#endif
+#if defined(RESTINIO_WEBSOCKET_AVX2_MASK)
+	if( __builtin_cpu_supports( "avx2" ) )
+		run_kernel_bench( "kernel: avx2" + suffix, iterations,
+				payload, &mask_impl::mask_avx2 );
+#endif
+
+	run_microbench( "mask_unmask_payload" + suffix, iterations,
+		[&] {
+			mask_unmask_payload( masking_key, payload );
+			microbench_consume( payload[ payload.size() / 2u ] );
+		} );
+
+	// Payload comes by parts of arbitrary sizes.
+	run_microbench( "unmasker_t::unmask, 1000 byte parts" + suffix,
+		iterations,
+		[&] {
+			unmasker_t unmasker{ masking_key };
+			for( std::size_t pos = 0u; pos < payload.size(); pos += 1000u )
+				unmasker.unmask( &payload[ pos ],
+						std::min< std::size_t >( 1000u, payload.size() - pos ) );
+			microbench_consume( payload[ payload.size() / 2u ] );
+		} );
+
+	// Binary frame goes through the validator.
+	run_microbench( "validator: binary frame" + suffix, iterations,
+		[&] {
+			ws_protocol_validator_t validator{ true };
+			validator.process_new_frame( message_details_t{
+					final_frame, opcode_t::binary_frame,
+					payload.size(), masking_key } );
+			validator.process_and_unmask_next_payload_part(
+					&payload[ 0 ], payload.size() );
+			microbench_consume( static_cast< int >( validator.finish_frame() ) );
+		} );
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 100000u );
+
+	run_benches_for_size( 125u, iterations * 10u );
+	run_benches_for_size( 4096u, iterations );
+	run_benches_for_size( 1024u * 1024u, iterations / 1000u );
+
+	return 0;
+}
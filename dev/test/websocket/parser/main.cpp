@@ -97,6 +97,78 @@ TEST_CASE( "Validate mask and unmask operations" , "[websocket][parser][mask]" )
 	REQUIRE( bin_data == unmasked_bin_data_etalon );
 }
 
+TEST_CASE( "Mask kernels" , "[websocket][parser][mask][kernels]" )
+{
+	const mask_impl::mask_bytes_t mask{ { 0x37, 0xFA, 0x21, 0x3D } };
+
+	std::vector< mask_impl::kernel_t > kernels{
+		&mask_impl::mask_words,
+		mask_impl::best_kernel()
+	};
+#if defined(RESTINIO_WEBSOCKET_SSE2_MASK)
+	kernels.push_back( &mask_impl::mask_sse2 );
+#if !defined(RESTINIO_WEBSOCKET_PREFER_AVX2_MASK)
+	// SSE2 kernel is the default one.
+	REQUIRE( &mask_impl::mask_sse2 == mask_impl::best_kernel() );
+#endif
+#endif
+#if defined(RESTINIO_WEBSOCKET_AVX2_MASK)
+	if( __builtin_cpu_supports( "avx2" ) )
+		kernels.push_back( &mask_impl::mask_avx2 );
+#endif
+
+	raw_data_t source;
+	for( std::size_t i = 0u; i != 300u; ++i )
+		source.push_back( static_cast< char >( i * 7u + 3u ) );
+
+	for( std::size_t size = 0u; size != source.size(); ++size )
+	{
+		// Data at different offsets to check unaligned access.
+		for( std::size_t offset = 0u; offset != 3u; ++offset )
+		{
+			raw_data_t etalon = source.substr( 0u, offset + size );
+			mask_impl::mask_bytewise( mask,
+					reinterpret_cast< unsigned char * >( &etalon[ offset ] ),
+					size );
+
+			for( auto kernel : kernels )
+			{
+				raw_data_t data = source.substr( 0u, offset + size );
+				(*kernel)( mask,
+						reinterpret_cast< unsigned char * >( &data[ offset ] ),
+						size );
+
+				REQUIRE( etalon == data );
+			}
+		}
+	}
+}
+
+TEST_CASE( "Mask payload by parts" , "[websocket][parser][mask][parts]" )
+{
+	const std::uint32_t mask_key = 0x37FA213D;
+	const mask_impl::mask_bytes_t mask{ { 0x37, 0xFA, 0x21, 0x3D } };
+
+	raw_data_t source;
+	for( std::size_t i = 0u; i != 1000u; ++i )
+		source.push_back( static_cast< char >( i * 13u + 1u ) );
+
+	raw_data_t etalon = source;
+	mask_unmask_payload( mask_key, etalon );
+
+	for( std::size_t part_size : { 1u, 3u, 5u, 17u, 33u, 100u, 999u } )
+	{
+		raw_data_t data = source;
+		for( std::size_t pos = 0u; pos < data.size(); pos += part_size )
+		{
+			const auto n = std::min( part_size, data.size() - pos );
+			mask_unmask_payload_part( mask, pos, &data[ pos ], n );
+		}
+
+		REQUIRE( etalon == data );
+	}
+}
+
 TEST_CASE( "Reset parser" , "[websocket][parser][reset]" )
 {
 	raw_data_t bin_data{ to_char_each({0x81, 0x05}) };
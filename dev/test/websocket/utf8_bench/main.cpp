@@ -0,0 +1,114 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for validation of UTF-8 payload of websocket text frames.
+*/
+
+#include <restinio/all.hpp>
+#include <restinio/websocket/impl/ws_protocol_validator.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio::websocket::basic;
+using namespace restinio::websocket::basic::impl;
+
+namespace
+{
+
+// Mostly ASCII text (like JSON) with rare non-ASCII symbols.
+std::string
+make_ascii_heavy_text( std::size_t size )
+{
+	const std::string chunk{
+		"{\"id\":12345,\"name\":\"R\xc3\xa9sum\xc3\xa9\",\"tags\":[\"alpha\","
+		"\"beta\",\"gamma\"],\"value\":3.1415926,\"active\":true}," };
+
+	std::string result;
+	while( result.size() + chunk.size() <= size )
+		result += chunk;
+	result.append( size - result.size(), ' ' );
+
+	return result;
+}
+
+// Text with CJK symbols (3-byte sequences) mixed with some ASCII.
+std::string
+make_cjk_heavy_text( std::size_t size )
+{
+	// "日本語のテキスト, " in UTF-8.
+	const std::string chunk{
+		"\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae"
+		"\xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88, " };
+
+	std::string result;
+	while( result.size() + chunk.size() <= size )
+		result += chunk;
+	result.append( size - result.size(), ' ' );
+
+	return result;
+}
+
+void
+run_benches_for_text(
+	const std::string & text_name,
+	const std::string & text,
+	std::size_t iterations )
+{
+	const auto suffix = fmt::format( " ({}, {} bytes)", text_name, text.size() );
+	const auto * data = reinterpret_cast< const std::uint8_t * >( text.data() );
+
+	run_microbench( "process_byte" + suffix, iterations,
+		[&] {
+			restinio::utils::utf8_checker_t checker;
+			bool ok = true;
+			for( std::size_t i = 0u; ok && i != text.size(); ++i )
+				ok = checker.process_byte( data[ i ] );
+			microbench_consume( ok && checker.finalized() );
+		} );
+
+	run_microbench( "process_bytes" + suffix, iterations,
+		[&] {
+			restinio::utils::utf8_checker_t checker;
+			const bool ok = checker.process_bytes( data, text.size() );
+			microbench_consume( ok && checker.finalized() );
+		} );
+
+	// Payload comes by parts that cut multi-byte symbols.
+	run_microbench( "process_bytes by 1001 bytes parts" + suffix, iterations,
+		[&] {
+			restinio::utils::utf8_checker_t checker;
+			bool ok = true;
+			for( std::size_t pos = 0u; ok && pos < text.size(); pos += 1001u )
+				ok = checker.process_bytes( data + pos,
+						std::min< std::size_t >( 1001u, text.size() - pos ) );
+			microbench_consume( ok && checker.finalized() );
+		} );
+
+	// Unmasked text frame goes through the validator.
+	std::string payload = text;
+	run_microbench( "validator: text frame" + suffix, iterations,
+		[&] {
+			ws_protocol_validator_t validator{ false };
+			validator.process_new_frame( message_details_t{
+					final_frame, opcode_t::text_frame,
+					payload.size(), 0x37FA213Du } );
+			validator.process_and_unmask_next_payload_part(
+					&payload[ 0 ], payload.size() );
+			microbench_consume( static_cast< int >( validator.finish_frame() ) );
+		} );
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 10000u );
+
+	run_benches_for_text( "ascii", make_ascii_heavy_text( 16384u ), iterations );
+	run_benches_for_text( "cjk", make_cjk_heavy_text( 16384u ), iterations );
+
+	return 0;
+}
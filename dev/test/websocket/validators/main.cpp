@@ -119,6 +119,118 @@ TEST_CASE(
 	}
 }
 
+namespace
+{
+
+// Result of checking by process_byte().
+bool
+utf8_check_byte_by_byte( const std::string & str )
+{
+	restinio::utils::utf8_checker_t checker;
+	for( const auto ch : str )
+		if( !checker.process_byte( static_cast<std::uint8_t>(ch) ) )
+			return false;
+
+	return checker.finalized();
+}
+
+// Result of checking by process_bytes() with a split at the specified pos.
+bool
+utf8_check_by_parts( const std::string & str, std::size_t split_pos )
+{
+	const auto * data = reinterpret_cast<const std::uint8_t *>( str.data() );
+
+	restinio::utils::utf8_checker_t checker;
+	if( !checker.process_bytes( data, split_pos ) )
+		return false;
+	if( !checker.process_bytes( data + split_pos, str.size() - split_pos ) )
+		return false;
+
+	return checker.finalized();
+}
+
+// Count of split positions for which results are different.
+std::size_t
+utf8_count_mismatches( const std::string & str )
+{
+	const bool expected = utf8_check_byte_by_byte( str );
+
+	std::size_t result = 0u;
+	for( std::size_t pos = 0u; pos <= str.size(); ++pos )
+		if( expected != utf8_check_by_parts( str, pos ) )
+			++result;
+
+	return result;
+}
+
+} /* anonymous namespace */
+
+TEST_CASE(
+	"UTF-8 check by parts" ,
+	"[validators][utf-8][process_bytes]" )
+{
+	SECTION( "all short sequences" )
+	{
+		std::size_t mismatches = 0u;
+		for( unsigned a = 0u; a != 256u; ++a )
+			for( unsigned b = 0u; b != 256u; ++b )
+			{
+				std::string str{ to_char_each( {
+						static_cast<int>(a), static_cast<int>(b) } ) };
+				mismatches += utf8_count_mismatches( str );
+
+				if( a >= 0xC0u )
+					for( unsigned c = 0x70u; c != 0xD0u; ++c )
+					{
+						// ASCII before and after the symbol.
+						std::string long_str{ "Hello" };
+						long_str += str;
+						long_str.push_back( static_cast<char>(c) );
+						long_str += "World";
+						mismatches += utf8_count_mismatches( long_str );
+					}
+			}
+
+		REQUIRE( 0u == mismatches );
+	}
+
+	SECTION( "long texts" )
+	{
+		const std::string ascii{ "The quick brown fox jumps over the lazy dog. " };
+		// "Привет, мир! " and "日本語のテキスト" in UTF-8.
+		const std::string cyrillic{ to_char_each( {
+				0xd0, 0x9f, 0xd1, 0x80, 0xd0, 0xb8, 0xd0, 0xb2, 0xd0, 0xb5,
+				0xd1, 0x82, 0x2c, 0x20, 0xd0, 0xbc, 0xd0, 0xb8, 0xd1, 0x80,
+				0x21, 0x20 } ) };
+		const std::string cjk{ to_char_each( {
+				0xe6, 0x97, 0xa5, 0xe6, 0x9c, 0xac, 0xe8, 0xaa, 0x9e, 0xe3,
+				0x81, 0xae, 0xe3, 0x83, 0x86, 0xe3, 0x82, 0xad, 0xe3, 0x82,
+				0xb9, 0xe3, 0x83, 0x88 } ) };
+		const std::string emoji{ to_char_each( { 0xf0, 0x9f, 0x98, 0x80 } ) };
+
+		std::string text;
+		for( int i = 0; i != 5; ++i )
+			text += ascii + cyrillic + ascii + ascii + cjk + emoji;
+
+		REQUIRE( utf8_check_byte_by_byte( text ) );
+		REQUIRE( 0u == utf8_count_mismatches( text ) );
+
+		// Every byte of the text is replaced by some interesting value.
+		std::size_t mismatches = 0u;
+		for( std::size_t i = 0u; i != text.size(); ++i )
+			for( unsigned byte :
+					{ 0x41u, 0x80u, 0xA0u, 0xC0u, 0xE0u, 0xEDu, 0xF4u, 0xF8u, 0xFFu } )
+			{
+				std::string broken = text;
+				broken[ i ] = static_cast<char>(byte);
+				mismatches += utf8_count_mismatches(
+						broken.substr( i < 64u ? 0u : i - 64u, 128u ) );
+			}
+
+		REQUIRE( 0u == mismatches );
+	}
+}
+
 TEST_CASE(
 	"validation_state_str function" ,
 	"[validators][state_to_str]" )
@@ -183,6 +295,27 @@ TEST_CASE(
 		REQUIRE( unmasker.m_mask[2] == 0x21 );
 		REQUIRE( unmasker.m_mask[3] == 0x3D );
 	}
+	{
+		std::string payload;
+		for( std::size_t i = 0u; i != 100u; ++i )
+			payload.push_back( static_cast< char >( i * 11u + 5u ) );
+
+		std::string etalon;
+		{
+			unmasker_t unmasker{ 0x37FA213D };
+			for( auto byte: payload )
+				etalon.push_back( static_cast<char>( unmasker.unmask_byte(byte) ) );
+		}
+
+		unmasker_t unmasker{ 0x37FA213D };
+
+		// Parts with sizes that aren't multiple of 4.
+		unmasker.unmask( &payload[ 0 ], 3u );
+		unmasker.unmask( &payload[ 3 ], 22u );
+		unmasker.unmask( &payload[ 25 ], payload.size() - 25u );
+
+		REQUIRE( payload == etalon );
+	}
 }
 
 TEST_CASE(
@@ -0,0 +1,154 @@
+/*
+	restinio
+*/
+
+/*!
+	Benchmarks for the path of a write group from a response builder
+	to the output context of a connection.
+*/
+
+#include <restinio/all.hpp>
+#include <restinio/impl/write_group_output_ctx.hpp>
+
+#include <test/common/microbench.hpp>
+
+using namespace restinio;
+using namespace restinio::impl;
+
+namespace
+{
+
+const char header[] =
+	"HTTP/1.1 200 OK\r\n"
+	"Connection: keep-alive\r\n"
+	"Content-Length: 5\r\n"
+	"\r\n";
+
+const char body[] = "Hello";
+
+//! A typical response: header and body.
+write_group_t
+make_write_group()
+{
+	writable_items_container_t items;
+	items.reserve( 2 );
+	items.emplace_back( const_buffer( header, sizeof(header) - 1u ) );
+	items.emplace_back( const_buffer( body, sizeof(body) - 1u ) );
+
+	return write_group_t{ std::move( items ) };
+}
+
+//! Pass a write group through the output context.
+void
+write_it( write_group_output_ctx_t & output_ctx, write_group_t wg )
+{
+	output_ctx.start_next_write_group( std::move( wg ) );
+
+	for( auto wo = output_ctx.extract_next_write_operation();
+		!holds_alternative< write_group_output_ctx_t::none_write_operation_t >( wo );
+		wo = output_ctx.extract_next_write_operation() )
+	{
+		microbench_consume( get< write_group_output_ctx_t::trivial_write_operation_t >( wo )
+				.get_trivial_bufs().size() );
+	}
+
+	output_ctx.finish_write_group();
+}
+
+} /* anonymous namespace */
+
+int
+main( int argc, const char * argv[] )
+{
+	const auto iterations = microbench_iterations( argc, argv, 1000000u );
+
+	run_microbench( "make write group (2 items)", iterations,
+		[] {
+			microbench_consume( make_write_group().items_count() );
+		} );
+
+	{
+		write_group_output_ctx_t output_ctx;
+
+		run_microbench( "write group through output ctx", iterations,
+			[&] {
+				write_it( output_ctx, make_write_group() );
+			} );
+	}
+
+	{
+		response_coordinator_t coordinator{ 4u };
+
+		run_microbench( "write group through response coordinator", iterations,
+			[&] {
+				const auto req_id = coordinator.register_new_request();
+				coordinator.append_response(
+						req_id,
+						response_output_flags_t{
+							response_parts_attr_t::final_parts,
+							response_connection_attr_t::connection_keepalive },
+						make_write_group() );
+
+				auto ready = coordinator.pop_ready_buffers();
+				microbench_consume( ready->first.items_count() );
+			} );
+	}
+
+	// A new coordinator for every response (like a connection that
+	// handles only one request).
+	run_microbench( "response coordinator per response", iterations,
+		[] {
+			response_coordinator_t coordinator{ 1u };
+			coordinator.append_response(
+					coordinator.register_new_request(),
+					response_output_flags_t{
+						response_parts_attr_t::final_parts,
+						response_connection_attr_t::connection_close },
+					make_write_group() );
+
+			auto ready = coordinator.pop_ready_buffers();
+			microbench_consume( ready->first.items_count() );
+		} );
+
+	{
+		response_coordinator_t coordinator{ 4u };
+		write_group_output_ctx_t output_ctx;
+
+		run_microbench( "4 pipelined responses (2 write groups each)",
+			iterations / 4u,
+			[&] {
+				request_id_t ids[ 4 ];
+				for( auto & id : ids )
+					id = coordinator.register_new_request();
+
+				for( auto it = std::rbegin( ids ); it != std::rend( ids ); ++it )
+				{
+					coordinator.append_response(
+							*it,
+							response_output_flags_t{
+								response_parts_attr_t::not_final_parts,
+								response_connection_attr_t::connection_keepalive },
+							make_write_group() );
+
+					auto wg = make_write_group();
+					wg.after_write_notificator(
+							[]( const auto & ec ) { microbench_consume( ec.value() ); } );
+					coordinator.append_response(
+							*it,
+							response_output_flags_t{
+								response_parts_attr_t::final_parts,
+								response_connection_attr_t::connection_keepalive },
+							std::move( wg ) );
+				}
+
+				while( auto ready = coordinator.pop_ready_buffers() )
+				{
+					ready->first.invoke_after_write_notificator_if_exists(
+							asio_ns::error_code{} );
+					write_it( output_ctx, std::move( ready->first ) );
+				}
+			} );
+	}
+
+	return 0;
+}
@@ -524,3 +524,117 @@ TEST_CASE( "write_group_output_ctx_t two groups" , "[write_group_output_ctx_t][t
 		REQUIRE_FALSE( wg_output.transmitting() );
 	}
 }
+
+TEST_CASE( "write_group_output_ctx_t coalesced groups" , "[write_group_output_ctx_t][coalesce]" )
+{
+	std::vector< std::string > notifications;
+	const auto make_group = [&]( std::vector< std::string > bufs, std::string name ) {
+			write_group_t wg{ make_buffers( std::move( bufs ) ) };
+			wg.after_write_notificator(
+				[&notifications, name]( const auto & ec ) {
+					notifications.push_back( name + ( ec ? ":error" : ":ok" ) );
+				} );
+			return wg;
+		};
+
+	{
+		write_group_output_ctx_t wg_output{};
+
+		REQUIRE_FALSE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( { "X" } ) } ) );
+
+		wg_output.start_next_write_group( make_group( { "1", "2" }, "first" ) );
+
+		auto second = make_group( { "3", "4" }, "second" );
+		REQUIRE( wg_output.can_be_coalesced( second ) );
+		wg_output.coalesce_write_group( std::move( second ) );
+
+		auto third = make_group( { "5" }, "third" );
+		REQUIRE( wg_output.can_be_coalesced( third ) );
+		wg_output.coalesce_write_group( std::move( third ) );
+
+		REQUIRE( 2u == wg_output.coalesced_groups_count() );
+
+		REQUIRE_FALSE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( restinio::sendfile(
+					restinio::null_file_descriptor() /* fake not real */,
+					restinio::file_meta_t{ 1024, std::chrono::system_clock::now() } ) ) } ) );
+
+		write_group_output_ctx_t::solid_write_operation_variant_t wo{};
+
+		REQUIRE_NOTHROW( wo = wg_output.extract_next_write_operation() );
+		REQUIRE( holds_alternative< trivial_write_operation_t >( wo ) );
+		REQUIRE( 5u == get< trivial_write_operation_t >( wo ).get_trivial_bufs().size() );
+		REQUIRE( 5u == get< trivial_write_operation_t >( wo ).size() );
+		REQUIRE(
+			concat_bufs(
+				get< trivial_write_operation_t >( wo )
+					.get_trivial_bufs() ) == "12345" );
+
+		// Data of the current group is already extracted.
+		REQUIRE_FALSE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( { "X" } ) } ) );
+
+		REQUIRE_NOTHROW( wo = wg_output.extract_next_write_operation() );
+		REQUIRE( holds_alternative< none_write_operation_t >( wo ) );
+
+		REQUIRE( notifications.empty() );
+		REQUIRE_NOTHROW( wg_output.finish_write_group() );
+		REQUIRE_FALSE( wg_output.transmitting() );
+		REQUIRE( 0u == wg_output.coalesced_groups_count() );
+
+		REQUIRE( ( std::vector< std::string >{
+				"first:ok", "second:ok", "third:ok" } ) == notifications );
+	}
+
+	notifications.clear();
+
+	{
+		write_group_output_ctx_t wg_output{};
+
+		wg_output.start_next_write_group( make_group( { "1" }, "first" ) );
+		wg_output.coalesce_write_group( make_group( { "2" }, "second" ) );
+
+		REQUIRE_NOTHROW( wg_output.extract_next_write_operation() );
+		REQUIRE_NOTHROW( wg_output.fail_write_group(
+				asio_ns::error::make_error_code( asio_ns::error::broken_pipe ) ) );
+		REQUIRE_FALSE( wg_output.transmitting() );
+
+		REQUIRE( ( std::vector< std::string >{
+				"first:error", "second:error" } ) == notifications );
+	}
+
+	{
+		// Limits of a gather write.
+		write_group_output_ctx_t wg_output{};
+
+		wg_output.start_next_write_group(
+			write_group_t{ make_buffers(
+				std::vector< std::string >(
+					write_group_output_ctx_t::max_iov_len() - 1u, "A" ) ) } );
+
+		REQUIRE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( { "B" } ) } ) );
+		REQUIRE_FALSE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( { "B", "C" } ) } ) );
+
+		wg_output.coalesce_write_group( write_group_t{ make_buffers( { "B" } ) } );
+		REQUIRE_FALSE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( { "C" } ) } ) );
+
+		REQUIRE_FALSE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( { std::string(
+					write_group_output_ctx_t::max_coalesced_bytes(), 'D' ) } ) } ) );
+	}
+
+	{
+		// A group without data can't be the base for coalescing.
+		write_group_output_ctx_t wg_output{};
+
+		wg_output.start_next_write_group(
+			write_group_t{ writable_items_container_t{} } );
+
+		REQUIRE_FALSE( wg_output.can_be_coalesced(
+				write_group_t{ make_buffers( { "A" } ) } ) );
+	}
+}